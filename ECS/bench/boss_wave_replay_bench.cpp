@@ -0,0 +1,220 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Boss wave replay benchmark - broadphase backends on recorded frames
+*/
+
+#include "ECS/Physics/SpatialHash/SpatialHash.hpp"
+#include "ECS/Physics/UniformGrid/UniformGrid.hpp"
+#include "ECS/Physics/SweepAndPrune/SweepAndPrune.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Recording format (text, one collider per line):
+//   frame
+//   <id> <x> <y> <w> <h> <layer> <mask>
+//   ...
+//   frame
+// Run with a recording path to replay it, with --record <path> to dump the
+// built-in boss wave, or without arguments to replay the built-in wave.
+
+namespace {
+    struct Collider {
+        size_t id;
+        AABB bounds;
+        CollisionFilter filter;
+    };
+
+    using Frame = std::vector<Collider>;
+
+    constexpr uint32_t PLAYER = 1u << 0;
+    constexpr uint32_t ENEMY = 1u << 1;
+    constexpr uint32_t PLAYER_BULLET = 1u << 2;
+    constexpr uint32_t ENEMY_BULLET = 1u << 3;
+
+    // Four players firing into a boss plus escort waves, the boss spraying
+    // radial bursts; 20 seconds at 60 Hz
+    std::vector<Frame> make_boss_wave() {
+        struct Body { size_t id; float x, y, vx, vy, w, h; CollisionFilter filter; int ttl; };
+        std::vector<Body> bodies;
+        std::vector<Frame> frames;
+        size_t next_id = 0;
+        const float dt = 1.0f / 60.0f;
+
+        const size_t boss = next_id++;
+        for (int p = 0; p < 4; ++p) {
+            bodies.push_back({next_id++, 100.0f, 200.0f + p * 200.0f, 0, 0, 64, 32,
+                              CollisionFilter(PLAYER, ENEMY | ENEMY_BULLET), -1});
+        }
+
+        for (int f = 0; f < 1200; ++f) {
+            float t = f * dt;
+            float boss_y = 540.0f + std::sin(t) * 300.0f;
+
+            if (f % 6 == 0) {
+                for (int p = 0; p < 4; ++p) {
+                    bodies.push_back({next_id++, 170.0f, 210.0f + p * 200.0f, 900.0f, 0, 16, 8,
+                                      CollisionFilter(PLAYER_BULLET, ENEMY), 150});
+                }
+            }
+            if (f % 20 == 0) {
+                for (int k = 0; k < 24; ++k) {
+                    float a = k * 6.2831853f / 24.0f + t;
+                    bodies.push_back({next_id++, 1500.0f, boss_y, std::cos(a) * 300.0f, std::sin(a) * 300.0f,
+                                      12, 12, CollisionFilter(ENEMY_BULLET, PLAYER), 400});
+                }
+            }
+            if (f % 45 == 0) {
+                for (int k = 0; k < 8; ++k) {
+                    bodies.push_back({next_id++, 1970.0f + k * 60.0f, 100.0f + k * 110.0f, -220.0f, 0,
+                                      48, 48, CollisionFilter(ENEMY, PLAYER | PLAYER_BULLET), 700});
+                }
+            }
+
+            Frame frame;
+            frame.push_back({boss, AABB(1450.0f, boss_y - 150.0f, 300, 300), CollisionFilter(ENEMY, PLAYER | PLAYER_BULLET)});
+            size_t alive = 0;
+            for (auto& b : bodies) {
+                if (b.ttl == 0) continue;
+                if (b.ttl > 0) b.ttl--;
+                b.x += b.vx * dt;
+                b.y += b.vy * dt;
+                frame.push_back({b.id, AABB(b.x, b.y, b.w, b.h), b.filter});
+                bodies[alive++] = b;
+            }
+            bodies.resize(alive);
+            frames.push_back(std::move(frame));
+        }
+        return frames;
+    }
+
+    bool load_recording(const std::string& path, std::vector<Frame>& frames) {
+        std::ifstream in(path);
+        if (!in) return false;
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line == "frame") {
+                frames.emplace_back();
+                continue;
+            }
+            if (line.empty() || frames.empty()) continue;
+            std::istringstream ss(line);
+            Collider c{};
+            ss >> c.id >> c.bounds.x >> c.bounds.y >> c.bounds.width >> c.bounds.height
+               >> c.filter.layer >> c.filter.mask;
+            if (ss) frames.back().push_back(c);
+        }
+        return true;
+    }
+
+    void save_recording(const std::string& path, const std::vector<Frame>& frames) {
+        std::ofstream out(path);
+        for (const auto& frame : frames) {
+            out << "frame\n";
+            for (const auto& c : frame) {
+                out << c.id << ' ' << c.bounds.x << ' ' << c.bounds.y << ' ' << c.bounds.width << ' '
+                    << c.bounds.height << ' ' << c.filter.layer << ' ' << c.filter.mask << '\n';
+            }
+        }
+    }
+
+    void replay(IBroadphase& broadphase, const std::vector<Frame>& frames) {
+        std::vector<std::pair<size_t, size_t>> pairs;
+        size_t total_pairs = 0;
+        double worst_ms = 0.0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& frame : frames) {
+            auto frame_start = std::chrono::steady_clock::now();
+            broadphase.clear();
+            for (const auto& c : frame) {
+                broadphase.insert(c.id, c.bounds, c.filter);
+            }
+            broadphase.get_potential_collisions(pairs);
+            total_pairs += pairs.size();
+            auto frame_end = std::chrono::steady_clock::now();
+            worst_ms = std::max(worst_ms, std::chrono::duration<double, std::milli>(frame_end - frame_start).count());
+        }
+        auto end = std::chrono::steady_clock::now();
+        double total_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+        std::cout << "  " << broadphase.get_name() << ": " << total_ms / frames.size() << " ms/frame avg, "
+                  << worst_ms << " ms worst, " << total_pairs / frames.size() << " pairs/frame" << std::endl;
+    }
+
+    // Same frames through PhysicsManager's incremental path, which only
+    // touches the broadphase for colliders that moved
+    void replay_incremental(BroadphaseType type, const std::vector<Frame>& frames) {
+        auto& physics = PhysicsManager::instance();
+        physics.init(type, 64.0f, AABB(-512.0f, -512.0f, 1920.0f + 1024.0f, 1080.0f + 1024.0f));
+
+        std::vector<std::pair<size_t, size_t>> pairs;
+        BroadphaseUpdateStats totals;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& frame : frames) {
+            physics.begin_frame();
+            for (const auto& c : frame) {
+                physics.update_entity(c.id, c.bounds, c.filter);
+            }
+            physics.end_frame();
+            physics.get_collision_pairs(pairs);
+
+            const auto& stats = physics.get_update_stats();
+            totals.rebucketed += stats.rebucketed;
+            totals.moved_in_place += stats.moved_in_place;
+            totals.unchanged += stats.unchanged;
+        }
+        auto end = std::chrono::steady_clock::now();
+        double total_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+        size_t n = frames.size();
+        std::cout << "  " << physics.get_broadphase().get_name() << " (incremental): " << total_ms / n
+                  << " ms/frame avg, per frame " << totals.rebucketed / n << " re-bucketed, "
+                  << totals.moved_in_place / n << " moved in place, " << totals.unchanged / n << " unchanged"
+                  << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<Frame> frames;
+    if (argc >= 3 && std::string(argv[1]) == "--record") {
+        save_recording(argv[2], make_boss_wave());
+        std::cout << "Boss wave recorded to " << argv[2] << std::endl;
+        return 0;
+    }
+    if (argc >= 2) {
+        if (!load_recording(argv[1], frames)) {
+            std::cerr << "Cannot read recording " << argv[1] << std::endl;
+            return 1;
+        }
+    } else {
+        frames = make_boss_wave();
+    }
+    if (frames.empty()) {
+        std::cerr << "Recording has no frames" << std::endl;
+        return 1;
+    }
+
+    size_t peak = 0;
+    for (const auto& frame : frames) peak = std::max(peak, frame.size());
+    std::cout << "Boss wave replay (" << frames.size() << " frames, peak " << peak << " colliders)" << std::endl;
+
+    SpatialHash hash(64.0f);
+    UniformGrid grid(64.0f, AABB(-512.0f, -512.0f, 1920.0f + 1024.0f, 1080.0f + 1024.0f));
+    SweepAndPrune sap;
+    replay(hash, frames);
+    replay(grid, frames);
+    replay(sap, frames);
+    replay_incremental(BroadphaseType::SPATIAL_HASH, frames);
+    replay_incremental(BroadphaseType::UNIFORM_GRID, frames);
+    replay_incremental(BroadphaseType::SWEEP_AND_PRUNE, frames);
+    return 0;
+}
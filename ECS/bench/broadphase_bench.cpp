@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Broadphase benchmark - SpatialHash vs UniformGrid
+*/
+
+#include "ECS/Physics/SpatialHash/SpatialHash.hpp"
+#include "ECS/Physics/UniformGrid/UniformGrid.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr float WORLD_W = 1920.0f;
+    constexpr float WORLD_H = 1080.0f;
+    constexpr float CELL_SIZE = 64.0f;
+
+    // Colliders sized like ships and bullets, spread over the playfield with
+    // a margin on the right where enemies spawn
+    std::vector<AABB> make_colliders(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> px(-64.0f, WORLD_W + 256.0f);
+        std::uniform_real_distribution<float> py(0.0f, WORLD_H);
+        std::uniform_real_distribution<float> size(4.0f, 24.0f);
+        std::vector<AABB> boxes;
+        boxes.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            float s = size(rng);
+            boxes.push_back(AABB{px(rng), py(rng), s, s * 0.5f});
+        }
+        return boxes;
+    }
+
+    // Same per-tick pattern as the collision system: clear, reinsert, pair
+    template<typename Fn>
+    double time_ms_per_tick(int ticks, Fn&& tick) {
+        tick(); // warm up, lets the grid reach its steady-state capacity
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < ticks; ++t) {
+            tick();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / ticks;
+    }
+}
+
+int main() {
+    const size_t counts[] = {1000, 10000, 50000};
+
+    std::cout << "Broadphase (clear + insert + pairs, ms/tick)" << std::endl;
+    for (size_t count : counts) {
+        auto boxes = make_colliders(count, 1234);
+        int ticks = count >= 50000 ? 5 : 20;
+        size_t hash_pairs = 0;
+        size_t grid_pairs = 0;
+
+        SpatialHash hash(CELL_SIZE);
+        double hash_ms = time_ms_per_tick(ticks, [&]() {
+            hash.clear();
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                hash.insert(i, boxes[i]);
+            }
+            hash_pairs = hash.get_potential_collisions().size();
+        });
+
+        UniformGrid grid(CELL_SIZE, AABB(-512.0f, -512.0f, WORLD_W + 1024.0f, WORLD_H + 1024.0f));
+        std::vector<std::pair<size_t, size_t>> pairs;
+        double grid_ms = time_ms_per_tick(ticks, [&]() {
+            grid.clear();
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                grid.insert(i, boxes[i]);
+            }
+            grid.get_potential_collisions(pairs);
+            grid_pairs = pairs.size();
+        });
+
+        std::cout << "  " << count << " colliders" << std::endl;
+        std::cout << "    SpatialHash: " << hash_ms << " ms (" << hash_pairs << " pairs)" << std::endl;
+        std::cout << "    UniformGrid: " << grid_ms << " ms (" << grid_pairs << " pairs)" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** CommandDispatcher benchmark - string-keyed vs typed commands
+*/
+
+#include "ECS/Messaging/CommandDispatcher.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+    struct GetPlayerHealth {
+        using Reply = int;
+        size_t player_id;
+    };
+
+    constexpr int ITERATIONS = 1000000;
+
+    template<typename Fn>
+    double time_ns_per_op(Fn&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            fn(i);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / ITERATIONS;
+    }
+}
+
+int main() {
+    CommandDispatcher dispatcher;
+    // a realistic number of other commands registered alongside
+    for (int i = 0; i < 32; ++i) {
+        dispatcher.register_handler("command_" + std::to_string(i), [](Command&) {});
+    }
+
+    dispatcher.register_handler("get_player_health", [](Command& cmd) {
+        cmd.set_reply("health", static_cast<int>(cmd.get_param<size_t>("player_id")));
+    });
+    dispatcher.register_handler<GetPlayerHealth>([](const GetPlayerHealth& cmd) {
+        return static_cast<int>(cmd.player_id);
+    });
+
+    long long sink = 0;
+
+    double string_ns = time_ns_per_op([&](int i) {
+        Command cmd(CommandType::CUSTOM, "get_player_health");
+        cmd.set_param("player_id", static_cast<size_t>(i));
+        dispatcher.dispatch(cmd);
+        sink += cmd.get_reply<int>("health");
+    });
+
+    double typed_ns = time_ns_per_op([&](int i) {
+        sink += dispatcher.dispatch(GetPlayerHealth{static_cast<size_t>(i)}).value_or(0);
+    });
+
+    std::cout << "CommandDispatcher (" << ITERATIONS << " round trips)" << std::endl;
+    std::cout << "  string-keyed: " << string_ns << " ns/op" << std::endl;
+    std::cout << "  typed:        " << typed_ns << " ns/op" << std::endl;
+    std::cout << "  speedup:      " << string_ns / typed_ns << "x" << std::endl;
+    std::cout << "  (checksum " << sink << ")" << std::endl;
+    return 0;
+}
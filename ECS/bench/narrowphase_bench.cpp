@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Narrow-phase benchmark - per-pair scalar vs SoA batch
+*/
+
+#include "ECS/Physics/Collision/BatchCollisionDetector.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr size_t TOTAL_PAIRS = 5000000; // per measurement, across repeats
+
+    template<typename Fn>
+    double time_ns_per_pair(size_t pairs, Fn&& fn) {
+        size_t repeats = TOTAL_PAIRS / pairs;
+        fn(); // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < repeats; ++i) {
+            fn();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / (repeats * pairs);
+    }
+
+    void report(const char* name, double per_pair, double scalar, double batch, size_t hits) {
+        std::cout << "  " << name << " (" << hits << " hits)" << std::endl;
+        std::cout << "    per-pair:      " << per_pair << " ns/pair" << std::endl;
+        std::cout << "    batch scalar:  " << scalar << " ns/pair" << std::endl;
+        std::cout << "    batch " << BatchCollisionDetector::get_backend() << ":    " << batch << " ns/pair" << std::endl;
+    }
+}
+
+static void run(size_t pairs) {
+    // Broadphase output is mostly near misses, so keep the hit rate moderate
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> pos(0.0f, 128.0f);
+    std::uniform_real_distribution<float> size(4.0f, 48.0f);
+    std::uniform_real_distribution<float> radius(2.0f, 24.0f);
+
+    std::vector<AABB> boxes_a, boxes_b;
+    std::vector<Vector2> centers_a, centers_b;
+    std::vector<float> radii_a, radii_b;
+    AABBPairBatch aabb_batch;
+    CirclePairBatch circle_batch;
+    CircleAABBPairBatch circle_aabb_batch;
+    aabb_batch.reserve(pairs);
+    circle_batch.reserve(pairs);
+    circle_aabb_batch.reserve(pairs);
+
+    for (size_t i = 0; i < pairs; ++i) {
+        boxes_a.push_back(AABB{pos(rng), pos(rng), size(rng), size(rng)});
+        boxes_b.push_back(AABB{pos(rng), pos(rng), size(rng), size(rng)});
+        centers_a.push_back(Vector2{pos(rng), pos(rng)});
+        centers_b.push_back(Vector2{pos(rng), pos(rng)});
+        radii_a.push_back(radius(rng));
+        radii_b.push_back(radius(rng));
+
+        aabb_batch.push(boxes_a[i], boxes_b[i]);
+        circle_batch.push(centers_a[i], radii_a[i], centers_b[i], radii_b[i]);
+        circle_aabb_batch.push(centers_a[i], radii_a[i], boxes_b[i]);
+    }
+
+    std::vector<uint32_t> hits;
+    hits.reserve(pairs + 8);
+    size_t sink = 0;
+
+    std::cout << "Narrow-phase (" << pairs << " candidate pairs)" << std::endl;
+    auto time = [&](auto&& fn) { return time_ns_per_pair(pairs, fn); };
+
+    double aabb_pair = time([&]() {
+        hits.clear();
+        for (uint32_t i = 0; i < pairs; ++i) {
+            if (CollisionDetector::check_aabb(boxes_a[i], boxes_b[i])) hits.push_back(i);
+        }
+    });
+    double aabb_scalar = time([&]() { sink += BatchCollisionDetector::test_aabb_scalar(aabb_batch, hits); });
+    double aabb_batch_ns = time([&]() { sink += BatchCollisionDetector::test_aabb(aabb_batch, hits); });
+    report("AABB", aabb_pair, aabb_scalar, aabb_batch_ns, hits.size());
+
+    double circle_pair = time([&]() {
+        hits.clear();
+        for (uint32_t i = 0; i < pairs; ++i) {
+            if (CollisionDetector::check_circle(centers_a[i], radii_a[i], centers_b[i], radii_b[i])) hits.push_back(i);
+        }
+    });
+    double circle_scalar = time([&]() { sink += BatchCollisionDetector::test_circle_scalar(circle_batch, hits); });
+    double circle_batch_ns = time([&]() { sink += BatchCollisionDetector::test_circle(circle_batch, hits); });
+    report("Circle", circle_pair, circle_scalar, circle_batch_ns, hits.size());
+
+    double ca_pair = time([&]() {
+        hits.clear();
+        for (uint32_t i = 0; i < pairs; ++i) {
+            if (CollisionDetector::check_circle_aabb(centers_a[i], radii_a[i], boxes_b[i])) hits.push_back(i);
+        }
+    });
+    double ca_scalar = time([&]() { sink += BatchCollisionDetector::test_circle_aabb_scalar(circle_aabb_batch, hits); });
+    double ca_batch_ns = time([&]() { sink += BatchCollisionDetector::test_circle_aabb(circle_aabb_batch, hits); });
+    report("Circle-AABB", ca_pair, ca_scalar, ca_batch_ns, hits.size());
+
+    if (sink == 0) std::cout << "  (no hits)" << std::endl;
+}
+
+int main() {
+    // 4096 pairs stay in cache; 100k pairs are bound by memory bandwidth
+    run(4096);
+    run(100000);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Particle benchmark - per-star structs vs SoA pool, CPU side of a frame
+*/
+
+#include "ECS/Renderer/Particles/ParticleRenderer.hpp"
+#include <rlgl.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr size_t TOTAL_PARTICLES = 20000000; // per measurement, across frames
+    constexpr float DT = 1.0f / 60.0f;
+    constexpr float WIDTH = 1920.0f;
+    constexpr float HEIGHT = 1080.0f;
+
+    // What StarBg used to keep per star
+    struct Star {
+        float x, y;
+        float speed;
+        float size;
+        float brightness;
+    };
+
+    template<typename Fn>
+    double time_ns_per_particle(size_t particles, Fn&& fn) {
+        size_t frames = std::max<size_t>(TOTAL_PARTICLES / particles, 10);
+        fn(0); // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < frames; ++i) {
+            fn(i);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / (frames * particles);
+    }
+}
+
+static void run(size_t count) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dis_x(0.0f, WIDTH);
+    std::uniform_real_distribution<float> dis_y(0.0f, HEIGHT);
+    std::uniform_real_distribution<float> dis_speed(50.0f, 300.0f);
+    std::uniform_real_distribution<float> dis_size(0.5f, 3.0f);
+
+    std::vector<Star> stars(count);
+    ParticlePool pool(count);
+    pool.set_wrap({-10.0f, 0.0f, WIDTH + 20.0f, HEIGHT});
+    for (auto& star : stars) {
+        star = {dis_x(rng), dis_y(rng), dis_speed(rng), dis_size(rng), 230.0f};
+
+        ParticleSpawn spawn;
+        spawn.position = {star.x, star.y};
+        spawn.velocity = {-star.speed, 0.0f};
+        spawn.life = PARTICLE_IMMORTAL;
+        spawn.size = star.size;
+        spawn.color = {230, 230, 207, 255};
+        spawn.flicker = 0.2f;
+        spawn.fade = false;
+        pool.spawn(spawn);
+    }
+
+    // Old path: move each struct, then one colored circle per star. The draw
+    // call itself is left out (no GL here), only the per-star work before it.
+    std::vector<Color> colors(count);
+    double aos = time_ns_per_particle(count, [&](size_t frame) {
+        float time = frame * DT;
+        for (size_t i = 0; i < count; ++i) {
+            Star& star = stars[i];
+            star.x -= star.speed * DT;
+            if (star.x < -10.0f) {
+                star.x = WIDTH + 10.0f;
+                star.y = dis_y(rng);
+            }
+            float flicker = 0.8f + 0.2f * std::sin(time * 3.0f + star.x);
+            colors[i] = {static_cast<unsigned char>(star.brightness * flicker),
+                         static_cast<unsigned char>(star.brightness * flicker),
+                         static_cast<unsigned char>(star.brightness * flicker * 0.9f), 255};
+        }
+    });
+
+    double update = time_ns_per_particle(count, [&](size_t) { pool.update(DT); });
+
+    ParticleRenderer renderer;
+    double build = time_ns_per_particle(count, [&](size_t frame) { renderer.build(pool, frame * DT); });
+
+    double frame_ms = (update + build) * count / 1e6;
+    std::cout << "Particles (" << count << ")" << std::endl;
+    std::cout << "  per-star structs:   " << aos << " ns/particle (+1 draw call each)" << std::endl;
+    std::cout << "  pool update:        " << update << " ns/particle" << std::endl;
+    std::cout << "  pool vertex build:  " << build << " ns/particle" << std::endl;
+    std::cout << "  pool frame (CPU):   " << frame_ms << " ms, "
+              << (count + RL_DEFAULT_BATCH_BUFFER_ELEMENTS - 1) / RL_DEFAULT_BATCH_BUFFER_ELEMENTS
+              << " draw calls" << std::endl;
+    if (renderer.get_vertices().size() != count * 4) std::cout << "  (vertex count mismatch)" << std::endl;
+}
+
+int main() {
+    // 150 is StarBg's field, 100k is the stress target
+    run(150);
+    run(10000);
+    run(100000);
+    return 0;
+}
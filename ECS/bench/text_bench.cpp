@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Text benchmark - raylib text layout vs TextLayoutCache, 500 on-screen labels
+*/
+
+#include "ECS/Renderer/Text/TextLayoutCache.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr size_t LABELS = 500;
+    constexpr size_t FRAMES = 2000;
+    constexpr int GLYPHS = 95;      // printable ASCII, what LoadFontEx loads by default
+    constexpr float FONT_SIZE = 24.0f;
+
+    struct FakeFont {
+        std::vector<GlyphInfo> glyphs;
+        std::vector<Rectangle> recs;
+        Font font{};
+
+        FakeFont() : glyphs(GLYPHS), recs(GLYPHS) {
+            for (int i = 0; i < GLYPHS; ++i) {
+                glyphs[i] = {32 + i, 0, 2, 70, {}};
+                recs[i] = {static_cast<float>((i % 16) * 80), static_cast<float>((i / 16) * 128), 64, 110};
+            }
+            font.baseSize = 128;
+            font.glyphCount = GLYPHS;
+            font.texture.id = 1;
+            font.texture.width = 1280;
+            font.texture.height = 768;
+            font.recs = recs.data();
+            font.glyphs = glyphs.data();
+        }
+    };
+
+    // GetGlyphIndex: a linear search per codepoint
+    int glyph_index(const Font& font, int codepoint) {
+        for (int i = 0; i < font.glyphCount; ++i) {
+            if (font.glyphs[i].value == codepoint) return i;
+        }
+        return 0;
+    }
+
+    // MeasureTextEx's loop, ASCII only
+    Vector2 raylib_measure(const Font& font, const char* text, float size, float spacing) {
+        float width = 0.0f;
+        int count = 0;
+        for (const char* c = text; *c; ++c, ++count) {
+            int index = glyph_index(font, *c);
+            width += font.glyphs[index].advanceX != 0 ? font.glyphs[index].advanceX
+                                                      : font.recs[index].width + font.glyphs[index].offsetX;
+        }
+        return {width * size / font.baseSize + (count - 1) * spacing, size};
+    }
+
+    // DrawTextEx's loop up to the quad DrawTexturePro would emit, without rlgl
+    void raylib_draw(const Font& font, const char* text, Vector2 position, float size, float spacing,
+                     std::vector<Rectangle>& quads) {
+        float scale = size / font.baseSize;
+        float offset = 0.0f;
+        for (const char* c = text; *c; ++c) {
+            int index = glyph_index(font, *c);
+            const GlyphInfo& glyph = font.glyphs[index];
+            const Rectangle& rec = font.recs[index];
+            if (*c != ' ') {
+                quads.push_back({position.x + offset + glyph.offsetX * scale, position.y + glyph.offsetY * scale,
+                                 rec.width * scale, rec.height * scale});
+            }
+            offset += (glyph.advanceX != 0 ? glyph.advanceX : rec.width) * scale + spacing;
+        }
+    }
+
+    template<typename Fn>
+    double time_us_per_frame(Fn&& fn) {
+        fn(0); // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (size_t frame = 1; frame <= FRAMES; ++frame) {
+            fn(frame);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / FRAMES;
+    }
+}
+
+// changing: how many labels show a new value every frame (score, timers)
+static void run(size_t changing) {
+    FakeFont fake;
+    const Font& font = fake.font;
+    std::vector<std::string> labels(LABELS);
+    auto label_for = [](size_t i, size_t frame) {
+        return "PLAYER " + std::to_string(i % 4 + 1) + "  SCORE " + std::to_string(i * 1000 + frame);
+    };
+    for (size_t i = 0; i < LABELS; ++i) {
+        labels[i] = label_for(i, 0);
+    }
+    auto refresh = [&](size_t frame) {
+        for (size_t i = 0; i < changing; ++i) {
+            labels[i] = label_for(i, frame);
+        }
+    };
+
+    // UI labels measure to align, then draw
+    std::vector<Rectangle> quads;
+    double raylib_path = time_us_per_frame([&](size_t frame) {
+        refresh(frame);
+        quads.clear();
+        for (size_t i = 0; i < LABELS; ++i) {
+            Vector2 size = raylib_measure(font, labels[i].c_str(), FONT_SIZE, 1.0f);
+            raylib_draw(font, labels[i].c_str(), {960.0f - size.x / 2, i * 2.0f}, FONT_SIZE, 1.0f, quads);
+        }
+    });
+
+    TextLayoutCache cache;
+    SpriteBatch batch;
+    batch.set_sort_by_layer(true);
+    double cached_path = time_us_per_frame([&](size_t frame) {
+        refresh(frame);
+        batch.begin();
+        for (size_t i = 0; i < LABELS; ++i) {
+            Vector2 size = cache.measure(font, labels[i].c_str(), FONT_SIZE, 1.0f);
+            cache.queue(batch, font, labels[i].c_str(), {960.0f - size.x / 2, i * 2.0f}, FONT_SIZE, 1.0f, WHITE, 10);
+        }
+        batch.end();
+        cache.end_frame();
+    });
+
+    std::cout << "Text (" << LABELS << " labels, " << changing << " changing per frame)" << std::endl;
+    std::cout << "  raylib measure + layout: " << raylib_path << " us/frame" << std::endl;
+    std::cout << "  cached measure + batch:  " << cached_path << " us/frame, "
+              << cache.get_entry_count() << " cached strings" << std::endl;
+}
+
+int main() {
+    run(0);
+    run(50);
+    run(LABELS);
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetArchive - Many asset files packed into one memory-mapped file
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One file instead of a directory tree:
+//   header   "RPAK", version, entry count, index offset and size
+//   blobs    each file's bytes, starting on a 16-byte boundary
+//   index    per entry: offset, size (uint64), name length (uint16), name
+// Names are paths relative to the packed directory, with '/' separators.
+// open() maps the whole file and reads the index once; a lookup is then a
+// hash and a pointer into the mapping, with no open() or stat() per asset.
+class AssetArchive {
+    public:
+        static constexpr size_t ALIGNMENT = 16;
+
+        AssetArchive() = default;
+        ~AssetArchive();
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        // Every regular file under root, relative to it, sorted
+        static std::vector<std::string> collect(const std::string& root);
+        // Packs root/<name> for each name; written next to path, then renamed
+        // over it, so a reader never maps a half-written archive
+        static bool write(const std::string& path, const std::string& root, const std::vector<std::string>& names);
+
+        bool open(const std::string& path);
+        void close();
+        bool is_open() const { return data_ != nullptr; }
+
+        // Points into the mapping, valid until close(); null when absent
+        const unsigned char* find(const std::string& name, size_t* size = nullptr) const;
+        bool contains(const std::string& name) const { return entries_.count(name) != 0; }
+        // Names of the files directly in directory ("" for the top level)
+        std::vector<std::string> list(const std::string& directory) const;
+        size_t size() const { return entries_.size(); }
+
+    private:
+        struct Entry {
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        std::unordered_map<std::string, Entry> entries_;
+        const unsigned char* data_{nullptr};
+        size_t data_size_{0};
+#ifdef _WIN32
+        void* file_{nullptr};
+        void* mapping_{nullptr};
+#endif
+};
@@ -9,6 +9,11 @@
 
 #include "Texture/TextureManager.hpp"
 #include "Sound/SoundManager.hpp"
+#include "Atlas/TextureAtlas.hpp"
+#include "Archive/AssetArchive.hpp"
+#include "Streaming/AssetStreamer.hpp"
+#include "Streaming/AssetManifest.hpp"
+#include "ECS/Components/TextureRef.hpp"
 
 class AssetManager {
     public:
@@ -16,14 +21,59 @@ class AssetManager {
 
         void init();
         void shutdown();
+        // Once per frame on the main thread: uploads what the streamer decoded
+        void update(double budget = 0.004) { streamer_.update(budget); }
 
+        // Blocking: reads and decodes on the calling thread
         Texture2D* get_texture(const std::string& path);
         Sound* get_sound(const std::string& path);
 
+        // Non-blocking: the handle resolves in a later update()
+        AssetHandle<Texture2D> request_texture(const std::string& path) { return textures_.load_async(streamer_, path); }
+        AssetHandle<Sound> request_sound(const std::string& path) { return sounds_.load_async(streamer_, path); }
+        AssetStreamer& get_streamer() { return streamer_; }
+
+        // Serves the files under root from a packed archive: every raylib file
+        // read (images, sounds, fonts, music through load_async()) is then a
+        // copy out of the mapping. Paths the archive lacks, and everything
+        // when it is not mounted, still load from disk. Nothing under root is
+        // checked: keeping the archive current is the build's job. Mount and
+        // unmount while nothing is streaming.
+        bool mount_archive(const std::string& path, const std::string& root);
+        void unmount_archive();
+        bool in_archive(const std::string& path) const;
+        // Files directly in directory: from the archive when it covers it, from disk otherwise
+        std::vector<std::string> list_files(const std::string& directory) const;
+
         void unload_texture(const std::string& path);
         void unload_sound(const std::string& path);
 
+        // Reference-counted preloading. acquire() requests what is not loaded
+        // yet (atlas-packed textures need nothing); release() unloads what no
+        // acquired manifest lists any more.
+        void acquire(const AssetManifest& manifest);
+        void release(const AssetManifest& manifest);
+        // True once nothing the manifest lists is still streaming
+        bool is_ready(const AssetManifest& manifest) const;
+
+        TextureAtlas& get_atlas() { return atlas_; }
+        // Baked copies get_texture() and request_texture() load instead of the source
+        TextureBundle& get_bundle() { return textures_.get_bundle(); }
+
+        // Shared by every render system: points ref at the atlas page holding
+        // path, or at its standalone texture. Only does the lookup when ref was
+        // resolved before the last texture unload or atlas rebuild. A texture
+        // still streaming resolves to null, without waiting for it.
+        const texture_ref& resolve_texture(const std::string& path, texture_ref& ref) {
+            if (ref.generation != get_texture_generation()) refresh_texture(path, ref);
+            return ref;
+        }
+        // Changes whenever a texture pointer handed out may have gone stale
+        uint32_t get_texture_generation() const { return generation_ + atlas_.get_generation(); }
+
         size_t texture_count() const { return textures_.count(); }
+        // GPU memory held by atlas pages and standalone textures
+        size_t texture_memory() const { return textures_.resident_bytes() + atlas_.resident_bytes(); }
         size_t sound_count() const { return sounds_.count(); }
 
     private:
@@ -32,6 +82,20 @@ class AssetManager {
         AssetManager(const AssetManager&) = delete;
         AssetManager& operator=(const AssetManager&) = delete;
 
+        void refresh_texture(const std::string& path, texture_ref& ref);
+        // Relative name of path in the archive, false when outside its root
+        bool archive_name(const std::string& path, std::string& name) const;
+        // raylib's LoadFileData() hook
+        static unsigned char* load_file_data(const char* path, int* size);
+        bool is_packed(const std::string& path) const { return atlas_.find(path) != nullptr; }
+
         TextureManager textures_;
         SoundManager sounds_;
+        TextureAtlas atlas_;
+        AssetStreamer streamer_;
+        AssetArchive archive_;
+        std::string archive_root_;
+        std::unordered_map<std::string, uint32_t> texture_refs_;
+        std::unordered_map<std::string, uint32_t> sound_refs_;
+        uint32_t generation_{1};
 };
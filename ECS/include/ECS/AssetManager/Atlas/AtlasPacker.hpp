@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AtlasPacker - Skyline bin packing of rectangles into square pages
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+struct AtlasPlacement {
+    int page{-1};   // -1: larger than a page, left out
+    int x{0};
+    int y{0};
+};
+
+// Bottom-left skyline packer. Rectangles are placed tallest first; each one
+// goes to the first page it fits in, a new page is opened otherwise.
+// Padding is kept on the right and bottom of every rectangle.
+class AtlasPacker {
+    public:
+        struct Size {
+            int width;
+            int height;
+        };
+
+        explicit AtlasPacker(int page_size = 2048, int padding = 2);
+
+        // out[i] is the placement of sizes[i]. Returns how many were placed.
+        size_t pack(const std::vector<Size>& sizes, std::vector<AtlasPlacement>& out);
+
+        int get_page_size() const { return page_size_; }
+        int get_page_count() const { return static_cast<int>(pages_.size()); }
+        // Used area over total page area, padding included
+        float get_occupancy() const;
+
+    private:
+        struct SkylineNode {
+            int x;
+            int y;
+            int width;
+        };
+
+        using Skyline = std::vector<SkylineNode>;
+
+        bool find_position(const Skyline& skyline, int width, int height,
+                           size_t& node_index, int& x, int& y) const;
+        void place(Skyline& skyline, size_t node_index, int x, int y, int width, int height);
+
+        int page_size_;
+        int padding_;
+        std::vector<Skyline> pages_;
+        long long used_area_{0};
+};
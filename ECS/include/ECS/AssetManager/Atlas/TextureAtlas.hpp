@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextureAtlas - Packs many images into a few texture pages
+*/
+
+#pragma once
+
+#include "ECS/AssetManager/Texture/TextureBundle.hpp"
+#include <raylib.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct AtlasRegion {
+    int page;
+    Rectangle rect;      // pixels in the page
+    float scale{1.0f};   // page pixels per source image pixel
+};
+
+// Built at startup from image files, or loaded from a previous save():
+//   <prefix>.atlas      region table (text)
+//   <prefix>_<n>.png    one image per page
+// Images listed in scales are shrunk before packing. Images larger than a
+// page are left out and keep their own texture.
+class TextureAtlas {
+    public:
+        TextureAtlas() = default;
+        ~TextureAtlas();
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        // CPU side: loads and packs the images into page images
+        bool build(const std::vector<std::string>& paths, int page_size = 2048, int padding = 2,
+                   const TextureScales& scales = {});
+        bool save(const std::string& prefix) const;
+        bool load(const std::string& prefix);
+        // Loads <prefix> unless missing, built from another path list or
+        // scales, or older than one of the images; otherwise builds and
+        // saves it. Uploads the pages either way.
+        bool load_or_build(const std::string& prefix, const std::vector<std::string>& paths,
+                           int page_size = 2048, const TextureScales& scales = {});
+
+        // GPU side: turns page images into textures and frees the images
+        void upload();
+        void unload();
+
+        const AtlasRegion* find(const std::string& path) const;
+        Texture2D* get_page(int page);
+
+        size_t page_count() const { return page_count_; }
+        size_t region_count() const { return regions_.size(); }
+        size_t resident_bytes() const;
+        // Bumped by every build/load/unload, so cached lookups can tell they are stale
+        uint32_t get_generation() const { return generation_; }
+
+    private:
+        void release_images();
+
+        std::unordered_map<std::string, AtlasRegion> regions_;
+        std::vector<std::string> sources_;   // paths asked for, packed or not
+        std::vector<float> source_scales_;   // the scale each was asked at
+        std::vector<Image> page_images_;
+        std::vector<Texture2D> page_textures_;
+        size_t page_count_{0};
+        int page_size_{0};
+        uint32_t generation_{0};
+};
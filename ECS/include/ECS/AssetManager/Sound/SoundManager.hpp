@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "ECS/AssetManager/Streaming/AssetStreamer.hpp"
 #include <unordered_map>
 #include <string>
 #include <raylib.h>
@@ -14,10 +15,16 @@
 class SoundManager {
     public:
         Sound* load(const std::string& path);
+        // Decoded on a streamer worker, handed to the audio device by its update()
+        AssetHandle<Sound> load_async(AssetStreamer& streamer, const std::string& path);
+        bool is_pending(const std::string& path) const { return pending_.count(path) != 0; }
         void unload(const std::string& path);
         void clear();
         size_t count() const { return cache_.size(); }
 
     private:
+        using Slot = AssetHandle<Sound>::Slot;
+
         std::unordered_map<std::string, Sound> cache_;
+        std::unordered_map<std::string, std::shared_ptr<Slot>> pending_;
 };
@@ -0,0 +1,19 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetManifest - Assets a screen or level needs before it is playable
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct AssetManifest {
+    std::vector<std::string> textures;
+    std::vector<std::string> sounds;
+
+    bool empty() const { return textures.empty() && sounds.empty(); }
+    size_t size() const { return textures.size() + sounds.size(); }
+};
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetStreamer - Background file reading and decoding, main-thread upload
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class AssetState : uint8_t {
+    PENDING,
+    READY,
+    FAILED
+};
+
+// Result of an asynchronous load. Copies share the same request; the asset
+// pointer has the same lifetime as the one the synchronous getter returns.
+// Only read and resolved on the main thread.
+template <typename T>
+class AssetHandle {
+    public:
+        struct Slot {
+            AssetState state{AssetState::PENDING};
+            T* asset{nullptr};
+        };
+
+        AssetHandle() = default;
+        explicit AssetHandle(std::shared_ptr<Slot> slot) : slot_(std::move(slot)) {}
+
+        bool valid() const { return slot_ != nullptr; }
+        AssetState state() const { return slot_ ? slot_->state : AssetState::FAILED; }
+        bool pending() const { return state() == AssetState::PENDING; }
+        bool ready() const { return state() == AssetState::READY; }
+        bool failed() const { return state() == AssetState::FAILED; }
+        // Null until ready
+        T* get() const { return ready() ? slot_->asset : nullptr; }
+
+    private:
+        std::shared_ptr<Slot> slot_;
+};
+
+// File reads and decodes (images, waves, raw files) run on worker threads;
+// the completion callbacks, which create the GPU textures and audio buffers,
+// run on the main thread from update(). Nothing here blocks the caller except
+// finish().
+class AssetStreamer {
+    public:
+        // 0 workers: the work runs on the main thread too, inside update()
+        explicit AssetStreamer(size_t worker_count = default_worker_count());
+        ~AssetStreamer();
+        AssetStreamer(const AssetStreamer&) = delete;
+        AssetStreamer& operator=(const AssetStreamer&) = delete;
+
+        static size_t default_worker_count();
+
+        // work runs on a worker and must not touch the GL context or the audio
+        // device; done runs on the main thread afterwards, in the order the
+        // work finished. With more than one worker that is not the submission
+        // order: chain jobs from done when one must follow another
+        void enqueue(std::function<void()> work, std::function<void()> done);
+
+        // done owns the image/wave/file data; a failed load gives it empty data
+        void load_image(const std::string& path, std::function<void(Image)> done);
+        void load_wave(const std::string& path, std::function<void(Wave)> done);
+        void read_file(const std::string& path, std::function<void(unsigned char*, int)> done);
+
+        // Runs finished callbacks until budget (seconds) is spent, at least one.
+        // Returns how many ran.
+        size_t update(double budget = 0.004);
+        // Blocks until every job is done and its callback ran: loading screens, shutdown
+        void finish();
+
+        // Jobs enqueued whose callback has not run yet
+        size_t pending() const { return pending_; }
+        size_t get_worker_count() const { return workers_count_; }
+
+    private:
+        struct Job {
+            std::function<void()> work;
+            std::function<void()> done;
+        };
+
+        void start_workers();
+        void worker_loop();
+        bool run_one();
+
+        size_t workers_count_;
+        std::vector<std::thread> workers_;
+        mutable std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable finished_;
+        std::deque<Job> queue_;         // waiting for a worker
+        std::deque<Job> completed_;     // work done, callback not run yet
+        size_t pending_{0};
+        bool stop_{false};
+};
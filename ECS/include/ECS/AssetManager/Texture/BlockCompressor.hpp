@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** BlockCompressor - DXT1/DXT5 encoder and DDS writer
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// raylib uploads DXT textures and reads DDS files, but cannot write either,
+// so baked textures are encoded here. Both formats store 4x4 texel blocks:
+//   DXT1   8 bytes a block: opaque images, or cut-out alpha (0 or 255)
+//   DXT5  16 bytes a block: anything with partial alpha
+class BlockCompressor {
+    public:
+        enum class Format { DXT1, DXT5 };
+
+        // DXT1 unless a texel's alpha is neither 0 nor 255
+        static Format pick_format(const unsigned char* rgba, size_t pixels);
+        static size_t level_size(int width, int height, Format format);
+        // Appends the blocks of one RGBA8 level to out, row by row
+        static void compress(const unsigned char* rgba, int width, int height, Format format,
+                             std::vector<unsigned char>& out);
+
+        // Halves the previous level (floor, like raylib does) with an
+        // alpha-weighted 2x2 box filter, so transparent texels do not darken
+        // edges. Stops before a side drops under a block, or at max_levels.
+        static std::vector<std::vector<unsigned char>> build_mips(const unsigned char* rgba, int width,
+                                                                  int height, int max_levels = 0);
+
+        // Compresses rgba and its mips into a DDS file; returns the mip count, 0 on failure
+        static int write_dds(const std::string& path, const unsigned char* rgba, int width, int height,
+                             int max_levels = 0);
+};
@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextureBundle - Source images baked for the size they are drawn at
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct BundleEntry {
+    std::string file;    // baked DDS
+    float scale;         // baked width / source width
+};
+
+// How much of each source image the game needs: 0.25 keeps a quarter of its
+// width and height. Images not listed are drawn at full size.
+using TextureScales = std::unordered_map<std::string, float>;
+
+// Each listed image resized by its scale, with its mips, block-compressed
+// (see BlockCompressor). Loading one is a file read and an upload, with no
+// PNG decode, and it takes a fraction of the RGBA8 memory:
+//   <dir>/bundle.index   "texture <asked scale> <baked scale> <file> <source>" lines
+//   <dir>/<n>_<name>.dds
+class TextureBundle {
+    public:
+        // Reads the index, bakes the images missing from it, asked at
+        // another scale or older than their source, and rewrites it
+        bool load_or_build(const std::string& dir, const TextureScales& scales);
+        // Resizes and compresses one image; returns the scale it got, 0 on failure
+        static float bake(const std::string& source, const std::string& file, float scale);
+
+        const BundleEntry* find(const std::string& path) const;
+        void clear() { entries_.clear(); }
+        size_t size() const { return entries_.size(); }
+
+    private:
+        std::unordered_map<std::string, BundleEntry> entries_;
+};
@@ -7,17 +7,39 @@
 
 #pragma once
 
+#include "ECS/AssetManager/Streaming/AssetStreamer.hpp"
+#include "ECS/AssetManager/Texture/TextureBundle.hpp"
 #include <unordered_map>
 #include <string>
 #include <raylib.h>
 
+// A path the bundle has baked loads from its DDS instead, unless the GPU
+// cannot take DXT textures: then it falls back to the source image.
 class TextureManager {
     public:
         Texture2D* load(const std::string& path);
+        // Decoded on a streamer worker, uploaded by its update(); a second
+        // request for the same path shares the first one's handle
+        AssetHandle<Texture2D> load_async(AssetStreamer& streamer, const std::string& path);
+        bool is_pending(const std::string& path) const { return pending_.count(path) != 0; }
         void unload(const std::string& path);
         void clear();
         size_t count() const { return cache_.size(); }
+        // Texture pixels per source pixel: below 1 when path loaded baked
+        float get_scale(const std::string& path) const;
+        // GPU memory held by the loaded textures, mips included
+        size_t resident_bytes() const;
+
+        TextureBundle& get_bundle() { return bundle_; }
 
     private:
+        using Slot = AssetHandle<Texture2D>::Slot;
+
+        Texture2D* upload(const std::string& path, Image& image);
+        Texture2D* store(const std::string& path, Texture2D tex, const BundleEntry* baked);
+
+        TextureBundle bundle_;
         std::unordered_map<std::string, Texture2D> cache_;
+        std::unordered_map<std::string, float> scales_;
+        std::unordered_map<std::string, std::shared_ptr<Slot>> pending_;
 };
@@ -16,6 +16,10 @@ class MusicPlayer : public ISoundPlayer {
         ~MusicPlayer();
 
         void load(const std::string& name, const std::string& path) override;
+        // The file is read on the asset streamer and the stream opened from
+        // memory; play() before it is ready starts it once it arrives
+        void load_async(const std::string& name, const std::string& path);
+        bool isLoaded(const std::string& name) const { return _musicCache.count(name) != 0; }
         void unload(const std::string& name) override;
         void clear() override;
 
@@ -30,6 +34,10 @@ class MusicPlayer : public ISoundPlayer {
         std::unordered_map<std::string, Music>& getMusicCache() { return _musicCache; }
         void setMusicCache(const std::unordered_map<std::string, Music>& cache) { _musicCache = cache; }
     private:
+        void release(const std::string& name, Music& music);
+
         std::unordered_map<std::string, Music> _musicCache;
+        std::unordered_map<std::string, unsigned char*> _musicData;    // files streamed from memory
+        std::unordered_map<std::string, float> _pending;               // name -> volume to play it at once loaded, < 0: none
         float _masterVolume;
 };
@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** SFXMixer - Fixed pool of voices over shared sound buffers
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Volume groups; a voice plays at volume * bus volume * master volume
+enum class SFXBus : uint8_t {
+    EFFECTS,
+    WEAPONS,
+    IMPACTS,
+    INTERFACE,
+    COUNT
+};
+
+// Each sound added gets its instances up front: the sound itself plus
+// LoadSoundAlias() copies sharing its decoded buffer. play() then only picks
+// an instance and a voice, so it never decodes or allocates:
+// - every instance of the sound busy: its oldest one restarts
+// - every voice busy: the lowest-priority, oldest voice is stolen when the
+//   new sound's priority is at least as high; otherwise the new one is dropped
+// A voice counts as busy for its sound's length, on the clock update() advances.
+class SFXMixer {
+    public:
+        static constexpr int NO_VOICE = -1;
+
+        explicit SFXMixer(size_t voice_count = 16, size_t instances_per_sound = 4);
+        ~SFXMixer();
+        SFXMixer(const SFXMixer&) = delete;
+        SFXMixer& operator=(const SFXMixer&) = delete;
+
+        // Takes ownership of sound; the id stays valid until remove()
+        int add(Sound sound, SFXBus bus = SFXBus::EFFECTS, int priority = 0);
+        void remove(int id);
+        void clear();
+        bool has(int id) const { return id >= 0 && static_cast<size_t>(id) < sounds_.size() && sounds_[id].used; }
+
+        // Returns the voice it plays on, or NO_VOICE when dropped
+        int play(int id, float volume = 1.0f);
+        void stop(int id);
+        void stop_all();
+        void update(float delta_time) { clock_ += delta_time; }
+
+        void set_master_volume(float volume);
+        float get_master_volume() const { return master_volume_; }
+        void set_bus_volume(SFXBus bus, float volume);
+        float get_bus_volume(SFXBus bus) const { return bus_volumes_[static_cast<size_t>(bus)]; }
+
+        size_t get_voice_count() const { return voices_.size(); }
+        size_t get_active_voices() const;
+        size_t get_stolen_count() const { return stolen_; }
+        size_t get_dropped_count() const { return dropped_; }
+
+    private:
+        struct Entry {
+            std::vector<Sound> instances;    // [0] owns the buffer, the rest are aliases
+            double length{0.0};              // seconds
+            SFXBus bus{SFXBus::EFFECTS};
+            int priority{0};
+            bool used{false};
+        };
+        struct Voice {
+            int sound{-1};
+            size_t instance{0};
+            int priority{0};
+            float volume{1.0f};
+            double ends{0.0};
+            uint64_t order{0};
+        };
+
+        bool busy(const Voice& voice) const { return voice.sound >= 0 && voice.ends > clock_; }
+        void apply_volume(const Voice& voice);
+        void stop_voice(Voice& voice);
+
+        std::vector<Entry> sounds_;
+        std::vector<int> free_ids_;
+        std::vector<Voice> voices_;
+        size_t instances_per_sound_;
+        float master_volume_{1.0f};
+        float bus_volumes_[static_cast<size_t>(SFXBus::COUNT)];
+        double clock_{0.0};
+        uint64_t next_order_{0};
+        size_t stolen_{0};
+        size_t dropped_{0};
+};
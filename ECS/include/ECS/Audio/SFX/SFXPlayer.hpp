@@ -8,25 +8,41 @@
 #pragma once
 
 #include "ECS/Audio/ISoundPlayer.hpp"
+#include "ECS/Audio/SFX/SFXMixer.hpp"
 
 class SFXPlayer : public ISoundPlayer {
     public:
         SFXPlayer();
         ~SFXPlayer();
 
-        void load(const std::string& name, const std::string& path) override;
+        void load(const std::string& name, const std::string& path) override { load(name, path, SFXBus::EFFECTS); }
+        // bus and priority: see SFXMixer
+        void load(const std::string& name, const std::string& path, SFXBus bus, int priority = 0);
+        // Decoded on the asset streamer; does nothing if name is loaded or
+        // on its way. play() before it is ready plays it once it arrives.
+        void load_async(const std::string& name, const std::string& path, SFXBus bus = SFXBus::EFFECTS, int priority = 0);
+        bool isLoaded(const std::string& name) const { return _sounds.count(name) != 0; }
         void unload(const std::string& name) override;
         void clear() override;
 
+        // Plays on a free voice of the mixer, overlapping earlier plays of the same sound
         void play(const std::string& name, float volume = 1.0f) override;
         void stopAll() override;
+        // Once per frame: frees the voices whose sound has ended
+        void update(float delta_time) { _mixer.update(delta_time); }
 
-        void setMasterVolume(float volume) override;
-        float getMasterVolume() const override { return _masterVolume; }
+        void setMasterVolume(float volume) override { _mixer.set_master_volume(volume); }
+        float getMasterVolume() const override { return _mixer.get_master_volume(); }
 
-        std::unordered_map<std::string, Sound>& getSoundCache() { return _soundCache; }
-        void setSoundCache(const std::unordered_map<std::string, Sound>& cache) { _soundCache = cache; }
+        SFXMixer& getMixer() { return _mixer; }
     private:
-        std::unordered_map<std::string, Sound> _soundCache;
-        float _masterVolume;
+        struct PendingSound {
+            float volume;     // to play it at once loaded, < 0: none
+            SFXBus bus;
+            int priority;
+        };
+
+        SFXMixer _mixer;
+        std::unordered_map<std::string, int> _sounds;   // name -> mixer id
+        std::unordered_map<std::string, PendingSound> _pending;
 };
@@ -13,6 +13,7 @@
 #include "ECS/Components/Collider.hpp"
 #include "ECS/Components/Sprite.hpp"
 #include "ECS/Components/Animation.hpp"
+#include "ECS/Components/Parallax.hpp"
 
 extern "C" {
     void register_components(registry &r);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "ECS/Components/IComponent.hpp"
+#include "ECS/Components/TextureRef.hpp"
 #include <string>
 
 struct animation : public IComponent {
@@ -36,6 +37,8 @@ struct animation : public IComponent {
     bool play_on_movement{false};
     // stop at the end of the spriteSheet
     bool _stopAtTheEnd{false};
+    // texture_path resolved to a texture (atlas page or standalone) and region
+    texture_ref resolved;
 
 
     animation() = default;
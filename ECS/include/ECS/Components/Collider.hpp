@@ -8,12 +8,31 @@
 #pragma once
 
 #include "ECS/Components/IComponent.hpp"
+#include <cstdint>
+
+// Collider layer bits. An entity pairs with another only when each one's
+// layer is in the other's mask; the defaults collide with everything.
+namespace CollisionLayer {
+    constexpr uint32_t NONE = 0;
+    constexpr uint32_t PLAYER = 1u << 0;
+    constexpr uint32_t ENEMY = 1u << 1;
+    constexpr uint32_t PLAYER_BULLET = 1u << 2;
+    constexpr uint32_t ENEMY_BULLET = 1u << 3;
+    constexpr uint32_t POWER_UP = 1u << 4;
+    constexpr uint32_t ALL = 0xFFFFFFFFu;
+}
 
 struct collider : public IComponent {
     float w{10.f}, h{10.f};
     float offset_x{0.f}, offset_y{0.f};
     bool is_trigger{false};
+    uint32_t layer{CollisionLayer::ALL};
+    uint32_t mask{CollisionLayer::ALL};
+    // Fast movers: the collision pass uses the area swept since the previous
+    // tick (velocity * dt back from the position) instead of the end box
+    bool continuous{false};
 
     collider();
-    collider(float nw, float nh, float ox = 0.f, float oy = 0.f, bool trig = false);
+    collider(float nw, float nh, float ox = 0.f, float oy = 0.f, bool trig = false,
+             uint32_t lyr = CollisionLayer::ALL, uint32_t msk = CollisionLayer::ALL);
 };
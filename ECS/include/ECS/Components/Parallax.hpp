@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** parallax_layer component for scrolling backgrounds
+*/
+
+#pragma once
+
+#include "ECS/Components/IComponent.hpp"
+#include <raylib.h>
+#include <functional>
+#include <utility>
+
+// A background layer repeated over the whole view. Its content is painted once
+// into a tile; after that a frame only moves where the tile is sampled from.
+struct parallax_layer : public IComponent {
+    // Draws the tile's content with raylib calls, in tile pixels (0,0 top-left).
+    // Called once, inside a render texture: RenderManager's batch is not drawn there
+    std::function<void(int width, int height)> paint;
+    // Tile size in pixels; 0 follows the screen size
+    int tile_width{0};
+    int tile_height{0};
+    // Share of the camera movement the layer follows: 0 stays on screen, 1 moves with the world
+    float depth{0.0f};
+    // Drift in pixels per second, on top of the camera
+    float scroll_x{0.0f};
+    float scroll_y{0.0f};
+    Color tint{WHITE};
+    // Sprite batch layer; sprites are on 0, so background layers stay below them
+    int layer{-100};
+    // Set to paint the tile again on the next draw (content changed)
+    bool repaint{false};
+    // Drift so far, kept within the tile
+    float offset_x{0.0f};
+    float offset_y{0.0f};
+
+    parallax_layer() = default;
+    parallax_layer(std::function<void(int, int)> painter, float d, float sx, float sy = 0.0f, int l = -100)
+        : paint(std::move(painter)), depth(d), scroll_x(sx), scroll_y(sy), layer(l) {}
+};
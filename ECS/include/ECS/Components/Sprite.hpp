@@ -8,6 +8,7 @@
 #pragma once
 
 #include "ECS/Components/IComponent.hpp"
+#include "ECS/Components/TextureRef.hpp"
 #include <string>
 
 struct sprite : public IComponent {
@@ -17,6 +18,7 @@ struct sprite : public IComponent {
     float rotation{0.0f};
     int frame_x{0}, frame_y{0};
     bool visible{true};
+    texture_ref resolved;
 
     sprite();
     sprite(const std::string& path, float w, float h);
@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** texture_ref - Texture a sprite or animation draws from, resolved once
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <cstdint>
+
+// Filled by AssetManager::resolve_texture() the first time the component is
+// drawn, and again only when AssetManager's texture generation changes, so
+// drawing is a pointer dereference rather than a path lookup.
+struct texture_ref {
+    Texture2D* texture{nullptr};     // atlas page or standalone texture, null if missing
+    Rectangle region{0, 0, 0, 0};    // where the image sits in *texture, pixels
+    float scale{1.0f};               // texture pixels per source image pixel, below 1 when baked smaller
+    uint32_t generation{0};          // 0: never resolved
+};
@@ -8,7 +8,9 @@
 #pragma once
 
 #include "Events/Command.hpp"
+#include "Events/TypedCommand.hpp"
 #include <functional>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -18,6 +20,7 @@ class CommandDispatcher {
     public:
         using HandlerId = size_t;
 
+        // String-keyed commands (scripting/tools)
         HandlerId register_handler(const std::string& command_name, CommandHandler handler);
         void unregister_handler(HandlerId id);
 
@@ -26,6 +29,45 @@ class CommandDispatcher {
         void clear_all();
         size_t get_handler_count(const std::string& command_name) const;
 
+        // Typed commands: one handler per command type, replaces any previous one
+        template<typename C>
+        HandlerId register_handler(std::function<typename C::Reply(const C&)> handler) {
+            static_assert(is_typed_command<C>::value, "typed commands must declare a Reply type");
+            CommandId cid = command_id<C>();
+            if (cid >= typed_handlers_.size()) {
+                typed_handlers_.resize(cid + 1);
+            }
+            HandlerId id = next_id_++;
+            typed_handlers_[cid] = {id, [h = std::move(handler)](const void* cmd, void* out) {
+                using Reply = typename C::Reply;
+                static_cast<std::optional<Reply>*>(out)->emplace(h(*static_cast<const C*>(cmd)));
+            }};
+            return id;
+        }
+
+        // Returns std::nullopt if no handler is registered or the handler threw
+        template<typename C>
+        std::optional<typename C::Reply> dispatch(const C& command) {
+            std::optional<typename C::Reply> reply;
+            CommandId cid = command_id<C>();
+            if (cid >= typed_handlers_.size() || !typed_handlers_[cid].invoke) {
+                return reply;
+            }
+            try {
+                typed_handlers_[cid].invoke(&command, &reply);
+            } catch (const std::exception& e) {
+                report_typed_error(e);
+                reply.reset();
+            }
+            return reply;
+        }
+
+        template<typename C>
+        size_t get_handler_count() const {
+            CommandId cid = command_id<C>();
+            return (cid < typed_handlers_.size() && typed_handlers_[cid].invoke) ? 1 : 0;
+        }
+
     private:
         struct Handler {
             HandlerId id;
@@ -33,6 +75,14 @@ class CommandDispatcher {
             CommandHandler handler;
         };
 
+        struct TypedHandler {
+            HandlerId id{0};
+            std::function<void(const void*, void*)> invoke;
+        };
+
+        void report_typed_error(const std::exception& e) const;
+
         std::unordered_map<std::string, std::vector<Handler>> handlers_;
-        HandlerId next_id_;
+        std::vector<TypedHandler> typed_handlers_;
+        HandlerId next_id_{0};
 };
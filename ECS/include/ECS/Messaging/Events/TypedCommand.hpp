@@ -0,0 +1,42 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TypedCommand - Compile-time typed request/reply commands
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <typeindex>
+#include <type_traits>
+
+// A typed command is a plain struct that names its reply type:
+//
+//     struct GetPlayerHealth {
+//         using Reply = int;
+//         size_t player_id;
+//     };
+//
+// The dispatcher routes it through a dense integer id instead of hashing a
+// name, and the handler returns the reply by value.
+using CommandId = std::size_t;
+
+// Assigns (once per type) the next dense id. Resolved inside libECS and keyed
+// on the type_index, whose equality is what the ABI says "same type" means:
+// plugins loaded from different shared objects agree on ids, while types in
+// anonymous namespaces of different files stay distinct even when their
+// names match.
+CommandId resolve_command_id(std::type_index type);
+
+template<typename C>
+CommandId command_id() {
+    static const CommandId id = resolve_command_id(std::type_index(typeid(C)));
+    return id;
+}
+
+template<typename C, typename = void>
+struct is_typed_command : std::false_type {};
+
+template<typename C>
+struct is_typed_command<C, std::void_t<typename C::Reply>> : std::true_type {};
@@ -12,6 +12,7 @@
 #include "EventBus.hpp"
 #include "CommandDispatcher.hpp"
 #include "MessageQueue.hpp"
+#include "ThreadEventQueue.hpp"
 
 class MessagingManager {
     public:
@@ -28,7 +29,12 @@ class MessagingManager {
     CommandDispatcher& get_command_dispatcher() { return command_dispatcher_; }
 
     // MESSAGE QUEUE: Thread-safe async message passing
-    MessageQueue& get_message_queue() { return message_queue_; }        void clear_all();
+    MessageQueue& get_message_queue() { return message_queue_; }
+
+    // THREAD EVENTS: post from any thread, delivered on the main thread in update()
+    ThreadEventQueue& get_thread_events() { return thread_events_; }
+
+    void clear_all();
 
     private:
         MessagingManager() = default;
@@ -39,4 +45,5 @@ class MessagingManager {
     EventBus event_bus_;
     CommandDispatcher command_dispatcher_;
     MessageQueue message_queue_;
+    ThreadEventQueue thread_events_;
 };
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ThreadEventQueue - Lock-free cross-thread event delivery to the main thread
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Event written by a producer thread. The payload lives inline in the ring
+// slot, so posting never allocates.
+struct ThreadEvent {
+    static constexpr size_t PAYLOAD_CAPACITY = 512;
+
+    uint32_t channel;
+    uint32_t size;
+    alignas(std::max_align_t) char payload[PAYLOAD_CAPACITY];
+};
+
+// Single-producer / single-consumer ring of ThreadEvent slots.
+class ThreadEventRing {
+    public:
+        static constexpr size_t CAPACITY = 512; // power of two
+
+        ThreadEventRing() : slots_(new ThreadEvent[CAPACITY]) {}
+
+        bool try_push(uint32_t channel, const void* data, size_t size);
+
+        // Calls fn(const ThreadEvent&) for every pending event, in post order
+        template<typename Fn>
+        size_t drain(Fn&& fn) {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            size_t head = head_.load(std::memory_order_acquire);
+            size_t count = 0;
+            while (tail != head) {
+                fn(slots_[tail & (CAPACITY - 1)]);
+                ++tail;
+                ++count;
+                tail_.store(tail, std::memory_order_release);
+            }
+            return count;
+        }
+
+        // Producer thread ownership. A ring is claimed by one thread at a
+        // time; the owner releases it when it exits, and the consumer hands
+        // it back once everything the owner posted has been drained.
+        bool claim() {
+            uint8_t free = FREE;
+            return owner_.compare_exchange_strong(free, CLAIMED, std::memory_order_acq_rel);
+        }
+        void release() { owner_.store(RELEASED, std::memory_order_release); }
+        bool is_released() const { return owner_.load(std::memory_order_acquire) == RELEASED; }
+        void recycle() { owner_.store(FREE, std::memory_order_release); }
+
+    private:
+        enum : uint8_t { FREE, CLAIMED, RELEASED };
+
+        std::unique_ptr<ThreadEvent[]> slots_;
+        std::atomic<uint8_t> owner_{CLAIMED};
+        alignas(64) std::atomic<size_t> head_{0}; // written by producer
+        alignas(64) std::atomic<size_t> tail_{0}; // written by consumer
+};
+
+// Any thread may post(); subscribe()/dispatch() belong to the main thread and
+// subscriptions must not change from inside a callback.
+// Each producer thread gets its own ring, so order is preserved per producer
+// but not across producers. A ring goes back to the pool once its thread has
+// exited and dispatch() or discard_pending() has drained it, so threads that
+// come and go (one per connection) never use up the MAX_PRODUCERS slots.
+class ThreadEventQueue {
+    public:
+        using ChannelCallback = std::function<void(const char* data, size_t size)>;
+        using CallbackId = size_t;
+
+        static constexpr size_t MAX_PRODUCERS = 16;
+
+        ThreadEventQueue();
+        ~ThreadEventQueue() = default;
+        ThreadEventQueue(const ThreadEventQueue&) = delete;
+        ThreadEventQueue& operator=(const ThreadEventQueue&) = delete;
+
+        // Thread-safe. Returns false if the payload is too large or the
+        // producer's ring is full (the event is dropped and counted).
+        bool post(uint32_t channel, const void* data, size_t size);
+
+        template<typename T>
+        bool post(uint32_t channel, const T& value) {
+            static_assert(std::is_trivially_copyable<T>::value, "posted payloads must be trivially copyable");
+            return post(channel, &value, sizeof(T));
+        }
+
+        CallbackId subscribe(uint32_t channel, ChannelCallback callback);
+        void unsubscribe(CallbackId id);
+
+        // Main thread: deliver every pending event to its subscribers
+        size_t dispatch();
+        // Main thread: drop every pending event without delivering it
+        void discard_pending();
+        void clear_all();
+
+        size_t get_subscriber_count(uint32_t channel) const;
+        // Rings created so far, reused ones counted once
+        size_t get_producer_count() const { return producer_count_.load(std::memory_order_acquire); }
+        size_t get_dropped_count() const { return dropped_.load(std::memory_order_relaxed); }
+
+    private:
+        struct Subscription {
+            CallbackId id;
+            ChannelCallback callback;
+        };
+
+        ThreadEventRing* producer_ring();
+
+        const uint64_t serial_;
+        std::mutex producers_mutex_;
+        std::array<std::shared_ptr<ThreadEventRing>, MAX_PRODUCERS> producers_;
+        std::atomic<size_t> producer_count_{0};
+        std::atomic<size_t> dropped_{0};
+
+        std::unordered_map<uint32_t, std::vector<Subscription>> subscribers_;
+        CallbackId next_id_{0};
+};
@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** BatchCollisionDetector - SoA batch narrow-phase (AVX / SSE2 / scalar)
+*/
+
+#pragma once
+
+#include "ECS/Physics/Collision/CollisionDetector.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Candidate pairs stored as one array per field, so the tests below can load
+// 4 (SSE2) or 8 (AVX) pairs per instruction.
+struct AABBPairBatch {
+    std::vector<float> ax, ay, aw, ah;
+    std::vector<float> bx, by, bw, bh;
+
+    void reserve(size_t count);
+    void clear();
+    void push(const AABB& a, const AABB& b);
+    size_t size() const { return ax.size(); }
+};
+
+struct CirclePairBatch {
+    std::vector<float> ax, ay, ar;
+    std::vector<float> bx, by, br;
+
+    void reserve(size_t count);
+    void clear();
+    void push(Vector2 center_a, float radius_a, Vector2 center_b, float radius_b);
+    size_t size() const { return ax.size(); }
+};
+
+struct CircleAABBPairBatch {
+    std::vector<float> cx, cy, r;
+    std::vector<float> bx, by, bw, bh;
+
+    void reserve(size_t count);
+    void clear();
+    void push(Vector2 center, float radius, const AABB& box);
+    size_t size() const { return cx.size(); }
+};
+
+// Each test writes the indices of the hitting pairs, in ascending order, into
+// hits (cleared first) and returns how many there are. Results match the
+// scalar CollisionDetector tests: edges touching count as a hit.
+class BatchCollisionDetector {
+    public:
+        static size_t test_aabb(const AABBPairBatch& batch, std::vector<uint32_t>& hits);
+        static size_t test_circle(const CirclePairBatch& batch, std::vector<uint32_t>& hits);
+        static size_t test_circle_aabb(const CircleAABBPairBatch& batch, std::vector<uint32_t>& hits);
+
+        // Portable reference paths, also used for the tail of each batch
+        static size_t test_aabb_scalar(const AABBPairBatch& batch, std::vector<uint32_t>& hits);
+        static size_t test_circle_scalar(const CirclePairBatch& batch, std::vector<uint32_t>& hits);
+        static size_t test_circle_aabb_scalar(const CircleAABBPairBatch& batch, std::vector<uint32_t>& hits);
+
+        // "AVX", "SSE2" or "scalar", fixed at compile time
+        static const char* get_backend();
+};
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <raylib.h>
+#include <cstdint>
 
 struct AABB {
     float x, y;
@@ -16,16 +17,46 @@ struct AABB {
     AABB() : x(0), y(0), width(0), height(0) {}
     AABB(float x, float y, float w, float h) : x(x), y(y), width(w), height(h) {}
 
+    bool operator==(const AABB& other) const {
+        return x == other.x && y == other.y && width == other.width && height == other.height;
+    }
+    bool operator!=(const AABB& other) const { return !(*this == other); }
+
     bool intersects(const AABB& other) const;
     bool contains(float px, float py) const;
     Vector2 get_center() const;
 };
 
+// Broadphase layer filtering: a pair is kept only when each side's layer is
+// in the other's mask. The default is in every layer and accepts everything.
+struct CollisionFilter {
+    static constexpr uint32_t ALL = 0xFFFFFFFFu;
+
+    uint32_t layer{ALL};
+    uint32_t mask{ALL};
+
+    CollisionFilter() = default;
+    CollisionFilter(uint32_t l, uint32_t m) : layer(l), mask(m) {}
+
+    bool accepts(const CollisionFilter& other) const {
+        return (layer & other.mask) != 0 && (other.layer & mask) != 0;
+    }
+    bool operator==(const CollisionFilter& other) const {
+        return layer == other.layer && mask == other.mask;
+    }
+    bool operator!=(const CollisionFilter& other) const { return !(*this == other); }
+};
+
 class CollisionDetector {
     public:
         static bool check_aabb(const AABB& a, const AABB& b);
         static bool check_circle(Vector2 center1, float radius1,
                                 Vector2 center2, float radius2);
+        static bool check_circle_aabb(Vector2 center, float radius, const AABB& box);
+        // Circle moving from -> to over one tick. On a hit, toi is the fraction
+        // of the move (0..1) at first contact, 0 if it already overlaps at from.
+        static bool sweep_circle_aabb(Vector2 from, Vector2 to, float radius,
+                                      const AABB& box, float& toi);
         static bool check_point_in_rect(Vector2 point, Rectangle rect);
         static bool check_rect_overlap(Rectangle rect1, Rectangle rect2);
 };
@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Broadphase Interface
+*/
+
+#pragma once
+
+#include "ECS/Physics/Collision/CollisionDetector.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Structure PhysicsManager routes update/query/pair calls to
+class IBroadphase {
+public:
+    virtual ~IBroadphase() = default;
+
+    virtual void clear() = 0;
+    virtual void insert(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) = 0;
+    virtual void remove(size_t entity_id) = 0;
+    // Moves an entity already inserted. Returns true if it had to be
+    // re-bucketed, false if its cells were unchanged and only its bounds were
+    // refreshed in place.
+    virtual bool update(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) {
+        insert(entity_id, bounds, filter);
+        return true;
+    }
+
+    virtual std::vector<size_t> query(const AABB& bounds) const = 0;
+    // Each pair once, (lower id, higher id); out is cleared and reused
+    virtual void get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const = 0;
+
+    virtual size_t get_entity_count() const = 0;
+    virtual const char* get_name() const = 0;
+};
+
+enum class BroadphaseType {
+    SPATIAL_HASH,
+    UNIFORM_GRID,
+    SWEEP_AND_PRUNE,
+    CUSTOM
+};
@@ -9,31 +9,107 @@
 
 #include "Collision/CollisionDetector.hpp"
 #include "SpatialHash/SpatialHash.hpp"
+#include "UniformGrid/UniformGrid.hpp"
+#include "SweepAndPrune/SweepAndPrune.hpp"
+#include <memory>
 
+// Per-tick broadphase maintenance counts (see PhysicsManager::begin_frame)
+struct BroadphaseUpdateStats {
+    size_t rebucketed{0};    // moved across cells, or new
+    size_t moved_in_place{0}; // moved, same cells: bounds refreshed only
+    size_t unchanged{0};     // same bounds and filter, broadphase untouched
+    size_t removed{0};       // not updated this tick, dropped at end_frame
+};
+
+// One physics world. Game code uses the one owned by its registry
+// (registry::get_physics()); instance() is a process-wide world for tools
+// and tests that run a single world.
 class PhysicsManager {
     public:
+        PhysicsManager() : spatial_hash_(64.0f), broadphase_(&spatial_hash_) {}
+        ~PhysicsManager() = default;
+        PhysicsManager(const PhysicsManager&) = delete;
+        PhysicsManager& operator=(const PhysicsManager&) = delete;
+
         static PhysicsManager& instance();
 
         void init(float cell_size = 64.0f);
+        // Bounded playfield: switches the broadphase to the flat UniformGrid
+        void init(float cell_size, const AABB& world_bounds);
+        // cell_size/world_bounds are ignored by backends that don't use them
+        void init(BroadphaseType type, float cell_size = 64.0f,
+                  const AABB& world_bounds = AABB(0, 0, 1920, 1080));
+        // Plugs a user-provided backend (BroadphaseType::CUSTOM)
+        void set_broadphase(std::unique_ptr<IBroadphase> broadphase);
         void clear();
 
+        // Incremental ticks: begin_frame(), update_entity() for every live
+        // collider, end_frame(). Only entities whose bounds changed reach the
+        // broadphase, and only those whose cells changed are re-bucketed;
+        // entities not updated since begin_frame() are removed at end_frame().
+        void begin_frame();
+        void end_frame();
+        const BroadphaseUpdateStats& get_update_stats() const { return stats_; }
+
     SpatialHash& get_spatial_hash() { return spatial_hash_; }
     const SpatialHash& get_spatial_hash() const { return spatial_hash_; }
+    UniformGrid& get_uniform_grid() { return uniform_grid_; }
+    const UniformGrid& get_uniform_grid() const { return uniform_grid_; }
+    SweepAndPrune& get_sweep_and_prune() { return sweep_and_prune_; }
+    const SweepAndPrune& get_sweep_and_prune() const { return sweep_and_prune_; }
+    IBroadphase& get_broadphase() { return *broadphase_; }
+    const IBroadphase& get_broadphase() const { return *broadphase_; }
+    BroadphaseType get_broadphase_type() const { return broadphase_type_; }
 
-        void update_entity(size_t entity_id, const AABB& bounds);
+        void update_entity(size_t entity_id, const AABB& bounds, CollisionFilter filter = {});
         void remove_entity(size_t entity_id);
 
         std::vector<size_t> query_area(const AABB& bounds) const;
         std::vector<std::pair<size_t, size_t>> get_collision_pairs() const;
+        void get_collision_pairs(std::vector<std::pair<size_t, size_t>>& out) const;
+        // Per-layer-pair contact lists, rebuilt once per tick by the collision
+        // system. Tracking is kept across init()/clear(); contacts are not.
+        void track_contacts(uint32_t layer_a, uint32_t layer_b);
+        void begin_contacts();
+        void add_contact(size_t entity_a, uint32_t layer_a, size_t entity_b, uint32_t layer_b);
+        // (entity in layer_a, entity in layer_b); empty if the pair isn't tracked
+        const std::vector<std::pair<size_t, size_t>>& get_contacts(uint32_t layer_a, uint32_t layer_b) const;
+
         bool check_collision(const AABB& a, const AABB& b) const;
         bool check_collision_circle(Vector2 center1, float radius1,
                                     Vector2 center2, float radius2) const;
 
     private:
-        PhysicsManager() : spatial_hash_(64.0f) {}
-        ~PhysicsManager() = default;
-        PhysicsManager(const PhysicsManager&) = delete;
-        PhysicsManager& operator=(const PhysicsManager&) = delete;
+        struct Proxy {
+            AABB bounds;
+            CollisionFilter filter;
+            uint32_t last_frame{0};
+            uint32_t live_index{NOT_LIVE};
+        };
+
+        static constexpr uint32_t NOT_LIVE = 0xFFFFFFFFu;
+
+        void reset_proxies();
+
+        struct ContactList {
+            uint32_t layer_a;
+            uint32_t layer_b;
+            std::vector<std::pair<size_t, size_t>> contacts;
+        };
 
         SpatialHash spatial_hash_;
+        UniformGrid uniform_grid_;
+        SweepAndPrune sweep_and_prune_;
+        std::unique_ptr<IBroadphase> custom_broadphase_;
+
+        std::vector<ContactList> contact_lists_;
+
+        // Last bounds handed to the broadphase, by entity id
+        std::vector<Proxy> proxies_;
+        std::vector<size_t> live_;
+        uint32_t frame_{0};
+        BroadphaseUpdateStats stats_;
+
+        IBroadphase* broadphase_;
+        BroadphaseType broadphase_type_{BroadphaseType::SPATIAL_HASH};
 };
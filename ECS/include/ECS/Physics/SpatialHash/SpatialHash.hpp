@@ -7,25 +7,28 @@
 
 #pragma once
 
-#include "ECS/Physics/Collision/CollisionDetector.hpp"
+#include "ECS/Physics/IBroadphase.hpp"
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <functional>
 
-class SpatialHash {
+class SpatialHash : public IBroadphase {
     public:
         SpatialHash(float cell_size = 64.0f);
 
-        void clear();
-        void insert(size_t entity_id, const AABB& bounds);
-        void remove(size_t entity_id);
+        void clear() override;
+        void insert(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) override;
+        void remove(size_t entity_id) override;
+        bool update(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) override;
 
-        std::vector<size_t> query(const AABB& bounds) const;
+        std::vector<size_t> query(const AABB& bounds) const override;
         std::vector<std::pair<size_t, size_t>> get_potential_collisions() const;
+        void get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const override;
         void set_cell_size(float size) { cell_size_ = size; }
         float get_cell_size() const { return cell_size_; }
-        size_t get_entity_count() const { return entity_bounds_.size(); }
+        size_t get_entity_count() const override { return entities_.size(); }
+        const char* get_name() const override { return "SpatialHash"; }
 
     private:
         struct CellCoord {
@@ -42,10 +45,21 @@ class SpatialHash {
             }
         };
 
+        // Stored inline in each cell so pairing never looks entities up
+        struct CellEntry {
+            size_t id;
+            CellCoord min_cell;
+            CollisionFilter filter;
+        };
+
+        struct EntityRecord {
+            AABB bounds;
+            CollisionFilter filter;
+        };
+
         CellCoord get_cell(float x, float y) const;
-        std::vector<CellCoord> get_cells(const AABB& bounds) const;
 
     float cell_size_;
-    std::unordered_map<CellCoord, std::unordered_set<size_t>, CellCoordHash> grid_;
-    std::unordered_map<size_t, AABB> entity_bounds_;
-};
\ No newline at end of file
+    std::unordered_map<CellCoord, std::vector<CellEntry>, CellCoordHash> grid_;
+    std::unordered_map<size_t, EntityRecord> entities_;
+};
@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** SweepAndPrune - Incremental sort-and-sweep broadphase on the x axis
+*/
+
+#pragma once
+
+#include "ECS/Physics/IBroadphase.hpp"
+#include <cstdint>
+
+// Keeps entities ordered by min x across ticks and re-sorts with insertion
+// sort, which is close to linear while most entities only drift horizontally.
+// The order survives clear(), so the clear + reinsert tick pattern of the
+// collision system keeps its coherence.
+class SweepAndPrune : public IBroadphase {
+    public:
+        SweepAndPrune() = default;
+
+        void reserve(size_t entity_count);
+
+        void clear() override;
+        void insert(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) override;
+        void remove(size_t entity_id) override;
+
+        std::vector<size_t> query(const AABB& bounds) const override;
+        std::vector<std::pair<size_t, size_t>> get_potential_collisions() const;
+        void get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const override;
+
+        size_t get_entity_count() const override { return entries_.size(); }
+        const char* get_name() const override { return "SweepAndPrune"; }
+
+        // Element moves done by the last re-sort, a measure of frame coherence
+        size_t get_last_sort_swaps() const { return last_sort_swaps_; }
+
+    private:
+        struct Entry {
+            size_t id;
+            float min_x, max_x;
+            float min_y, max_y;
+            CollisionFilter filter;
+        };
+
+        static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+        void sort() const;
+
+        std::vector<Entry> entries_;
+        std::vector<uint32_t> slot_of_;   // entity id -> index in entries_
+
+        // Entity ids in min x order from the previous sort
+        mutable std::vector<size_t> order_;
+        mutable std::vector<uint32_t> sorted_;      // entry indices, by min x
+        mutable std::vector<uint8_t> placed_;
+        mutable bool dirty_{true};
+        mutable size_t last_sort_swaps_{0};
+};
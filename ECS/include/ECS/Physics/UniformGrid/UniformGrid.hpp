@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** UniformGrid - Flat, preallocated broadphase for a bounded playfield
+*/
+
+#pragma once
+
+#include "ECS/Physics/IBroadphase.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Entities are counting-sorted into a fixed cols x rows grid covering the
+// world bounds. Cells are contiguous ranges of one flat index array, so a
+// rebuild is two linear passes and allocates nothing once capacity is reached.
+// Bounds outside the world are clamped into the border cells.
+class UniformGrid : public IBroadphase {
+    public:
+        UniformGrid(float cell_size = 64.0f, const AABB& world_bounds = AABB(0, 0, 1920, 1080));
+
+        // Reallocates the cell arrays; call at init, not per tick
+        void configure(float cell_size, const AABB& world_bounds);
+        void reserve(size_t entity_count);
+
+        void clear() override;
+        void insert(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) override;
+        void remove(size_t entity_id) override;
+        bool update(size_t entity_id, const AABB& bounds, CollisionFilter filter = {}) override;
+
+        std::vector<size_t> query(const AABB& bounds) const override;
+        void query(const AABB& bounds, std::vector<size_t>& out) const;
+        std::vector<std::pair<size_t, size_t>> get_potential_collisions() const;
+        void get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const override;
+
+        float get_cell_size() const { return cell_size_; }
+        const AABB& get_world_bounds() const { return world_bounds_; }
+        int get_columns() const { return cols_; }
+        int get_rows() const { return rows_; }
+        size_t get_entity_count() const override { return entries_.size(); }
+        const char* get_name() const override { return "UniformGrid"; }
+
+    private:
+        struct Entry {
+            size_t id;
+            AABB bounds;
+            int min_cx, min_cy, max_cx, max_cy;
+            CollisionFilter filter;
+        };
+
+        static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+        int cell_x(float x) const;
+        int cell_y(float y) const;
+        void build() const;
+
+        float cell_size_;
+        float inv_cell_size_;
+        AABB world_bounds_;
+        int cols_;
+        int rows_;
+
+        std::vector<Entry> entries_;
+        std::vector<uint32_t> slot_of_;   // entity id -> index in entries_
+
+        // Rebuilt lazily from entries_ by counting sort
+        mutable bool dirty_{true};
+        mutable std::vector<uint32_t> cell_start_;  // cols*rows + 1 offsets
+        mutable std::vector<uint32_t> cell_fill_;   // per-cell write cursor
+        mutable std::vector<uint32_t> cell_items_;  // entry indices, grouped by cell
+        mutable std::vector<uint32_t> query_stamp_; // per entry, dedups query results
+        mutable uint32_t query_id_{0};
+};
@@ -13,6 +13,9 @@
 #include "SparseSet.hpp"
 #include "Entity.hpp"
 
+class PhysicsManager;
+class ParticlePool;
+
 // Registry that stores one sparse_set<Component> per component type using std::any.
 // Also responsible for managing entities (spawn/kill) and for adding/removing components.
 class registry {
@@ -142,6 +145,17 @@ class registry {
         entity entity_from_index(std::size_t idx) const;
         void kill_entity(entity const& e);
 
+        // Physics world of this registry (broadphase, contact lists), created
+        // on first use. Each registry has its own, so game instances running
+        // on separate threads never share collision state.
+        PhysicsManager& get_physics();
+
+        // Effects particles (death sparks) of this registry, for the same
+        // reason. get_effects() creates the pool: the particle system calls it,
+        // so find_effects() stays null in a registry nothing draws (headless).
+        ParticlePool& get_effects();
+        ParticlePool* find_effects() { return _effects.get(); }
+
         // Random seed management for deterministic gameplay
         void set_random_seed(unsigned int seed);
         unsigned int get_random_seed() const;
@@ -153,6 +167,8 @@ class registry {
         std::vector<std::function<void(registry&)>> _systems;
         std::vector<std::size_t> _free_ids;
         std::size_t _next_id{0};
+        std::unique_ptr<PhysicsManager> _physics;
+        std::unique_ptr<ParticlePool> _effects;
         
         // Random seed for deterministic gameplay (server-controlled in multiplayer)
         unsigned int _random_seed{0};
@@ -8,40 +8,87 @@
 #pragma once
 
 #include <raylib.h>
+#include <cstdint>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
 struct SpriteDrawCall {
-    Texture2D texture;  // Store by value, not pointer!
+    unsigned int texture_id;  // GL id only, the batch never owns textures
+    int texture_width;
+    int texture_height;
     Rectangle source;
     Rectangle dest;
     Vector2 origin;
     float rotation;
     Color tint;
     int layer;
+    int blend;
 
-    SpriteDrawCall(Texture2D tex, Rectangle src, Rectangle dst,
-                   Vector2 org, float rot, Color t, int l = 0)
-        : texture(tex), source(src), dest(dst), origin(org),
-          rotation(rot), tint(t), layer(l) {}
+    SpriteDrawCall(const Texture2D& tex, Rectangle src, Rectangle dst,
+                   Vector2 org, float rot, Color t, int l = 0, int b = BLEND_ALPHA)
+        : texture_id(tex.id), texture_width(tex.width), texture_height(tex.height),
+          source(src), dest(dst), origin(org), rotation(rot), tint(t), layer(l), blend(b) {}
+
+    // (layer, texture, blend): sprites sharing a texture and blend mode within
+    // a layer end up adjacent and are submitted as one draw
+    uint64_t sort_key() const {
+        uint64_t biased_layer = static_cast<uint16_t>(layer + 0x8000);
+        return (biased_layer << 48) |
+               (static_cast<uint64_t>(texture_id) << 8) |
+               static_cast<uint8_t>(blend);
+    }
+};
+
+struct SpriteVertex {
+    float x, y;
+    float u, v;
+    Color color;
 };
 
+// Queues sprites between begin() and end(), then flush() turns them into
+// quads in one vertex buffer and submits each run of equal texture and blend
+// mode through rlgl as a single draw.
 class SpriteBatch {
     public:
         SpriteBatch() : sort_by_layer_(false), is_begun_(false) {}
 
         void begin();
         void draw(Texture2D* texture, Rectangle source, Rectangle dest,
-                Vector2 origin, float rotation, Color tint, int layer = 0);
+                Vector2 origin, float rotation, Color tint, int layer = 0,
+                int blend = BLEND_ALPHA);
         void draw(Texture2D* texture, Vector2 position, Color tint, int layer = 0);
         void end();
         void flush();
 
+        // Sorts by (layer, texture, blend) so texture switches are minimal;
+        // submission order is kept among equal keys. When off, only adjacent
+        // sprites with the same texture and blend share a draw.
         void set_sort_by_layer(bool sort) { sort_by_layer_ = sort; }
+        // Sprites queued since begin() or the last flush()
         size_t get_draw_call_count() const { return draw_calls_.size(); }
+        // rlgl draws issued by flush() since the last begin()
+        size_t get_gpu_draw_call_count() const { return gpu_draw_calls_; }
+
+        // Sends quad_count quads (4 vertices each, in rlgl's winding: top-left,
+        // bottom-left, bottom-right, top-right) with one texture through rlgl,
+        // split into chunks that fit its batch buffer. With draw set each chunk
+        // is drawn right away; otherwise rlgl may merge it with what follows.
+        // Returns the number of chunks. The caller sets the blend mode.
+        static size_t emit_quads(unsigned int texture_id, const SpriteVertex* vertices, size_t quad_count,
+                                 bool draw = true);
 
     private:
+        void prepare();
+        void build_vertices();
+        void submit_run(unsigned int texture_id, int blend, size_t first_quad, size_t quad_count);
+
         std::vector<SpriteDrawCall> draw_calls_;
+        std::vector<uint32_t> order_;         // draw call indices in submission order
+        std::vector<std::pair<uint64_t, uint32_t>> sort_keys_;
+        std::vector<SpriteVertex> vertices_;  // 4 per sprite, in order_
         bool sort_by_layer_;
         bool is_begun_;
+        bool prepared_{false};
+        size_t gpu_draw_calls_{0};
 };
@@ -31,6 +31,9 @@ public:
     Vector2 screen_to_world(Vector2 screen_pos) const;
     Vector2 world_to_screen(Vector2 world_pos) const;
 
+    // World-space area shown on a screen_width x screen_height viewport
+    Rectangle get_view_rect(float screen_width, float screen_height) const;
+
 private:
     Vector2 offset_;
     Vector2 target_;
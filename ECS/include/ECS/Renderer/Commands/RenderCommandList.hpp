@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** RenderCommandList - Draw commands recorded off the main thread
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class RenderCommandType : uint8_t {
+    SPRITE,
+    RECTANGLE,
+    RECTANGLE_LINES,
+    CIRCLE,
+    TEXT
+};
+
+struct RenderCommand {
+    RenderCommandType type;
+    int layer;
+    int blend;          // SPRITE
+    Color color;        // fill color, or tint for sprites and text
+    Rectangle dest;     // SPRITE/RECTANGLE*: destination; CIRCLE and TEXT: x, y only
+    Rectangle source;   // SPRITE
+    Vector2 origin;     // SPRITE
+    float param;        // SPRITE rotation, RECTANGLE_LINES thickness, CIRCLE radius, TEXT font size
+    float spacing;      // TEXT
+    Texture2D texture;  // SPRITE
+    uint32_t text;      // TEXT: offset in the list's text buffer
+    uint32_t font;      // TEXT: index in the list's fonts
+};
+
+// Plain recording, no raylib calls: safe to fill from any thread as long as
+// each thread has its own list. RenderQueue merges and draws them.
+class RenderCommandList {
+    public:
+        void draw_sprite(const Texture2D& texture, Rectangle source, Rectangle dest, Vector2 origin,
+                         float rotation, Color tint, int layer = 0, int blend = BLEND_ALPHA);
+        void draw_rectangle(Rectangle rec, Color color, int layer = 0);
+        void draw_rectangle_lines(Rectangle rec, float thickness, Color color, int layer = 0);
+        void draw_circle(Vector2 center, float radius, Color color, int layer = 0);
+        void draw_text(const Font& font, const std::string& text, Vector2 position, float font_size,
+                       float spacing, Color tint, int layer = 0);
+
+        void clear();
+
+        const std::vector<RenderCommand>& commands() const { return commands_; }
+        size_t size() const { return commands_.size(); }
+        bool empty() const { return commands_.empty(); }
+
+        const char* text_of(const RenderCommand& command) const { return text_.data() + command.text; }
+        const Font& font_of(const RenderCommand& command) const { return fonts_[command.font]; }
+
+    private:
+        RenderCommand& push(RenderCommandType type, int layer, Color color);
+
+        std::vector<RenderCommand> commands_;
+        std::vector<char> text_;    // null-terminated strings back to back
+        std::vector<Font> fonts_;
+};
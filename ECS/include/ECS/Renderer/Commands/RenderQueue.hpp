@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** RenderQueue - Parallel command recording, single-threaded submit
+*/
+
+#pragma once
+
+#include "RenderCommandList.hpp"
+#include "ECS/Renderer/Batch/SpriteBatch.hpp"
+#include "ECS/Renderer/Text/TextLayoutCache.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Render systems record into command lists, in parallel when they have many
+// entities; submit() then merges the lists on the main thread and is the only
+// place that talks to raylib. Lists are kept in recording order and merged by
+// layer, so within a layer the output order does not depend on thread timing.
+class RenderQueue {
+    public:
+        // 0 workers: everything is recorded on the calling thread
+        explicit RenderQueue(size_t worker_count = default_worker_count());
+        ~RenderQueue();
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue& operator=(const RenderQueue&) = delete;
+
+        static size_t default_worker_count();
+
+        // List for serial recording on the main thread
+        RenderCommandList& list();
+
+        // Splits [0, count) into chunks recorded in parallel, each into its own
+        // list: fn(first, last, list). fn must only write to its own range and
+        // must not call raylib. Returns once every chunk is recorded.
+        template <typename Fn>
+        void record(size_t count, Fn&& fn, size_t min_chunk = 256) {
+            if (count == 0) return;
+            min_chunk = std::max<size_t>(min_chunk, 1);
+            size_t chunks = std::min(workers_count_ + 1, (count + min_chunk - 1) / min_chunk);
+            size_t per_chunk = (count + chunks - 1) / chunks;
+            size_t first_list = open_lists(chunks);
+
+            run(chunks, [&](size_t chunk) {
+                size_t first = chunk * per_chunk;
+                size_t last = std::min(count, first + per_chunk);
+                if (first < last) fn(first, last, *lists_[first_list + chunk]);
+            });
+        }
+
+        // Merged draw order: by layer, then recording order
+        void merge(std::vector<std::pair<const RenderCommandList*, const RenderCommand*>>& out) const;
+        // Main thread only: draws every recorded command and empties the lists.
+        // Sprites go through batch, and so does text when a layout cache is
+        // given; other commands flush it first to keep order.
+        void submit(SpriteBatch& batch, TextLayoutCache* text = nullptr);
+        void clear();
+
+        size_t get_worker_count() const { return workers_count_; }
+        size_t get_command_count() const;
+        size_t get_last_submit_count() const { return last_submit_count_; }
+
+    private:
+        size_t open_lists(size_t count);
+        void run(size_t jobs, const std::function<void(size_t)>& job);
+        void start_workers();
+        void worker_loop();
+        void drain();
+
+        std::vector<std::unique_ptr<RenderCommandList>> lists_;
+        std::vector<bool> serial_;     // per list: main-thread list or a parallel chunk
+        size_t used_{0};
+        std::vector<std::pair<const RenderCommandList*, const RenderCommand*>> merged_;
+        size_t last_submit_count_{0};
+
+        // Worker pool, started on the first parallel record()
+        size_t workers_count_;
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        const std::function<void(size_t)>* job_{nullptr};
+        size_t job_count_{0};
+        std::atomic<size_t> next_job_{0};
+        std::atomic<size_t> pending_{0};
+        size_t active_{0};
+        uint64_t batch_{0};
+        bool stop_{false};
+        std::exception_ptr error_;
+};
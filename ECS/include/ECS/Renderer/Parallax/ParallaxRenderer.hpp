@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParallaxRenderer - Cached tiles for parallax_layer, drawn as one quad each
+*/
+
+#pragma once
+
+#include "ECS/Components/Parallax.hpp"
+#include "ECS/Renderer/Batch/SpriteBatch.hpp"
+#include <raylib.h>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+// Owns one render texture per layer entity. A tile is painted when first seen,
+// when its layer asks for a repaint, or when a screen-sized tile no longer
+// matches the screen. Drawing queues a single quad over the view whose texture
+// coordinates run past the tile: the texture repeats, so the quad tiles itself.
+// Painting needs the GL context; draw() and unload() must run on its thread.
+class ParallaxRenderer {
+    public:
+        ParallaxRenderer() = default;
+        ~ParallaxRenderer() = default;
+        ParallaxRenderer(const ParallaxRenderer&) = delete;
+        ParallaxRenderer& operator=(const ParallaxRenderer&) = delete;
+
+        // The layer's tile_width x tile_height, the screen size where those are 0
+        static void tile_size(const parallax_layer& layer, int& width, int& height);
+        // Advances the layer's drift by dt, kept within its tile
+        static void scroll(parallax_layer& layer, float dt);
+        // Part of the tile the view shows, in tile pixels: the camera scaled by
+        // depth, minus the drift, brought back within the tile
+        static Rectangle source_rect(const parallax_layer& layer, const Rectangle& view);
+
+        // Paints the tile if needed, then queues the layer covering view (world space)
+        void draw(size_t entity, parallax_layer& layer, const Rectangle& view, SpriteBatch& batch);
+
+        // Frees the tiles of entities alive() says are gone
+        void prune(const std::function<bool(size_t)>& alive);
+        // Frees every tile; needs the GL context, call before CloseWindow
+        void unload();
+
+        size_t get_tile_count() const { return tiles_.size(); }
+        // Tiles painted since construction, repaints included
+        size_t get_paint_count() const { return paint_count_; }
+
+    private:
+        void paint(parallax_layer& layer, RenderTexture2D& tile, int width, int height);
+
+        std::unordered_map<size_t, RenderTexture2D> tiles_;
+        size_t paint_count_{0};
+};
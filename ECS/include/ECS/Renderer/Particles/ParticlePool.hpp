@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParticlePool - Structure-of-arrays particle storage and update
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+struct ParticleSpawn {
+    Vector2 position{0, 0};
+    Vector2 velocity{0, 0};
+    float life{1.0f};       // seconds; PARTICLE_IMMORTAL never expires (starfields)
+    float size{2.0f};       // radius in pixels
+    Color color{WHITE};
+    float flicker{0.0f};    // brightness swing in [0, 1], 0 keeps it steady
+    bool fade{true};        // alpha goes to 0 over the life
+};
+
+inline constexpr float PARTICLE_IMMORTAL = std::numeric_limits<float>::infinity();
+
+// Particles are not entities: each field lives in its own array so update()
+// is a handful of straight loops the compiler vectorizes, and the renderer
+// reads them without touching the registry. Dead particles are swap-removed,
+// so the first size() slots are always the live ones.
+class ParticlePool {
+    public:
+        explicit ParticlePool(size_t capacity = 16384, uint32_t seed = 0x9E3779B9u);
+
+        // false when the pool is full
+        bool spawn(const ParticleSpawn& particle);
+        // count particles leaving base.position in random directions at a
+        // speed in [min_speed, max_speed]; returns how many fit in the pool
+        size_t burst(size_t count, float min_speed, float max_speed, const ParticleSpawn& base);
+
+        // Particles leaving the left edge of area come back on its right edge
+        // at a random height, for scrolling backgrounds
+        void set_wrap(Rectangle area);
+        void clear_wrap() { wrap_ = false; }
+
+        void update(float dt);
+        void clear() { count_ = 0; }
+        void seed(uint32_t seed) { rng_ = seed ? seed : 1; }
+        // Uniform in [0, 1), from the pool's own generator
+        float random01();
+
+        size_t size() const { return count_; }
+        size_t capacity() const { return x_.size(); }
+        bool empty() const { return count_ == 0; }
+
+        const float* x() const { return x_.data(); }
+        const float* y() const { return y_.data(); }
+        const float* vx() const { return vx_.data(); }
+        const float* vy() const { return vy_.data(); }
+        const float* age() const { return age_.data(); }
+        const float* life() const { return life_.data(); }
+        const float* radius() const { return size_.data(); }
+        const float* flicker() const { return flicker_.data(); }
+        const float* phase() const { return phase_.data(); }
+        const float* fade() const { return fade_.data(); }
+        const Color* color() const { return color_.data(); }
+
+    private:
+        void remove_dead();
+        void wrap();
+        void move(size_t from, size_t to);
+
+        std::vector<float> x_, y_;
+        std::vector<float> vx_, vy_;
+        std::vector<float> age_, life_;
+        std::vector<float> size_;
+        std::vector<float> flicker_, phase_;
+        std::vector<float> fade_;     // 1 fades out, 0 keeps its alpha
+        std::vector<Color> color_;
+        size_t count_{0};
+
+        Rectangle wrap_area_{0, 0, 0, 0};
+        bool wrap_{false};
+        uint32_t rng_;
+};
@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParticleRenderer - Draws a ParticlePool as textured quads in one batch
+*/
+
+#pragma once
+
+#include "ParticlePool.hpp"
+#include "ECS/Renderer/Batch/SpriteBatch.hpp"
+#include <raylib.h>
+#include <cstddef>
+#include <vector>
+
+// Every particle is a quad over the same soft round dot, so a whole pool is
+// one texture and one blend mode: a single rlgl draw, split only when it
+// exceeds rlgl's batch buffer. Must be used between BeginDrawing/EndDrawing.
+class ParticleRenderer {
+    public:
+        ParticleRenderer() = default;
+        ~ParticleRenderer() = default;
+        ParticleRenderer(const ParticleRenderer&) = delete;
+        ParticleRenderer& operator=(const ParticleRenderer&) = delete;
+
+        // time drives the flicker of particles that have one
+        void draw(const ParticlePool& pool, float time, int blend = BLEND_ALPHA);
+
+        // CPU half of draw(): fills the vertex buffer without calling rlgl
+        void build(const ParticlePool& pool, float time);
+        const std::vector<SpriteVertex>& get_vertices() const { return vertices_; }
+
+        // Frees the dot texture; needs the GL context, call before CloseWindow
+        void unload();
+
+        size_t get_last_draw_calls() const { return last_draw_calls_; }
+
+    private:
+        void ensure_texture();
+
+        std::vector<float> brightness_;
+        std::vector<float> alpha_;
+        std::vector<SpriteVertex> vertices_;
+        Texture2D dot_{};
+        size_t last_draw_calls_{0};
+};
@@ -9,7 +9,18 @@
 
 #include "Camera/Camera.hpp"
 #include "Batch/SpriteBatch.hpp"
+#include "Commands/RenderQueue.hpp"
+#include "Particles/ParticlePool.hpp"
+#include "Particles/ParticleRenderer.hpp"
+#include "Text/TextLayoutCache.hpp"
 #include <raylib.h>
+#include <cstddef>
+
+// What the render systems submitted vs skipped as off-screen, this frame
+struct CullStats {
+    size_t drawn{0};
+    size_t culled{0};
+};
 
 class RenderManager {
     public:
@@ -41,6 +52,29 @@ class RenderManager {
 
         Camera2D_ECS& get_camera() { return camera_; }
         SpriteBatch& get_batch() { return batch_; }
+        // Render systems record here (in parallel if they like); flush() and
+        // end_frame() submit it on the main thread
+        RenderQueue& get_queue() { return queue_; }
+        void flush();
+
+        // Draws a pool on top of everything submitted so far, in one batch
+        void draw_particles(const ParticlePool& pool, int blend = BLEND_ALPHA);
+        size_t get_particle_draw_calls() const { return particle_renderer_.get_last_draw_calls(); }
+
+        // Camera view in world space, refreshed by begin_frame()
+        const Rectangle& get_view_rect() const { return view_rect_; }
+        void update_view_rect();
+        bool is_visible(const Rectangle& bounds) const {
+            return bounds.x < view_rect_.x + view_rect_.width && bounds.x + bounds.width > view_rect_.x &&
+                   bounds.y < view_rect_.y + view_rect_.height && bounds.y + bounds.height > view_rect_.y;
+        }
+        // Render systems add their counts during the frame
+        void add_cull_stats(size_t drawn, size_t culled) {
+            cull_stats_.drawn += drawn;
+            cull_stats_.culled += culled;
+        }
+        // Totals of the last frame closed by end_frame()
+        const CullStats& get_cull_stats() const { return last_cull_stats_; }
 
         void set_clear_color(Color color) { clear_color_ = color; }
         Color get_clear_color() const { return clear_color_; }
@@ -49,8 +83,13 @@ class RenderManager {
 
         bool should_close() const;
         int get_fps() const;
+        // Text goes through the layout cache: unchanged strings are not laid out again
         void draw_text(const char *text, int posX, int posY, int fontSize, Color color) const;
         void draw_text_ex(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) const;
+        Vector2 measure_text_ex(Font font, const char *text, float fontSize, float spacing) const;
+        // Batched like draw_sprite: drawn at the next flush, with the sprites of its layer
+        void draw_text_batched(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint, int layer = 0);
+        TextLayoutCache& get_text_cache() const { return text_cache_; }
         void draw_circle(int centerX, int centerY, float radius, Color color);
         void draw_rectangle(int posX, int posY, int width, int height, Color color);
         void draw_rectangle_lines_ex(Rectangle rec, float lineThick, Color color);
@@ -81,6 +120,12 @@ class RenderManager {
         Color clear_color_;
         Camera2D_ECS camera_;
         SpriteBatch batch_;
+        RenderQueue queue_;
+        ParticleRenderer particle_renderer_;
+        mutable TextLayoutCache text_cache_;
+        Rectangle view_rect_{0, 0, 0, 0};
+        CullStats cull_stats_;
+        CullStats last_cull_stats_;
         ScreenInfos _winInfos;
         Font _font;
         int _monitorWidth = 0;
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextLayoutCache - Positioned glyph quads per (font, size, string)
+*/
+
+#pragma once
+
+#include "ECS/Renderer/Batch/SpriteBatch.hpp"
+#include <raylib.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One glyph of a laid out string: where it is in the font atlas and where it
+// goes, relative to the position the string is drawn at
+struct GlyphQuad {
+    Rectangle source;
+    Rectangle dest;
+};
+
+struct TextLayout {
+    std::vector<GlyphQuad> glyphs;
+    Vector2 size;   // same as MeasureTextEx
+};
+
+// A raylib Font is already a glyph atlas (one texture, one rectangle per
+// glyph), but DrawTextEx and MeasureTextEx find every glyph again with a
+// linear search and redo the layout on each call. This keeps the result for
+// strings that come back frame after frame (labels, HUD values, chat lines)
+// and hands it out as quads, either drawn right away or queued in a
+// SpriteBatch so text joins the sprite draw runs of its layer.
+//
+// Main thread only. Layouts stay valid until end_frame() evicts them or
+// clear() is called; strings not drawn during a frame are evicted once the
+// cache holds more than its capacity.
+class TextLayoutCache {
+    public:
+        TextLayoutCache() = default;
+        ~TextLayoutCache() = default;
+        TextLayoutCache(const TextLayoutCache&) = delete;
+        TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+
+        const TextLayout& layout(const Font& font, const char* text, float font_size, float spacing);
+        // Same result as MeasureTextEx
+        Vector2 measure(const Font& font, const char* text, float font_size, float spacing);
+
+        // Same output as DrawTextEx
+        void draw(const Font& font, const char* text, Vector2 position, float font_size,
+                  float spacing, Color tint);
+        // Drawn by the batch's next flush(), sorted with the sprites of layer
+        void queue(SpriteBatch& batch, const Font& font, const char* text, Vector2 position,
+                   float font_size, float spacing, Color tint, int layer = 0, int blend = BLEND_ALPHA);
+
+        void end_frame();
+        // Call when a font is unloaded: layouts point into its atlas
+        void clear();
+
+        void set_capacity(size_t capacity) { capacity_ = capacity; }
+        size_t get_capacity() const { return capacity_; }
+        size_t get_entry_count() const { return entries_.size(); }
+        size_t get_hits() const { return hits_; }
+        size_t get_misses() const { return misses_; }
+
+    private:
+        // Codepoint to glyph index for one font
+        struct GlyphTable {
+            unsigned int texture_id;
+            const GlyphInfo* glyphs;
+            std::array<int, 128> ascii;
+            std::unordered_map<int, int> others;
+            int fallback;
+        };
+
+        struct Entry {
+            unsigned int texture_id;
+            const GlyphInfo* glyphs;
+            float font_size;
+            float spacing;
+            std::string text;
+            TextLayout layout;
+            uint64_t last_used;
+        };
+
+        const GlyphTable& table_for(const Font& font);
+        void build(const Font& font, const GlyphTable& table, Entry& entry);
+
+        std::unordered_map<uint64_t, Entry> entries_;
+        std::vector<GlyphTable> tables_;
+        std::vector<SpriteVertex> vertices_;  // draw() scratch, reused across calls
+        size_t capacity_{2048};
+        uint64_t frame_{0};
+        size_t hits_{0};
+        size_t misses_{0};
+};
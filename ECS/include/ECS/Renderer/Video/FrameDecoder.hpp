@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FrameDecoder - Frame sources for FramePlayer
+*/
+
+#pragma once
+
+#include <raylib.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Produces a clip's frames in order. decode_next() runs on a streamer worker,
+// never twice at once for the same decoder, and must not touch the GL context.
+class IFrameDecoder {
+    public:
+        virtual ~IFrameDecoder() = default;
+
+        virtual int width() const = 0;
+        virtual int height() const = 0;
+        virtual float frame_rate() const = 0;
+        // 0 when only known once the last frame is decoded (video streams)
+        virtual size_t frame_count() const = 0;
+
+        // Writes width() * height() RGBA8 pixels; false past the last frame or on error
+        virtual bool decode_next(unsigned char* rgba) = 0;
+};
+
+// Takes ownership of image: converts it to RGBA8 at width x height, copies it
+// to rgba and unloads it. False if the image failed to load.
+bool copy_frame_pixels(Image image, int width, int height, unsigned char* rgba);
+
+// One image file per frame. The first frame is decoded when constructed, on
+// the caller's thread, for the clip size.
+class ImageSequenceDecoder : public IFrameDecoder {
+    public:
+        ImageSequenceDecoder(std::vector<std::string> paths, float frame_rate);
+        ~ImageSequenceDecoder() override;
+
+        // Image files in directory, ordered by the number ending their name
+        // (frame2.png before frame10.png)
+        static std::vector<std::string> list_frames(const std::string& directory);
+        // Same filter and order over an existing file list
+        static std::vector<std::string> order_frames(const std::vector<std::string>& files);
+
+        int width() const override { return width_; }
+        int height() const override { return height_; }
+        float frame_rate() const override { return frame_rate_; }
+        size_t frame_count() const override { return paths_.size(); }
+        bool decode_next(unsigned char* rgba) override;
+
+    private:
+        std::vector<std::string> paths_;
+        float frame_rate_;
+        size_t next_{0};
+        Image first_{};
+        int width_{0};
+        int height_{0};
+};
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FramePack - Single-file container for image sequences
+*/
+
+#pragma once
+
+#include "ECS/Renderer/Video/FrameDecoder.hpp"
+#include <cstdint>
+#include <fstream>
+
+// Every frame of a clip in one file, each kept compressed as its source image:
+//   header    "RFPK", version, width, height, frame count, frame rate, image extension
+//   offsets   frame count + 1 file offsets (uint64)
+//   frames    the image files' bytes, back to back
+// Opening it is one file handle instead of one per frame, and a frame is one
+// seek and read.
+class FramePack : public IFrameDecoder {
+    public:
+        explicit FramePack(const std::string& path);
+
+        // Every frame must be the same image type; frames of another size are
+        // scaled to the first one's when decoded
+        static bool write(const std::string& path, const std::vector<std::string>& frames, float frame_rate);
+        // True when path is missing or older than one of the frames
+        static bool is_stale(const std::string& path, const std::vector<std::string>& frames);
+
+        bool is_open() const { return frame_count_ > 0; }
+
+        int width() const override { return width_; }
+        int height() const override { return height_; }
+        float frame_rate() const override { return frame_rate_; }
+        size_t frame_count() const override { return frame_count_; }
+        bool decode_next(unsigned char* rgba) override;
+
+    private:
+        std::ifstream file_;
+        std::vector<uint64_t> offsets_;
+        std::vector<unsigned char> bytes_;   // reused read buffer
+        std::string extension_;
+        int width_{0};
+        int height_{0};
+        float frame_rate_{0.0f};
+        size_t frame_count_{0};
+        size_t next_{0};
+};
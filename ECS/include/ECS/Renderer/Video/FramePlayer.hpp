@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FramePlayer - Streams a clip's frames through two reused textures
+*/
+
+#pragma once
+
+#include "ECS/Renderer/Video/FrameDecoder.hpp"
+#include "ECS/AssetManager/Streaming/AssetStreamer.hpp"
+#include <functional>
+#include <memory>
+
+// The streamer's workers decode up to ring_size frames ahead into CPU
+// buffers; update() uploads the frame that is due into whichever of two
+// textures is not on screen. A clip of any length costs two textures of VRAM
+// and ring_size frames of RAM.
+class FramePlayer {
+    public:
+        using DecoderFactory = std::function<std::unique_ptr<IFrameDecoder>(const std::string& path, float frame_rate)>;
+
+        // Decoders for other containers, by extension (".mp4"). ".frames" is a FramePack.
+        static void register_decoder(const std::string& extension, DecoderFactory factory);
+        // A directory of numbered images, or a file whose extension has a decoder.
+        // frame_rate is used when the source does not carry one.
+        static std::unique_ptr<IFrameDecoder> open_decoder(const std::string& path, float frame_rate = 30.0f);
+
+        explicit FramePlayer(AssetStreamer& streamer, size_t ring_size = 4);
+        ~FramePlayer();
+        FramePlayer(const FramePlayer&) = delete;
+        FramePlayer& operator=(const FramePlayer&) = delete;
+
+        bool open(const std::string& path, float frame_rate = 30.0f);
+        bool open(std::unique_ptr<IFrameDecoder> decoder);
+        void close();
+
+        // Main thread, once per frame: shows the frame due, if it is decoded.
+        // When several are due the older ones are dropped; when none is
+        // decoded yet the current one stays up.
+        void update(float delta_time);
+
+        // Null until the first frame is shown
+        Texture2D* get_texture() { return shown_ > 0 ? &textures_[front_] : nullptr; }
+        bool is_open() const { return stream_ != nullptr; }
+        // Every frame decoded and shown (or dropped)
+        bool is_finished() const;
+        size_t get_frame_index() const { return shown_; }
+        size_t get_dropped_frames() const { return dropped_; }
+
+    private:
+        // Shared with the decode job in flight, which can outlive close()
+        struct Stream {
+            std::unique_ptr<IFrameDecoder> decoder;
+            std::vector<std::vector<unsigned char>> buffers;
+            size_t head{0};          // next buffer to fill
+            size_t ready{0};         // filled and not shown yet
+            bool decoding{false};
+            bool decoded{false};     // result of the job in flight
+            bool ended{false};
+            bool closed{false};
+        };
+
+        void decode_ahead();
+        size_t tail() const;
+        void present();
+
+        AssetStreamer& streamer_;
+        size_t ring_size_;
+        std::shared_ptr<Stream> stream_;
+        Texture2D textures_[2]{};
+        int front_{0};
+        float frame_time_{0.0f};
+        float clock_{0.0f};
+        size_t shown_{0};
+        size_t dropped_{0};
+};
@@ -11,7 +11,10 @@
 
 #include "ECS/Components/Animation.hpp"
 #include "ECS/Components/Position.hpp"
+#include "ECS/Components/Velocity.hpp"
 #include "ECS/Entity.hpp"
+#include "ECS/SparseSet.hpp"
+#include "ECS/Renderer/Commands/RenderCommandList.hpp"
 
 #include <unordered_map>
 #include <vector>
@@ -28,17 +31,13 @@ class AnimationSystem : public ISystem {
     public:
         void update(registry& r, float dt = 0.0f) override;
         const char* get_name() const override { return "AnimationSystem"; }
-        ~AnimationSystem();
     private:
         // runtime state per-entity (entity index -> state)
         std::unordered_map<std::size_t, AnimState> states_;
-        // Texture cache to avoid reloading
-        std::unordered_map<std::string, Texture2D> texture_cache_;
-
-        Texture2D load_texture(const std::string& path);
-        bool shouldAdvance(animation &anim, entity ent, registry &r);
+        bool shouldAdvance(const animation &anim, size_t ent, sparse_set<velocity> *vel_arr);
         void updateAnim(animation &anim, float dt, std::vector<entity> &entToKill, entity ent);
-        void renderAnim(animation &anim, position &pos);
+        // false when the frame is off-screen and was not recorded
+        bool renderAnim(const animation &anim, const position &pos, RenderCommandList &out);
 };
 
 #if defined(_WIN32)
@@ -8,11 +8,21 @@
 #pragma once
 
 #include "ECS/Systems/ISystem.hpp"
+#include "ECS/Physics/Collision/BatchCollisionDetector.hpp"
+#include <utility>
+#include <vector>
 
 class CollisionSystem : public ISystem {
 public:
     void update(registry& r, float dt = 0.0f) override;
     const char* get_name() const override { return "CollisionSystem"; }
+
+private:
+    // reused across ticks
+    std::vector<std::pair<size_t, size_t>> collision_pairs_;
+    std::vector<std::pair<size_t, size_t>> candidates_;
+    AABBPairBatch narrow_batch_;
+    std::vector<uint32_t> hits_;
 };
 
 
@@ -0,0 +1,33 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** parallax_system
+*/
+
+#pragma once
+
+#include "ECS/Systems/ISystem.hpp"
+#include "ECS/Renderer/Parallax/ParallaxRenderer.hpp"
+
+// Scrolls parallax_layer entities by dt and queues each as one quad under the
+// sprites. Load it as a logic system: render systems are updated with no dt.
+class ParallaxSystem : public ISystem {
+    public:
+        ~ParallaxSystem() override;
+        void update(registry& r, float dt = 0.0f) override;
+        const char* get_name() const override { return "ParallaxSystem"; }
+
+    private:
+        ParallaxRenderer renderer_;
+};
+
+
+#if defined(_WIN32)
+  #define DLL_EXPORT extern "C" __declspec(dllexport)
+#else
+  #define DLL_EXPORT extern "C"
+#endif
+
+DLL_EXPORT ISystem* create_system();
+DLL_EXPORT void     destroy_system(ISystem* ptr);
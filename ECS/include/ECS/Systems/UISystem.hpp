@@ -11,13 +11,14 @@
 #include "../Components/UIComponent.hpp"
 #include "../Registry.hpp"
 #include "../UI/IUIComponent.hpp"
+#include "../UI/RetainedUI.hpp"
 #include <raylib.h>
 
 namespace UI {
     class UISystem : public ISystem {
     public:
         UISystem() = default;
-        virtual ~UISystem() = default;
+        virtual ~UISystem();
 
         // ISystem implementation
         void update(registry& registry, float deltaTime) override;
@@ -37,12 +38,16 @@ namespace UI {
         void set_enabled(bool enabled) { _enabled = enabled; }
         bool is_enabled() const { return _enabled; }
 
+        // Cached widget layer, for stats and forced redraws
+        RetainedUI& get_retained() { return _retained; }
+
     private:
         size_t _focused_entity_id{static_cast<size_t>(-1)};
         bool _enabled{true};
+        RetainedUI _retained;
 
         // Helper methods
-        size_t get_entity_at_position(registry& registry, float x, float y);
+        size_t get_entity_at_position(float x, float y) const;
         void handle_mouse_input(registry& registry);
         void handle_keyboard_input(registry& registry);
     };
@@ -11,14 +11,21 @@ namespace UI {
         virtual ~AUIComponent() = default;
 
         // IUIComponent implementation
-        void setVisible(bool visible) override { _visible = visible; }
+        void setVisible(bool visible) override {
+            if (visible != _visible) markDirty();
+            _visible = visible;
+        }
         bool isVisible() const override { return _visible; }
 
-        void setEnabled(bool enabled) override { _enabled = enabled; }
+        void setEnabled(bool enabled) override {
+            if (enabled != _enabled) markDirty();
+            _enabled = enabled;
+        }
         bool isEnabled() const override { return _enabled; }
 
         void setPosition(float x, float y) override {
             _position = {x, y};
+            markDirty();
         }
 
         Vector2 getPosition() const override {
@@ -27,6 +34,7 @@ namespace UI {
 
         void setSize(float width, float height) override {
             _size = {width, height};
+            markDirty();
         }
 
         Vector2 getSize() const override {
@@ -41,6 +49,21 @@ namespace UI {
         UIState getState() const override { return _state; }
         void setState(UIState state) override { _state = state; }
 
+        bool isAnimated() const override { return _animated; }
+        // Components drawing something time-based, or state they do not own
+        // (custom renders), are animated; otherwise call markDirty() whenever
+        // the look changes
+        void setAnimated(bool animated) {
+            _animated = animated;
+            markDirty();
+        }
+        uint32_t getVersion() const override { return _version; }
+        void markDirty() { ++_version; }
+
+        Rectangle getRenderBounds() const override {
+            return {_position.x, _position.y, _size.x, _size.y};
+        }
+
     protected:
         // Update state based on mouse interaction
         void update_state() {
@@ -68,5 +91,7 @@ namespace UI {
         UIState _state{UIState::Normal};
         bool _visible{true};
         bool _enabled{true};
+        bool _animated{false};
+        uint32_t _version{0};
     };
 }
@@ -72,11 +72,22 @@ namespace UI {
 
         // Button-specific methods
         std::string getText() { return _text; }
-        void setText(const std::string& text) { _text = text; }
+        void setText(const std::string& text) {
+            if (text == _text) return;
+            _text = text;
+            markDirty();
+        }
         const std::string& getText() const { return _text; }
 
-        void setStyle(const ButtonStyle& style) { _style = style; }
-        ButtonStyle& getStyle() { return _style; }
+        void setStyle(const ButtonStyle& style) {
+            _style = style;
+            markDirty();
+        }
+        // Mutable access counts as a change
+        ButtonStyle& getStyle() {
+            markDirty();
+            return _style;
+        }
         const ButtonStyle& getStyle() const { return _style; }
 
         // Callbacks
@@ -89,6 +100,7 @@ namespace UI {
         // Custom rendering callback - allows game to override rendering
         void setCustomRender(std::function<void(const UIButton&)> render_func) {
             _customRender = std::move(render_func);
+            setAnimated(true);
         }
 
         // Getters for custom rendering
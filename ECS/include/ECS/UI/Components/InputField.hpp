@@ -83,23 +83,45 @@ namespace UI {
         void handleInput() override;
 
         // Input field specific methods
-        void setText(const std::string& text) { _text = text; }
+        void setText(const std::string& text) {
+            if (text == _text) return;
+            _text = text;
+            markDirty();
+        }
         const std::string& getText() const { return _text; }
 
-        void setPlaceholder(const std::string& placeholder) { _placeholder = placeholder; }
+        void setPlaceholder(const std::string& placeholder) {
+            _placeholder = placeholder;
+            markDirty();
+        }
         const std::string& getPlaceholder() const { return _placeholder; }
 
-        void setPassword(bool is_password) { _is_password = is_password; }
+        void setPassword(bool is_password) {
+            _is_password = is_password;
+            markDirty();
+        }
         bool isPassword() const { return _is_password; }
 
         void setMaxLength(int max_length) { _max_length = max_length; }
         int getMaxLength() const { return _max_length; }
 
-        void setFocused(bool focused) { _is_focused = focused; }
+        void setFocused(bool focused) {
+            _is_focused = focused;
+            markDirty();
+        }
         bool isFocused() const { return _is_focused; }
 
-        void setStyle(const InputFieldStyle& style) { _style = style; }
-        InputFieldStyle& getStyle() { return _style; }
+        void setStyle(const InputFieldStyle& style) {
+            _style = style;
+            markDirty();
+        }
+        InputFieldStyle& getStyle() {
+            markDirty();
+            return _style;
+        }
+
+        // The cursor blinks while focused
+        bool isAnimated() const override { return _is_focused || AUIComponent::isAnimated(); }
         const InputFieldStyle& getStyle() const { return _style; }
 
         // Callbacks
@@ -122,6 +144,7 @@ namespace UI {
         // Custom rendering callback
         void setCustomRender(std::function<void(const UIInputField&)> render_func) {
             _customRender = std::move(render_func);
+            setAnimated(true);
         }
 
     protected:
@@ -61,13 +61,20 @@ namespace UI {
         void handleInput() override;
 
         // Panel specific methods
-        void setStyle(const PanelStyle& style) { _style = style; }
-        PanelStyle& getStyle() { return _style; }
+        void setStyle(const PanelStyle& style) {
+            _style = style;
+            markDirty();
+        }
+        PanelStyle& getStyle() {
+            markDirty();
+            return _style;
+        }
         const PanelStyle& getStyle() const { return _style; }
 
         // Custom rendering callback
         void setCustomRender(std::function<void(const UIPanel&)> render_func) {
             _customRender = std::move(render_func);
+            setAnimated(true);
         }
 
     protected:
@@ -79,26 +79,39 @@ namespace UI {
 
         // Text specific methods
         void setText(const std::string& text) {
+            if (text == _text) return;
             _text = text;
             updateSize();
+            markDirty();
         }
         const std::string& getText() const { return _text; }
 
         void setStyle(const TextStyle& style) {
             _style = style;
             updateSize();
+            markDirty();
+        }
+        TextStyle& getStyle() {
+            markDirty();
+            return _style;
         }
-        TextStyle& getStyle() { return _style; }
         const TextStyle& getStyle() const { return _style; }
 
-        void setAlignment(TextAlignment alignment) { _style.setAlignment(alignment); }
+        void setAlignment(TextAlignment alignment) {
+            _style.setAlignment(alignment);
+            markDirty();
+        }
         TextAlignment getAlignment() const { return _style.getAlignment(); }
 
         // Custom rendering callback
         void setCustomRender(std::function<void(const UIText&)> render_func) {
             _customRender = std::move(render_func);
+            setAnimated(true);
         }
 
+        // Aligned text box plus shadow; custom renders use position and size
+        Rectangle getRenderBounds() const override;
+
         // Get calculated text size
         Vector2 getTextSize() const;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <raylib.h>
+#include <cstdint>
 #include <string>
 
 namespace UI {
@@ -40,5 +41,12 @@ namespace UI {
         // State
         virtual UIState getState() const = 0;
         virtual void setState(UIState state) = 0;
+
+        // Retained rendering: UISystem caches components that are not
+        // animated and redraws them only when their version changes
+        virtual bool isAnimated() const = 0;
+        virtual uint32_t getVersion() const = 0;
+        // Screen area render() draws into
+        virtual Rectangle getRenderBounds() const = 0;
     };
 }
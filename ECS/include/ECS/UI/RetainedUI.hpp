@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RetainedUI - Cached UI layer with dirty-region redraw and z-ordered hit-testing
+*/
+
+#pragma once
+
+#include "ECS/Components/UIComponent.hpp"
+#include "ECS/Physics/UniformGrid/UniformGrid.hpp"
+#include "ECS/SparseSet.hpp"
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace UI {
+    // Static widgets are drawn once into a screen-sized render texture and
+    // composited with a single draw; only the region around widgets whose
+    // version, bounds, visibility or state changed is redrawn. Live widgets
+    // (animated, hovered, pressed, or overlapping a live widget below them)
+    // are drawn every frame on top, in z order (the component array order).
+    class RetainedUI {
+    public:
+        static constexpr size_t NO_ENTITY = static_cast<size_t>(-1);
+
+        RetainedUI() = default;
+        ~RetainedUI() = default;
+        RetainedUI(const RetainedUI&) = delete;
+        RetainedUI& operator=(const RetainedUI&) = delete;
+
+        // Picks up added/removed/changed widgets; call once per frame before render()
+        void sync(sparse_set<UIComponent>& components);
+        // Redraws the dirty region of the cache, then draws it and the live widgets
+        void render();
+
+        // Topmost visible, enabled widget under the point, NO_ENTITY if none
+        size_t hit_test(float x, float y) const;
+
+        // Redraw the whole cache on the next render()
+        void invalidate() { full_redraw_ = true; }
+        // Frees the render texture; needs the GL context
+        void release();
+
+        size_t get_widget_count() const { return widgets_.size(); }
+        size_t get_live_count() const { return live_count_; }
+        // Widgets re-rendered into the cache by the last render()
+        size_t get_last_redraw_count() const { return last_redraw_count_; }
+        const Rectangle& get_last_dirty_region() const { return last_dirty_; }
+
+    private:
+        struct Widget {
+            size_t entity;
+            IUIComponent* element;
+            Rectangle bounds;           // render bounds plus a margin
+            UIState state;
+            uint32_t version;
+            bool visible;
+            bool live;
+            uint32_t change_streak;     // consecutive frames with a new version
+            uint64_t last_change;
+        };
+
+        void rebuild(sparse_set<UIComponent>& components);
+        void rebuild_index();
+        void update_liveness();
+        void add_dirty(const Rectangle& area);
+        bool ensure_cache();
+        void redraw_cache();
+
+        std::vector<Widget> widgets_;
+        UniformGrid index_{128.0f};
+        bool index_dirty_{true};
+        mutable std::vector<size_t> query_;
+
+        RenderTexture2D cache_{};
+        Rectangle dirty_{0, 0, 0, 0};
+        Rectangle last_dirty_{0, 0, 0, 0};
+        bool full_redraw_{true};
+        uint64_t frame_{0};
+        size_t live_count_{0};
+        size_t last_redraw_count_{0};
+    };
+}
@@ -0,0 +1,252 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetArchive Implementation
+*/
+
+#ifdef _WIN32
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #ifndef NOGDI
+    #define NOGDI
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "ECS/AssetManager/Archive/AssetArchive.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr uint32_t VERSION = 1;
+    constexpr size_t HEADER_SIZE = 32;
+
+    void put(std::ofstream& out, const void* data, size_t size) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+    // Reads little-endian fields; archives are written and read on the same machine family
+    template <typename T>
+    T get(const unsigned char* at) {
+        T value;
+        std::memcpy(&value, at, sizeof(T));
+        return value;
+    }
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+std::vector<std::string> AssetArchive::collect(const std::string& root) {
+    std::vector<std::string> names;
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (it->is_regular_file()) {
+            names.push_back(fs::relative(it->path(), root).generic_string());
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+bool AssetArchive::write(const std::string& path, const std::string& root, const std::vector<std::string>& names) {
+    std::error_code ec;
+    fs::path parent = fs::path(path).parent_path();
+    if (!parent.empty()) fs::create_directories(parent, ec);
+
+    std::string temp = path + ".tmp";
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "AssetArchive: cannot write " << temp << std::endl;
+        return false;
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(names.size());
+    const char padding[ALIGNMENT] = {};
+    std::vector<char> bytes;
+    uint64_t offset = HEADER_SIZE;
+    out.write(padding, HEADER_SIZE);   // the header goes in once the index is placed
+    for (const auto& name : names) {
+        std::ifstream in(fs::path(root) / name, std::ios::binary | std::ios::ate);
+        if (!in || name.size() > UINT16_MAX) {
+            std::cerr << "AssetArchive: cannot pack " << name << std::endl;
+            out.close();
+            fs::remove(temp, ec);
+            return false;
+        }
+        bytes.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+        entries.push_back({offset, static_cast<uint64_t>(bytes.size())});
+        put(out, bytes.data(), bytes.size());
+        size_t pad = (ALIGNMENT - bytes.size() % ALIGNMENT) % ALIGNMENT;
+        out.write(padding, static_cast<std::streamsize>(pad));
+        offset += bytes.size() + pad;
+    }
+
+    uint64_t index_offset = offset;
+    for (size_t i = 0; i < names.size(); ++i) {
+        uint16_t length = static_cast<uint16_t>(names[i].size());
+        put(out, &entries[i].offset, sizeof(uint64_t));
+        put(out, &entries[i].size, sizeof(uint64_t));
+        put(out, &length, sizeof(length));
+        put(out, names[i].data(), names[i].size());
+    }
+    uint64_t index_size = static_cast<uint64_t>(out.tellp()) - index_offset;
+
+    uint32_t count = static_cast<uint32_t>(names.size());
+    uint32_t reserved = 0;
+    out.seekp(0);
+    put(out, "RPAK", 4);
+    put(out, &VERSION, sizeof(VERSION));
+    put(out, &count, sizeof(count));
+    put(out, &reserved, sizeof(reserved));
+    put(out, &index_offset, sizeof(index_offset));
+    put(out, &index_size, sizeof(index_size));
+    out.close();
+    if (!out) {
+        std::cerr << "AssetArchive: failed to write " << temp << std::endl;
+        fs::remove(temp, ec);
+        return false;
+    }
+
+    fs::rename(temp, path, ec);
+    if (ec) {
+        std::cerr << "AssetArchive: cannot replace " << path << ": " << ec.message() << std::endl;
+        fs::remove(temp, ec);
+        return false;
+    }
+    std::cout << "AssetArchive: packed " << names.size() << " files (" << offset / 1024 << " KB) into "
+              << path << std::endl;
+    return true;
+}
+
+bool AssetArchive::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER file_size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    file_ = file;
+    mapping_ = mapping;
+    data_ = static_cast<const unsigned char*>(view);
+    data_size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    void* view = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // The mapping keeps the file alive on its own
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+    data_ = static_cast<const unsigned char*>(view);
+    data_size_ = static_cast<size_t>(info.st_size);
+#endif
+
+    bool valid = data_size_ >= HEADER_SIZE && std::memcmp(data_, "RPAK", 4) == 0 &&
+                 get<uint32_t>(data_ + 4) == VERSION;
+    uint32_t count = valid ? get<uint32_t>(data_ + 8) : 0;
+    uint64_t index_offset = valid ? get<uint64_t>(data_ + 16) : 0;
+    uint64_t index_size = valid ? get<uint64_t>(data_ + 24) : 0;
+    valid = valid && index_offset <= data_size_ && index_size <= data_size_ - index_offset;
+
+    const unsigned char* at = data_ + index_offset;
+    const unsigned char* end = at + index_size;
+    for (uint32_t i = 0; valid && i < count; ++i) {
+        constexpr size_t FIXED = 2 * sizeof(uint64_t) + sizeof(uint16_t);
+        if (static_cast<size_t>(end - at) < FIXED) {
+            valid = false;
+            break;
+        }
+        Entry entry{get<uint64_t>(at), get<uint64_t>(at + 8)};
+        uint16_t length = get<uint16_t>(at + 16);
+        at += FIXED;
+        if (static_cast<size_t>(end - at) < length || entry.offset > data_size_ ||
+            entry.size > data_size_ - entry.offset) {
+            valid = false;
+            break;
+        }
+        entries_[std::string(reinterpret_cast<const char*>(at), length)] = entry;
+        at += length;
+    }
+    if (!valid) {
+        std::cerr << "AssetArchive: " << path << " is not a valid archive" << std::endl;
+        close();
+        return false;
+    }
+    std::cout << "AssetArchive: mapped " << path << " (" << entries_.size() << " files)" << std::endl;
+    return true;
+}
+
+void AssetArchive::close() {
+    if (data_) {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+        CloseHandle(static_cast<HANDLE>(mapping_));
+        CloseHandle(static_cast<HANDLE>(file_));
+        mapping_ = nullptr;
+        file_ = nullptr;
+#else
+        munmap(const_cast<unsigned char*>(data_), data_size_);
+#endif
+    }
+    data_ = nullptr;
+    data_size_ = 0;
+    entries_.clear();
+}
+
+const unsigned char* AssetArchive::find(const std::string& name, size_t* size) const {
+    auto it = entries_.find(name);
+    if (it == entries_.end()) return nullptr;
+    if (size) *size = static_cast<size_t>(it->second.size);
+    return data_ + it->second.offset;
+}
+
+std::vector<std::string> AssetArchive::list(const std::string& directory) const {
+    std::string prefix = directory;
+    while (!prefix.empty() && prefix.back() == '/') prefix.pop_back();
+    if (!prefix.empty()) prefix += '/';
+
+    std::vector<std::string> names;
+    for (const auto& [name, entry] : entries_) {
+        if (name.compare(0, prefix.size(), prefix) == 0 && name.find('/', prefix.size()) == std::string::npos) {
+            names.push_back(name);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
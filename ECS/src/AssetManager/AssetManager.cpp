@@ -6,6 +6,10 @@
 */
 
 #include "ECS/AssetManager/AssetManager.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 
 AssetManager& AssetManager::instance() {
@@ -19,8 +23,15 @@ void AssetManager::init() {
 }
 
 void AssetManager::shutdown() {
+    atlas_.unload();
     textures_.clear();
+    ++generation_;
     sounds_.clear();
+    texture_refs_.clear();
+    sound_refs_.clear();
+    // Cleared requests only free their decoded data when they come back
+    streamer_.finish();
+    unmount_archive();
     CloseAudioDevice();
     std::cout << "AssetManager shutdown" << std::endl;
 }
@@ -33,10 +44,159 @@ Sound* AssetManager::get_sound(const std::string& path) {
     return sounds_.load(path);
 }
 
+bool AssetManager::mount_archive(const std::string& path, const std::string& root) {
+    unmount_archive();
+    if (!archive_.open(path)) return false;
+    archive_root_ = root;
+    while (!archive_root_.empty() && archive_root_.back() == '/') archive_root_.pop_back();
+    SetLoadFileDataCallback(&AssetManager::load_file_data);
+    return true;
+}
+
+void AssetManager::unmount_archive() {
+    if (!archive_.is_open()) return;
+    SetLoadFileDataCallback(nullptr);
+    archive_.close();
+    archive_root_.clear();
+}
+
+bool AssetManager::archive_name(const std::string& path, std::string& name) const {
+    if (!archive_.is_open() || path.compare(0, archive_root_.size(), archive_root_) != 0) return false;
+    size_t start = archive_root_.size();
+    if (start < path.size() && path[start] != '/') return false;
+    while (start < path.size() && path[start] == '/') ++start;
+    name = path.substr(start);
+    return true;
+}
+
+bool AssetManager::in_archive(const std::string& path) const {
+    std::string name;
+    return archive_name(path, name) && archive_.contains(name);
+}
+
+std::vector<std::string> AssetManager::list_files(const std::string& directory) const {
+    std::vector<std::string> files;
+    std::string name;
+    if (archive_name(directory, name)) {
+        for (const auto& packed : archive_.list(name)) {
+            files.push_back(archive_root_ + "/" + packed);
+        }
+        if (!files.empty()) return files;
+    }
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (entry.is_regular_file()) files.push_back(entry.path().string());
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+unsigned char* AssetManager::load_file_data(const char* path, int* size) {
+    // Called from streamer workers too: the archive is only read here
+    *size = 0;
+    const AssetManager& self = instance();
+    std::string name;
+    size_t packed_size = 0;
+    const unsigned char* packed = self.archive_name(path, name) ? self.archive_.find(name, &packed_size) : nullptr;
+    if (packed) {
+        // raylib frees what this returns, so it gets its own copy
+        auto* data = static_cast<unsigned char*>(MemAlloc(static_cast<unsigned int>(packed_size)));
+        if (!data) return nullptr;
+        std::memcpy(data, packed, packed_size);
+        *size = static_cast<int>(packed_size);
+        return data;
+    }
+
+    // Loose file, as raylib would read it without the hook
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return nullptr;
+    std::streamsize length = file.tellg();
+    if (length <= 0) return nullptr;
+    auto* data = static_cast<unsigned char*>(MemAlloc(static_cast<unsigned int>(length)));
+    file.seekg(0);
+    if (!data || !file.read(reinterpret_cast<char*>(data), length)) {
+        MemFree(data);
+        return nullptr;
+    }
+    *size = static_cast<int>(length);
+    return data;
+}
+
 void AssetManager::unload_texture(const std::string& path) {
     textures_.unload(path);
+    ++generation_;
 }
 
 void AssetManager::unload_sound(const std::string& path) {
     sounds_.unload(path);
+}
+
+void AssetManager::acquire(const AssetManifest& manifest) {
+    for (const auto& path : manifest.textures) {
+        if (texture_refs_[path]++ == 0 && !is_packed(path)) {
+            textures_.load_async(streamer_, path);
+        }
+    }
+    for (const auto& path : manifest.sounds) {
+        if (sound_refs_[path]++ == 0) {
+            sounds_.load_async(streamer_, path);
+        }
+    }
+}
+
+void AssetManager::release(const AssetManifest& manifest) {
+    bool unloaded = false;
+    for (const auto& path : manifest.textures) {
+        auto it = texture_refs_.find(path);
+        if (it == texture_refs_.end() || --it->second > 0) continue;
+        texture_refs_.erase(it);
+        if (!is_packed(path)) {
+            textures_.unload(path);
+            unloaded = true;
+        }
+    }
+    for (const auto& path : manifest.sounds) {
+        auto it = sound_refs_.find(path);
+        if (it == sound_refs_.end() || --it->second > 0) continue;
+        sound_refs_.erase(it);
+        sounds_.unload(path);
+    }
+    if (unloaded) ++generation_;
+}
+
+bool AssetManager::is_ready(const AssetManifest& manifest) const {
+    for (const auto& path : manifest.textures) {
+        if (textures_.is_pending(path)) return false;
+    }
+    for (const auto& path : manifest.sounds) {
+        if (sounds_.is_pending(path)) return false;
+    }
+    return true;
+}
+
+void AssetManager::refresh_texture(const std::string& path, texture_ref& ref) {
+    const AtlasRegion* region = atlas_.find(path);
+    Texture2D* page = region ? atlas_.get_page(region->page) : nullptr;
+    if (page) {
+        ref.texture = page;
+        ref.region = region->rect;
+        ref.scale = region->scale;
+    } else if (textures_.is_pending(path)) {
+        // Looked up again every frame until the upload lands
+        ref.texture = nullptr;
+        ref.region = {0.0f, 0.0f, 0.0f, 0.0f};
+        ref.generation = 0;
+        return;
+    } else {
+        ref.texture = textures_.load(path);
+        ref.region = {0.0f, 0.0f, 0.0f, 0.0f};
+        ref.scale = textures_.get_scale(path);
+        if (ref.texture) {
+            ref.region.width = static_cast<float>(ref.texture->width);
+            ref.region.height = static_cast<float>(ref.texture->height);
+        }
+    }
+    // A missing file stays null until the next generation instead of being retried every frame
+    ref.generation = get_texture_generation();
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AtlasPacker Implementation
+*/
+
+#include "ECS/AssetManager/Atlas/AtlasPacker.hpp"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+
+AtlasPacker::AtlasPacker(int page_size, int padding)
+    : page_size_(page_size > 0 ? page_size : 2048), padding_(std::max(0, padding)) {
+}
+
+bool AtlasPacker::find_position(const Skyline& skyline, int width, int height,
+                                size_t& node_index, int& x, int& y) const {
+    int best_top = INT_MAX;
+    int best_x = INT_MAX;
+    bool found = false;
+
+    for (size_t i = 0; i < skyline.size(); ++i) {
+        int left = skyline[i].x;
+        if (left + width > page_size_) break;
+
+        // Resting height: highest skyline segment under [left, left + width)
+        int top = 0;
+        int span = 0;
+        for (size_t j = i; j < skyline.size() && span < width; ++j) {
+            top = std::max(top, skyline[j].y);
+            span = skyline[j].x + skyline[j].width - left;
+        }
+        if (top + height > page_size_) continue;
+
+        if (top + height < best_top || (top + height == best_top && left < best_x)) {
+            best_top = top + height;
+            best_x = left;
+            node_index = i;
+            x = left;
+            y = top;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void AtlasPacker::place(Skyline& skyline, size_t node_index, int x, int y, int width, int height) {
+    skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(node_index), {x, y + height, width});
+
+    // Cut the segments now covered by the new one
+    size_t i = node_index + 1;
+    while (i < skyline.size()) {
+        const SkylineNode& prev = skyline[i - 1];
+        SkylineNode& node = skyline[i];
+        int prev_right = prev.x + prev.width;
+        if (node.x >= prev_right) break;
+
+        int shrink = prev_right - node.x;
+        node.x += shrink;
+        node.width -= shrink;
+        if (node.width > 0) break;
+        skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    // Merge neighbours at the same height
+    for (size_t k = 0; k + 1 < skyline.size();) {
+        if (skyline[k].y == skyline[k + 1].y) {
+            skyline[k].width += skyline[k + 1].width;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(k + 1));
+        } else {
+            ++k;
+        }
+    }
+}
+
+size_t AtlasPacker::pack(const std::vector<Size>& sizes, std::vector<AtlasPlacement>& out) {
+    out.assign(sizes.size(), AtlasPlacement{});
+
+    std::vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+        if (sizes[a].height != sizes[b].height) return sizes[a].height > sizes[b].height;
+        return sizes[a].width > sizes[b].width;
+    });
+
+    size_t placed = 0;
+    for (size_t index : order) {
+        int width = sizes[index].width + padding_;
+        int height = sizes[index].height + padding_;
+        if (sizes[index].width <= 0 || sizes[index].height <= 0 ||
+            width > page_size_ || height > page_size_) {
+            continue;
+        }
+
+        size_t node_index = 0;
+        int x = 0;
+        int y = 0;
+        size_t page = 0;
+        for (; page < pages_.size(); ++page) {
+            if (find_position(pages_[page], width, height, node_index, x, y)) break;
+        }
+        if (page == pages_.size()) {
+            pages_.push_back({{0, 0, page_size_}});
+            find_position(pages_.back(), width, height, node_index, x, y);
+        }
+
+        place(pages_[page], node_index, x, y, width, height);
+        out[index] = {static_cast<int>(page), x, y};
+        used_area_ += static_cast<long long>(width) * height;
+        ++placed;
+    }
+    return placed;
+}
+
+float AtlasPacker::get_occupancy() const {
+    if (pages_.empty()) return 0.0f;
+    double total = static_cast<double>(page_size_) * page_size_ * pages_.size();
+    return static_cast<float>(used_area_ / total);
+}
@@ -0,0 +1,265 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextureAtlas Implementation
+*/
+
+#include "ECS/AssetManager/Atlas/TextureAtlas.hpp"
+#include "ECS/AssetManager/Atlas/AtlasPacker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+static std::string page_path(const std::string& prefix, size_t page) {
+    return prefix + "_" + std::to_string(page) + ".png";
+}
+
+static std::vector<float> asked_scales(const std::vector<std::string>& paths, const TextureScales& scales) {
+    std::vector<float> asked;
+    for (const auto& path : paths) {
+        auto it = scales.find(path);
+        asked.push_back(it != scales.end() ? it->second : 1.0f);
+    }
+    return asked;
+}
+
+TextureAtlas::~TextureAtlas() {
+    // Textures belong to the GL context, AssetManager::shutdown() unloads them
+    release_images();
+}
+
+void TextureAtlas::release_images() {
+    for (auto& image : page_images_) {
+        UnloadImage(image);
+    }
+    page_images_.clear();
+}
+
+bool TextureAtlas::build(const std::vector<std::string>& paths, int page_size, int padding,
+                         const TextureScales& scales) {
+    unload();
+
+    std::vector<float> asked = asked_scales(paths, scales);
+    std::vector<Image> images(paths.size());
+    std::vector<int> source_widths(paths.size(), 0);
+    std::vector<AtlasPacker::Size> sizes(paths.size(), {0, 0});
+    for (size_t i = 0; i < paths.size(); ++i) {
+        images[i] = LoadImage(paths[i].c_str());
+        if (!images[i].data) {
+            std::cerr << "TextureAtlas: failed to load " << paths[i] << std::endl;
+            continue;
+        }
+        ImageFormat(&images[i], PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        source_widths[i] = images[i].width;
+        if (asked[i] < 1.0f) {
+            int width = std::max(1, static_cast<int>(std::lround(images[i].width * asked[i])));
+            int height = std::max(1, static_cast<int>(std::lround(images[i].height * asked[i])));
+            ImageResize(&images[i], width, height);
+        }
+        sizes[i] = {images[i].width, images[i].height};
+    }
+
+    AtlasPacker packer(page_size, padding);
+    std::vector<AtlasPlacement> placements;
+    size_t placed = packer.pack(sizes, placements);
+
+    page_size_ = packer.get_page_size();
+    page_count_ = static_cast<size_t>(packer.get_page_count());
+    for (size_t p = 0; p < page_count_; ++p) {
+        page_images_.push_back(GenImageColor(page_size_, page_size_, BLANK));
+    }
+
+    // Both sides are RGBA8, so each image row is one copy
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const AtlasPlacement& at = placements[i];
+        if (at.page < 0) {
+            if (images[i].data) {
+                std::cout << "TextureAtlas: " << paths[i] << " does not fit a " << page_size_
+                          << " page, kept as its own texture" << std::endl;
+            }
+            UnloadImage(images[i]);
+            continue;
+        }
+
+        auto* dst = static_cast<unsigned char*>(page_images_[at.page].data);
+        const auto* src = static_cast<const unsigned char*>(images[i].data);
+        size_t row_bytes = static_cast<size_t>(images[i].width) * 4;
+        for (int row = 0; row < images[i].height; ++row) {
+            size_t dst_offset = (static_cast<size_t>(at.y + row) * page_size_ + at.x) * 4;
+            std::memcpy(dst + dst_offset, src + row * row_bytes, row_bytes);
+        }
+
+        regions_[paths[i]] = {at.page, {static_cast<float>(at.x), static_cast<float>(at.y),
+                                        static_cast<float>(images[i].width),
+                                        static_cast<float>(images[i].height)},
+                              static_cast<float>(images[i].width) / source_widths[i]};
+        UnloadImage(images[i]);
+    }
+
+    sources_ = paths;
+    source_scales_ = asked;
+    ++generation_;
+    std::cout << "TextureAtlas: packed " << placed << "/" << paths.size() << " images into "
+              << page_count_ << " page(s) of " << page_size_ << "px ("
+              << static_cast<int>(packer.get_occupancy() * 100.0f) << "% used)" << std::endl;
+    return placed > 0;
+}
+
+bool TextureAtlas::save(const std::string& prefix) const {
+    if (page_images_.size() != page_count_) {
+        std::cerr << "TextureAtlas: save() needs the page images, call it before upload()" << std::endl;
+        return false;
+    }
+
+    std::error_code ec;
+    fs::path parent = fs::path(prefix).parent_path();
+    if (!parent.empty()) fs::create_directories(parent, ec);
+
+    for (size_t p = 0; p < page_count_; ++p) {
+        if (!ExportImage(page_images_[p], page_path(prefix, p).c_str())) {
+            std::cerr << "TextureAtlas: failed to write " << page_path(prefix, p) << std::endl;
+            return false;
+        }
+    }
+
+    std::ofstream table(prefix + ".atlas");
+    if (!table) {
+        std::cerr << "TextureAtlas: failed to write " << prefix << ".atlas" << std::endl;
+        return false;
+    }
+    table.precision(9);
+    table << "atlas 2\n";
+    table << "page_size " << page_size_ << "\n";
+    table << "pages " << page_count_ << "\n";
+    for (size_t i = 0; i < sources_.size(); ++i) {
+        table << "source " << source_scales_[i] << ' ' << sources_[i] << "\n";
+    }
+    for (const auto& [path, region] : regions_) {
+        table << "region " << region.page << ' ' << region.rect.x << ' ' << region.rect.y << ' '
+              << region.rect.width << ' ' << region.rect.height << ' ' << region.scale << ' ' << path << "\n";
+    }
+    return static_cast<bool>(table);
+}
+
+bool TextureAtlas::load(const std::string& prefix) {
+    std::ifstream table(prefix + ".atlas");
+    std::string line;
+    // Version 1 tables predate scales: rebuilt rather than read
+    if (!std::getline(table, line) || line != "atlas 2") return false;
+
+    unload();
+
+    while (std::getline(table, line)) {
+        std::istringstream ss(line);
+        std::string tag;
+        ss >> tag;
+        if (tag == "page_size") {
+            ss >> page_size_;
+        } else if (tag == "pages") {
+            ss >> page_count_;
+        } else if (tag == "source" || tag == "region") {
+            AtlasRegion region{};
+            float asked = 1.0f;
+            if (tag == "region") {
+                ss >> region.page >> region.rect.x >> region.rect.y >> region.rect.width >> region.rect.height
+                   >> region.scale;
+            } else {
+                ss >> asked;
+            }
+            std::string path;
+            ss >> std::ws;
+            std::getline(ss, path);
+            if (tag == "source") {
+                sources_.push_back(path);
+                source_scales_.push_back(asked);
+            } else if (!path.empty()) {
+                regions_[path] = region;
+            }
+        }
+    }
+
+    for (size_t p = 0; p < page_count_; ++p) {
+        Image image = LoadImage(page_path(prefix, p).c_str());
+        if (!image.data) {
+            std::cerr << "TextureAtlas: missing page " << page_path(prefix, p) << std::endl;
+            unload();
+            return false;
+        }
+        page_images_.push_back(image);
+    }
+    ++generation_;
+    return true;
+}
+
+bool TextureAtlas::load_or_build(const std::string& prefix, const std::vector<std::string>& paths,
+                                 int page_size, const TextureScales& scales) {
+    std::error_code ec;
+    auto table_time = fs::last_write_time(prefix + ".atlas", ec);
+    bool fresh = !ec;
+    for (size_t i = 0; fresh && i < paths.size(); ++i) {
+        auto image_time = fs::last_write_time(paths[i], ec);
+        if (!ec && image_time > table_time) fresh = false;
+    }
+
+    if (fresh && load(prefix) && sources_ == paths && source_scales_ == asked_scales(paths, scales) &&
+        page_size_ == page_size) {
+        std::cout << "TextureAtlas: loaded " << prefix << " (" << regions_.size() << " regions)" << std::endl;
+    } else {
+        if (!build(paths, page_size, 2, scales)) return false;
+        save(prefix);
+    }
+    upload();
+    return true;
+}
+
+void TextureAtlas::upload() {
+    for (auto& texture : page_textures_) {
+        UnloadTexture(texture);
+    }
+    page_textures_.clear();
+
+    for (const auto& image : page_images_) {
+        Texture2D texture = LoadTextureFromImage(image);
+        SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+        page_textures_.push_back(texture);
+    }
+    release_images();
+}
+
+void TextureAtlas::unload() {
+    for (auto& texture : page_textures_) {
+        UnloadTexture(texture);
+    }
+    page_textures_.clear();
+    release_images();
+    regions_.clear();
+    sources_.clear();
+    source_scales_.clear();
+    page_count_ = 0;
+    ++generation_;
+}
+
+size_t TextureAtlas::resident_bytes() const {
+    size_t bytes = 0;
+    for (const auto& texture : page_textures_) {
+        bytes += static_cast<size_t>(GetPixelDataSize(texture.width, texture.height, texture.format));
+    }
+    return bytes;
+}
+
+const AtlasRegion* TextureAtlas::find(const std::string& path) const {
+    auto it = regions_.find(path);
+    return it != regions_.end() ? &it->second : nullptr;
+}
+
+Texture2D* TextureAtlas::get_page(int page) {
+    if (page < 0 || static_cast<size_t>(page) >= page_textures_.size()) return nullptr;
+    return &page_textures_[page];
+}
@@ -25,7 +25,56 @@ Sound* SoundManager::load(const std::string& path) {
     return &cache_[path];
 }
 
+AssetHandle<Sound> SoundManager::load_async(AssetStreamer& streamer, const std::string& path) {
+    auto slot = std::make_shared<Slot>();
+    auto it = cache_.find(path);
+    if (it != cache_.end()) {
+        slot->state = AssetState::READY;
+        slot->asset = &it->second;
+        return AssetHandle<Sound>(slot);
+    }
+    auto pending = pending_.find(path);
+    if (pending != pending_.end()) {
+        return AssetHandle<Sound>(pending->second);
+    }
+
+    pending_[path] = slot;
+    streamer.load_wave(path, [this, path](Wave wave) {
+        auto request = pending_.find(path);
+        if (request == pending_.end()) {
+            UnloadWave(wave);
+            return;
+        }
+        std::shared_ptr<Slot> done = request->second;
+        pending_.erase(request);
+
+        auto cached = cache_.find(path);
+        if (cached == cache_.end() && wave.frameCount > 0) {
+            Sound snd = LoadSoundFromWave(wave);
+            if (snd.frameCount > 0) {
+                cached = cache_.emplace(path, snd).first;
+                std::cout << "Streamed sound: " << path << std::endl;
+            }
+        }
+        UnloadWave(wave);
+
+        if (cached == cache_.end()) {
+            std::cerr << "Failed to load sound: " << path << std::endl;
+            done->state = AssetState::FAILED;
+            return;
+        }
+        done->asset = &cached->second;
+        done->state = AssetState::READY;
+    });
+    return AssetHandle<Sound>(slot);
+}
+
 void SoundManager::unload(const std::string& path) {
+    auto pending = pending_.find(path);
+    if (pending != pending_.end()) {
+        pending->second->state = AssetState::FAILED;
+        pending_.erase(pending);
+    }
     auto it = cache_.find(path);
     if (it != cache_.end()) {
         UnloadSound(it->second);
@@ -39,5 +88,10 @@ void SoundManager::clear() {
         UnloadSound(snd);
     }
     cache_.clear();
+    // Requests still decoding are dropped when they come back
+    for (auto& [path, slot] : pending_) {
+        slot->state = AssetState::FAILED;
+    }
+    pending_.clear();
     std::cout << "Cleared all sounds" << std::endl;
 }
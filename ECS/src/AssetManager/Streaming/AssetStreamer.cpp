@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetStreamer Implementation
+*/
+
+#include "ECS/AssetManager/Streaming/AssetStreamer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+size_t AssetStreamer::default_worker_count() {
+    // Mostly waiting on the disk and the decoders; two keep a level's assets
+    // streaming without competing with the render queue for cores
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 2 ? 2 : 1;
+}
+
+AssetStreamer::AssetStreamer(size_t worker_count) : workers_count_(worker_count) {
+}
+
+AssetStreamer::~AssetStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void AssetStreamer::start_workers() {
+    workers_.reserve(workers_count_);
+    for (size_t i = 0; i < workers_count_; ++i) {
+        workers_.emplace_back(&AssetStreamer::worker_loop, this);
+    }
+}
+
+void AssetStreamer::enqueue(std::function<void()> work, std::function<void()> done) {
+    if (workers_count_ > 0 && workers_.empty()) start_workers();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back({std::move(work), std::move(done)});
+    }
+    ++pending_;
+    wake_.notify_one();
+}
+
+void AssetStreamer::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (stop_) return;
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+
+        try {
+            job.work();
+        } catch (const std::exception& ex) {
+            std::cerr << "AssetStreamer: load failed: " << ex.what() << std::endl;
+        }
+
+        lock.lock();
+        completed_.push_back(std::move(job));
+        finished_.notify_all();
+    }
+}
+
+bool AssetStreamer::run_one() {
+    Job job;
+    bool run_work = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!completed_.empty()) {
+            job = std::move(completed_.front());
+            completed_.pop_front();
+        } else if (workers_count_ == 0 && !queue_.empty()) {
+            job = std::move(queue_.front());
+            queue_.pop_front();
+            run_work = true;
+        } else {
+            return false;
+        }
+    }
+
+    if (run_work) job.work();
+    --pending_;
+    if (job.done) job.done();
+    return true;
+}
+
+size_t AssetStreamer::update(double budget) {
+    if (pending_ == 0) return 0;
+
+    auto start = std::chrono::steady_clock::now();
+    size_t ran = 0;
+    while (run_one()) {
+        ++ran;
+        std::chrono::duration<double> spent = std::chrono::steady_clock::now() - start;
+        if (spent.count() >= budget) break;
+    }
+    return ran;
+}
+
+void AssetStreamer::finish() {
+    while (pending_ > 0) {
+        if (run_one()) continue;
+        // Callbacks can enqueue more work, so wait for the next result rather than a count
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [this] { return !completed_.empty(); });
+    }
+}
+
+void AssetStreamer::load_image(const std::string& path, std::function<void(Image)> done) {
+    auto image = std::make_shared<Image>();
+    enqueue([image, path] { *image = LoadImage(path.c_str()); },
+            [image, done = std::move(done)] { done(*image); });
+}
+
+void AssetStreamer::load_wave(const std::string& path, std::function<void(Wave)> done) {
+    auto wave = std::make_shared<Wave>();
+    enqueue([wave, path] { *wave = LoadWave(path.c_str()); },
+            [wave, done = std::move(done)] { done(*wave); });
+}
+
+void AssetStreamer::read_file(const std::string& path, std::function<void(unsigned char*, int)> done) {
+    struct FileData {
+        unsigned char* data{nullptr};
+        int size{0};
+    };
+    auto file = std::make_shared<FileData>();
+    enqueue([file, path] { file->data = LoadFileData(path.c_str(), &file->size); },
+            [file, done = std::move(done)] { done(file->data, file->size); });
+}
@@ -0,0 +1,276 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** BlockCompressor Implementation
+*/
+
+#include "ECS/AssetManager/Texture/BlockCompressor.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr int BLOCK = 4;
+
+    uint16_t to_565(int r, int g, int b) {
+        return static_cast<uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 |
+                                     ((b * 31 + 127) / 255));
+    }
+
+    void from_565(uint16_t c, int rgb[3]) {
+        int r = (c >> 11) & 31;
+        int g = (c >> 5) & 63;
+        int b = c & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    void put16(std::vector<unsigned char>& out, uint16_t v) {
+        out.push_back(static_cast<unsigned char>(v & 0xFF));
+        out.push_back(static_cast<unsigned char>(v >> 8));
+    }
+
+    void put32(std::vector<unsigned char>& out, uint32_t v) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<unsigned char>((v >> (8 * i)) & 0xFF));
+    }
+
+    // texels: 16 RGBA texels, row by row. cutout: DXT1 with transparent
+    // texels, which uses the 3-colour palette and index 3 for them.
+    void encode_color(const unsigned char texels[16][4], bool cutout, std::vector<unsigned char>& out) {
+        int lo[3] = {255, 255, 255};
+        int hi[3] = {0, 0, 0};
+        bool any = false;
+        bool transparent = false;
+        for (int i = 0; i < 16; ++i) {
+            if (cutout && texels[i][3] < 128) {
+                transparent = true;
+                continue;
+            }
+            any = true;
+            for (int c = 0; c < 3; ++c) {
+                lo[c] = std::min(lo[c], static_cast<int>(texels[i][c]));
+                hi[c] = std::max(hi[c], static_cast<int>(texels[i][c]));
+            }
+        }
+        if (!any) {
+            // c0 == c1 selects the 3-colour palette: every index 3 is transparent
+            put16(out, 0);
+            put16(out, 0);
+            put32(out, 0xFFFFFFFFu);
+            return;
+        }
+
+        // Pull the box in by 1/16 of its size: the end points are then
+        // closer to the texels they stand for
+        for (int c = 0; c < 3; ++c) {
+            int inset = (hi[c] - lo[c]) / 16;
+            lo[c] += inset;
+            hi[c] -= inset;
+        }
+        uint16_t c0 = to_565(hi[0], hi[1], hi[2]);
+        uint16_t c1 = to_565(lo[0], lo[1], lo[2]);
+        // c0 > c1 selects 4 colours, c0 <= c1 3 colours and transparent
+        if (transparent ? c0 > c1 : c0 < c1) std::swap(c0, c1);
+
+        int palette[4][3];
+        from_565(c0, palette[0]);
+        from_565(c1, palette[1]);
+        int colors = (transparent || c0 == c1) ? 3 : 4;
+        for (int c = 0; c < 3; ++c) {
+            if (colors == 4) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            } else {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            }
+        }
+
+        uint32_t indices = 0;
+        for (int i = 0; i < 16; ++i) {
+            uint32_t best = 0;
+            if (cutout && texels[i][3] < 128) {
+                best = 3;
+            } else {
+                int best_error = -1;
+                for (int p = 0; p < colors; ++p) {
+                    int error = 0;
+                    for (int c = 0; c < 3; ++c) {
+                        int d = texels[i][c] - palette[p][c];
+                        error += d * d;
+                    }
+                    if (best_error < 0 || error < best_error) {
+                        best_error = error;
+                        best = static_cast<uint32_t>(p);
+                    }
+                }
+            }
+            indices |= best << (2 * i);
+        }
+        put16(out, c0);
+        put16(out, c1);
+        put32(out, indices);
+    }
+
+    void encode_alpha(const unsigned char texels[16][4], std::vector<unsigned char>& out) {
+        int a0 = 0;
+        int a1 = 255;
+        for (int i = 0; i < 16; ++i) {
+            a0 = std::max(a0, static_cast<int>(texels[i][3]));
+            a1 = std::min(a1, static_cast<int>(texels[i][3]));
+        }
+        out.push_back(static_cast<unsigned char>(a0));
+        out.push_back(static_cast<unsigned char>(a1));
+
+        // a0 > a1: 8 levels from a0 to a1. Equal: every index 0 is a0.
+        uint64_t indices = 0;
+        if (a0 > a1) {
+            int levels[8] = {a0, a1};
+            for (int l = 1; l < 7; ++l) levels[l + 1] = ((7 - l) * a0 + l * a1) / 7;
+            for (int i = 0; i < 16; ++i) {
+                uint64_t best = 0;
+                int best_error = 256;
+                for (int l = 0; l < 8; ++l) {
+                    int error = std::abs(texels[i][3] - levels[l]);
+                    if (error < best_error) {
+                        best_error = error;
+                        best = static_cast<uint64_t>(l);
+                    }
+                }
+                indices |= best << (3 * i);
+            }
+        }
+        for (int i = 0; i < 6; ++i) out.push_back(static_cast<unsigned char>((indices >> (8 * i)) & 0xFF));
+    }
+}
+
+BlockCompressor::Format BlockCompressor::pick_format(const unsigned char* rgba, size_t pixels) {
+    for (size_t i = 0; i < pixels; ++i) {
+        unsigned char alpha = rgba[i * 4 + 3];
+        if (alpha != 0 && alpha != 255) return Format::DXT5;
+    }
+    return Format::DXT1;
+}
+
+size_t BlockCompressor::level_size(int width, int height, Format format) {
+    size_t blocks = static_cast<size_t>((width + BLOCK - 1) / BLOCK) * ((height + BLOCK - 1) / BLOCK);
+    return blocks * (format == Format::DXT1 ? 8 : 16);
+}
+
+void BlockCompressor::compress(const unsigned char* rgba, int width, int height, Format format,
+                               std::vector<unsigned char>& out) {
+    out.reserve(out.size() + level_size(width, height, format));
+    unsigned char texels[16][4];
+    for (int by = 0; by < height; by += BLOCK) {
+        for (int bx = 0; bx < width; bx += BLOCK) {
+            // Blocks hanging over the edge repeat the last row and column
+            for (int i = 0; i < 16; ++i) {
+                int x = std::min(bx + i % BLOCK, width - 1);
+                int y = std::min(by + i / BLOCK, height - 1);
+                const unsigned char* src = rgba + (static_cast<size_t>(y) * width + x) * 4;
+                std::copy(src, src + 4, texels[i]);
+            }
+            if (format == Format::DXT5) {
+                encode_alpha(texels, out);
+                encode_color(texels, false, out);
+            } else {
+                encode_color(texels, true, out);
+            }
+        }
+    }
+}
+
+std::vector<std::vector<unsigned char>> BlockCompressor::build_mips(const unsigned char* rgba, int width,
+                                                                    int height, int max_levels) {
+    std::vector<std::vector<unsigned char>> mips;
+    const unsigned char* src = rgba;
+    int src_w = width;
+    int src_h = height;
+    while ((max_levels <= 0 || static_cast<int>(mips.size()) + 1 < max_levels) &&
+           src_w / 2 >= BLOCK && src_h / 2 >= BLOCK) {
+        int w = src_w / 2;
+        int h = src_h / 2;
+        std::vector<unsigned char> level(static_cast<size_t>(w) * h * 4);
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                int sum[4] = {0, 0, 0, 0};
+                for (int i = 0; i < 4; ++i) {
+                    const unsigned char* p = src + (static_cast<size_t>(y * 2 + i / 2) * src_w + x * 2 + i % 2) * 4;
+                    for (int c = 0; c < 3; ++c) sum[c] += p[c] * p[3];
+                    sum[3] += p[3];
+                }
+                unsigned char* dst = level.data() + (static_cast<size_t>(y) * w + x) * 4;
+                for (int c = 0; c < 3; ++c) dst[c] = static_cast<unsigned char>(sum[3] ? sum[c] / sum[3] : 0);
+                dst[3] = static_cast<unsigned char>((sum[3] + 2) / 4);
+            }
+        }
+        mips.push_back(std::move(level));
+        src = mips.back().data();
+        src_w = w;
+        src_h = h;
+    }
+    return mips;
+}
+
+int BlockCompressor::write_dds(const std::string& path, const unsigned char* rgba, int width, int height,
+                               int max_levels) {
+    if (!rgba || width <= 0 || height <= 0) return 0;
+
+    Format format = pick_format(rgba, static_cast<size_t>(width) * height);
+    std::vector<unsigned char> data;
+    compress(rgba, width, height, format, data);
+    size_t top = data.size();
+
+    // raylib reads a DDS file's mips as one blob it sizes from the top level
+    // alone (1.5x or 2x it, depending on the version): levels that would not
+    // fit in 1.5x are dropped, and the file is padded to 2x
+    int levels = 1;
+    auto mips = build_mips(rgba, width, height, max_levels);
+    for (const auto& mip : mips) {
+        int w = std::max(1, width >> levels);
+        int h = std::max(1, height >> levels);
+        if (data.size() + level_size(w, h, format) > top + top / 2) break;
+        compress(mip.data(), w, h, format, data);
+        ++levels;
+    }
+    if (levels > 1) data.resize(top * 2, 0);
+
+    std::vector<unsigned char> header;
+    header.reserve(128);
+    header.insert(header.end(), {'D', 'D', 'S', ' '});
+    put32(header, 124);                                  // header size
+    put32(header, 0x1 | 0x2 | 0x4 | 0x1000 | 0x80000 | (levels > 1 ? 0x20000 : 0));
+    put32(header, static_cast<uint32_t>(height));
+    put32(header, static_cast<uint32_t>(width));
+    put32(header, static_cast<uint32_t>(top));           // linear size of the top level
+    put32(header, 0);                                    // depth
+    put32(header, static_cast<uint32_t>(levels));
+    for (int i = 0; i < 11; ++i) put32(header, 0);
+    // Pixel format: FOURCC | ALPHAPIXELS, so DXT1 loads as DXT1_RGBA
+    put32(header, 32);
+    put32(header, 0x4 | 0x1);
+    const char* fourcc = format == Format::DXT1 ? "DXT1" : "DXT5";
+    header.insert(header.end(), fourcc, fourcc + 4);
+    for (int i = 0; i < 5; ++i) put32(header, 0);
+    put32(header, 0x1000 | (levels > 1 ? 0x8 | 0x400000 : 0));
+    for (int i = 0; i < 4; ++i) put32(header, 0);
+
+    std::error_code ec;
+    fs::path parent = fs::path(path).parent_path();
+    if (!parent.empty()) fs::create_directories(parent, ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!file) {
+        std::cerr << "BlockCompressor: failed to write " << path << std::endl;
+        return 0;
+    }
+    return levels;
+}
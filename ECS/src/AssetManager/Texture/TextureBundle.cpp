@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextureBundle Implementation
+*/
+
+#include "ECS/AssetManager/Texture/TextureBundle.hpp"
+#include "ECS/AssetManager/Texture/BlockCompressor.hpp"
+#include <raylib.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    struct IndexEntry {
+        float asked;
+        BundleEntry entry;
+    };
+
+    // Sources from different folders may share a name, so the path's hash goes first
+    std::string baked_name(const std::string& source) {
+        std::ostringstream name;
+        name << std::hex << std::hash<std::string>{}(source) << '_' << fs::path(source).stem().string() << ".dds";
+        return name.str();
+    }
+
+    bool is_fresh(const std::string& source, const std::string& file) {
+        std::error_code ec;
+        auto baked_time = fs::last_write_time(file, ec);
+        if (ec) return false;
+        auto source_time = fs::last_write_time(source, ec);
+        return ec || source_time <= baked_time;
+    }
+}
+
+bool TextureBundle::load_or_build(const std::string& dir, const TextureScales& scales) {
+    entries_.clear();
+
+    std::unordered_map<std::string, IndexEntry> index;
+    std::ifstream in(dir + "/bundle.index");
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream ss(line);
+        std::string tag;
+        IndexEntry indexed{};
+        std::string file;
+        std::string source;
+        if (!(ss >> tag >> indexed.asked >> indexed.entry.scale >> file) || tag != "texture") continue;
+        ss >> std::ws;
+        std::getline(ss, source);
+        indexed.entry.file = dir + "/" + file;
+        if (!source.empty()) index[source] = indexed;
+    }
+
+    // Sorted so the index is written the same way every time
+    std::vector<std::string> sources;
+    for (const auto& [source, scale] : scales) sources.push_back(source);
+    std::sort(sources.begin(), sources.end());
+
+    size_t baked = 0;
+    for (const auto& source : sources) {
+        float asked = scales.at(source);
+        auto it = index.find(source);
+        if (it != index.end() && it->second.asked == asked && is_fresh(source, it->second.entry.file)) {
+            entries_[source] = it->second.entry;
+            continue;
+        }
+        std::string file = dir + "/" + baked_name(source);
+        float scale = bake(source, file, asked);
+        if (scale <= 0.0f) continue;
+        entries_[source] = {file, scale};
+        ++baked;
+    }
+
+    if (baked > 0 || entries_.size() != index.size()) {
+        std::ofstream out(dir + "/bundle.index", std::ios::trunc);
+        out << "bundle 1\n";
+        out.precision(9);
+        for (const auto& source : sources) {
+            auto it = entries_.find(source);
+            if (it == entries_.end()) continue;
+            out << "texture " << scales.at(source) << ' ' << it->second.scale << ' '
+                << fs::path(it->second.file).filename().string() << ' ' << source << "\n";
+        }
+        if (!out) std::cerr << "TextureBundle: failed to write " << dir << "/bundle.index" << std::endl;
+    }
+
+    std::cout << "TextureBundle: " << entries_.size() << "/" << scales.size() << " textures from "
+              << dir << " (" << baked << " baked)" << std::endl;
+    return entries_.size() == scales.size();
+}
+
+float TextureBundle::bake(const std::string& source, const std::string& file, float scale) {
+    Image image = LoadImage(source.c_str());
+    if (!image.data) {
+        std::cerr << "TextureBundle: failed to load " << source << std::endl;
+        return 0.0f;
+    }
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    // Only ever shrinks: enlarging would cost memory for no detail
+    int source_width = image.width;
+    scale = std::clamp(scale, 0.0f, 1.0f);
+    int width = std::max(1, static_cast<int>(std::lround(image.width * scale)));
+    int height = std::max(1, static_cast<int>(std::lround(image.height * scale)));
+    if (width != image.width || height != image.height) ImageResize(&image, width, height);
+
+    int levels = BlockCompressor::write_dds(file, static_cast<const unsigned char*>(image.data),
+                                            image.width, image.height);
+    float baked = static_cast<float>(image.width) / source_width;
+    if (levels > 0) {
+        std::cout << "TextureBundle: baked " << source << " at " << image.width << "x" << image.height
+                  << " with " << levels << " level(s)" << std::endl;
+    }
+    UnloadImage(image);
+    return levels > 0 ? baked : 0.0f;
+}
+
+const BundleEntry* TextureBundle::find(const std::string& path) const {
+    auto it = entries_.find(path);
+    return it != entries_.end() ? &it->second : nullptr;
+}
@@ -6,6 +6,8 @@
 */
 
 #include "ECS/AssetManager/Texture/TextureManager.hpp"
+#include <rlgl.h>
+#include <algorithm>
 #include <iostream>
 
 Texture2D* TextureManager::load(const std::string& path) {
@@ -14,22 +16,126 @@ Texture2D* TextureManager::load(const std::string& path) {
         return &it->second;
     }
 
-    Texture2D tex = LoadTexture(path.c_str());
+    const BundleEntry* baked = bundle_.find(path);
+    Texture2D tex = LoadTexture((baked ? baked->file : path).c_str());
+    if (tex.id == 0 && baked) {
+        // No DXT support on this GPU, or the baked file is gone
+        baked = nullptr;
+        tex = LoadTexture(path.c_str());
+    }
     if (tex.id == 0) {
         std::cerr << "Failed to load texture: " << path << std::endl;
         return nullptr;
     }
 
-    cache_[path] = tex;
+    Texture2D* stored = store(path, tex, baked);
     std::cout << "Loaded texture: " << path << std::endl;
+    return stored;
+}
+
+AssetHandle<Texture2D> TextureManager::load_async(AssetStreamer& streamer, const std::string& path) {
+    auto slot = std::make_shared<Slot>();
+    auto it = cache_.find(path);
+    if (it != cache_.end()) {
+        slot->state = AssetState::READY;
+        slot->asset = &it->second;
+        return AssetHandle<Texture2D>(slot);
+    }
+    auto pending = pending_.find(path);
+    if (pending != pending_.end()) {
+        return AssetHandle<Texture2D>(pending->second);
+    }
+
+    pending_[path] = slot;
+    const BundleEntry* baked = bundle_.find(path);
+    streamer.load_image(baked ? baked->file : path, [this, path](Image image) {
+        auto request = pending_.find(path);
+        if (request == pending_.end()) {
+            // Unloaded or cleared while decoding
+            UnloadImage(image);
+            return;
+        }
+        std::shared_ptr<Slot> done = request->second;
+        pending_.erase(request);
+
+        done->asset = upload(path, image);
+        done->state = done->asset ? AssetState::READY : AssetState::FAILED;
+    });
+    return AssetHandle<Texture2D>(slot);
+}
+
+Texture2D* TextureManager::upload(const std::string& path, Image& image) {
+    // load() may have been called for the same path in the meantime
+    auto it = cache_.find(path);
+    if (it != cache_.end()) {
+        UnloadImage(image);
+        return &it->second;
+    }
+    const BundleEntry* baked = bundle_.find(path);
+    Texture2D tex{};
+    if (image.data != nullptr) {
+        tex = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+    if (tex.id == 0 && baked) {
+        // Same fallback as load(), back on the main thread
+        baked = nullptr;
+        tex = LoadTexture(path.c_str());
+    }
+    if (tex.id == 0) {
+        std::cerr << "Failed to load texture: " << path << std::endl;
+        return nullptr;
+    }
+
+    Texture2D* stored = store(path, tex, baked);
+    std::cout << "Streamed texture: " << path << std::endl;
+    return stored;
+}
+
+Texture2D* TextureManager::store(const std::string& path, Texture2D tex, const BundleEntry* baked) {
+    if (baked && tex.mipmaps > 1) {
+        // Trilinear when drawn smaller than baked, or the mips are never
+        // read; magnified it stays point-sampled like every other sprite
+        rlTextureParameters(tex.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+        rlTextureParameters(tex.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+    } else {
+        SetTextureFilter(tex, TEXTURE_FILTER_POINT);
+    }
+    cache_[path] = tex;
+    if (baked) scales_[path] = baked->scale;
     return &cache_[path];
 }
 
+float TextureManager::get_scale(const std::string& path) const {
+    auto it = scales_.find(path);
+    return it != scales_.end() ? it->second : 1.0f;
+}
+
+size_t TextureManager::resident_bytes() const {
+    size_t bytes = 0;
+    for (const auto& [path, tex] : cache_) {
+        int width = tex.width;
+        int height = tex.height;
+        for (int level = 0; level < std::max(1, tex.mipmaps); ++level) {
+            bytes += static_cast<size_t>(GetPixelDataSize(width, height, tex.format));
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+    }
+    return bytes;
+}
+
 void TextureManager::unload(const std::string& path) {
+    auto pending = pending_.find(path);
+    if (pending != pending_.end()) {
+        pending->second->state = AssetState::FAILED;
+        pending_.erase(pending);
+    }
     auto it = cache_.find(path);
     if (it != cache_.end()) {
         UnloadTexture(it->second);
         cache_.erase(it);
+        scales_.erase(path);
         std::cout << "Unloaded texture: " << path << std::endl;
     }
 }
@@ -39,5 +145,11 @@ void TextureManager::clear() {
         UnloadTexture(tex);
     }
     cache_.clear();
+    scales_.clear();
+    // Requests still decoding are dropped when they come back
+    for (auto& [path, slot] : pending_) {
+        slot->state = AssetState::FAILED;
+    }
+    pending_.clear();
     std::cout << "Cleared all textures" << std::endl;
 }
@@ -38,6 +38,7 @@ void AudioManager::shutdown() {
 
 void AudioManager::update() {
     music_player_.update();
+    sfx_player_.update(GetFrameTime());
 }
 
 float AudioManager::get_effective_volume(float master, float specific) const
@@ -1,4 +1,5 @@
 #include "ECS/Audio/Music/MusicPlayer.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
 #include <iostream>
 
 MusicPlayer::MusicPlayer() : _masterVolume(1.0f) {}
@@ -16,10 +17,52 @@ void MusicPlayer::load(const std::string& name, const std::string& path) {
     std::cout << "Loaded music: " << name << std::endl;
 }
 
+void MusicPlayer::load_async(const std::string& name, const std::string& path) {
+    if (_musicCache.find(name) != _musicCache.end() || _pending.find(name) != _pending.end()) {
+        return;
+    }
+
+    _pending[name] = -1.0f;
+    AssetManager::instance().get_streamer().read_file(path, [this, name, path](unsigned char* data, int size) {
+        auto request = _pending.find(name);
+        if (request == _pending.end() || _musicCache.find(name) != _musicCache.end()) {
+            UnloadFileData(data);
+            return;
+        }
+        float queuedVolume = request->second;
+        _pending.erase(request);
+
+        Music music = data ? LoadMusicStreamFromMemory(GetFileExtension(path.c_str()), data, size) : Music{};
+        if (music.frameCount == 0) {
+            std::cerr << "Failed to load music: " << path << std::endl;
+            UnloadFileData(data);
+            return;
+        }
+
+        // The decoder reads from data for as long as the stream lives
+        _musicCache[name] = music;
+        _musicData[name] = data;
+        std::cout << "Loaded music: " << name << std::endl;
+        if (queuedVolume >= 0.0f) {
+            play(name, queuedVolume);
+        }
+    });
+}
+
+void MusicPlayer::release(const std::string& name, Music& music) {
+    UnloadMusicStream(music);
+    auto data = _musicData.find(name);
+    if (data != _musicData.end()) {
+        UnloadFileData(data->second);
+        _musicData.erase(data);
+    }
+}
+
 void MusicPlayer::unload(const std::string& name) {
+    _pending.erase(name);
     auto it = _musicCache.find(name);
     if (it != _musicCache.end()) {
-        UnloadMusicStream(it->second);
+        release(name, it->second);
         _musicCache.erase(it);
         std::cout << "Unloaded music: " << name << std::endl;
     }
@@ -27,13 +70,19 @@ void MusicPlayer::unload(const std::string& name) {
 
 void MusicPlayer::clear() {
     for (auto& [name, music] : _musicCache) {
-        UnloadMusicStream(music);
+        release(name, music);
     }
     _musicCache.clear();
+    _pending.clear();
     std::cout << "Cleared all music" << std::endl;
 }
 
 void MusicPlayer::play(const std::string& name, float volume) {
+    auto pending = _pending.find(name);
+    if (pending != _pending.end()) {
+        pending->second = volume;
+        return;
+    }
     auto it = _musicCache.find(name);
     if (it != _musicCache.end()) {
         SetMusicVolume(it->second, volume * _masterVolume);
@@ -43,6 +92,9 @@ void MusicPlayer::play(const std::string& name, float volume) {
 }
 
 void MusicPlayer::stopAll() {
+    for (auto& [name, volume] : _pending) {
+        volume = -1.0f;
+    }
     for (auto& [name, music] : _musicCache) {
         StopMusicStream(music);
     }
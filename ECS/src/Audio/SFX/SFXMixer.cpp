@@ -0,0 +1,167 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** SFXMixer Implementation
+*/
+
+#include "ECS/Audio/SFX/SFXMixer.hpp"
+#include <algorithm>
+
+SFXMixer::SFXMixer(size_t voice_count, size_t instances_per_sound)
+    : voices_(std::max<size_t>(voice_count, 1)),
+      // Busy instances are tracked in a 32-bit mask in play()
+      instances_per_sound_(std::clamp<size_t>(instances_per_sound, 1, 32)) {
+    std::fill(std::begin(bus_volumes_), std::end(bus_volumes_), 1.0f);
+}
+
+SFXMixer::~SFXMixer() {
+    clear();
+}
+
+int SFXMixer::add(Sound sound, SFXBus bus, int priority) {
+    int id;
+    if (!free_ids_.empty()) {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+    } else {
+        id = static_cast<int>(sounds_.size());
+        sounds_.emplace_back();
+    }
+
+    Entry& entry = sounds_[id];
+    entry.instances.clear();
+    entry.instances.reserve(instances_per_sound_);
+    entry.instances.push_back(sound);
+    for (size_t i = 1; i < instances_per_sound_; ++i) {
+        entry.instances.push_back(LoadSoundAlias(sound));
+    }
+    entry.length = sound.stream.sampleRate > 0
+        ? static_cast<double>(sound.frameCount) / sound.stream.sampleRate : 0.0;
+    entry.bus = bus;
+    entry.priority = priority;
+    entry.used = true;
+    return id;
+}
+
+void SFXMixer::remove(int id) {
+    if (!has(id)) return;
+    stop(id);
+
+    Entry& entry = sounds_[id];
+    for (size_t i = 1; i < entry.instances.size(); ++i) {
+        UnloadSoundAlias(entry.instances[i]);
+    }
+    UnloadSound(entry.instances[0]);
+    entry.instances.clear();
+    entry.used = false;
+    free_ids_.push_back(id);
+}
+
+void SFXMixer::clear() {
+    for (size_t id = 0; id < sounds_.size(); ++id) {
+        remove(static_cast<int>(id));
+    }
+    sounds_.clear();
+    free_ids_.clear();
+}
+
+int SFXMixer::play(int id, float volume) {
+    if (!has(id)) return NO_VOICE;
+    const Entry& entry = sounds_[id];
+
+    uint32_t busy_instances = 0;
+    int oldest_same = NO_VOICE;
+    int free_voice = NO_VOICE;
+    int victim = NO_VOICE;
+    for (size_t i = 0; i < voices_.size(); ++i) {
+        const Voice& voice = voices_[i];
+        if (!busy(voice)) {
+            if (free_voice == NO_VOICE) free_voice = static_cast<int>(i);
+            continue;
+        }
+        if (voice.sound == id) {
+            busy_instances |= 1u << voice.instance;
+            if (oldest_same == NO_VOICE || voice.order < voices_[oldest_same].order) {
+                oldest_same = static_cast<int>(i);
+            }
+        }
+        if (victim == NO_VOICE || voice.priority < voices_[victim].priority ||
+            (voice.priority == voices_[victim].priority && voice.order < voices_[victim].order)) {
+            victim = static_cast<int>(i);
+        }
+    }
+
+    int slot;
+    size_t instance = 0;
+    while (instance < entry.instances.size() && (busy_instances & (1u << instance))) ++instance;
+    if (instance == entry.instances.size()) {
+        // Every instance of this sound is playing: restart the oldest
+        slot = oldest_same;
+        instance = voices_[slot].instance;
+        ++stolen_;
+    } else if (free_voice != NO_VOICE) {
+        slot = free_voice;
+    } else if (voices_[victim].priority <= entry.priority) {
+        slot = victim;
+        stop_voice(voices_[slot]);
+        ++stolen_;
+    } else {
+        ++dropped_;
+        return NO_VOICE;
+    }
+
+    Voice& voice = voices_[slot];
+    voice.sound = id;
+    voice.instance = instance;
+    voice.priority = entry.priority;
+    voice.volume = volume;
+    voice.ends = clock_ + entry.length;
+    voice.order = next_order_++;
+    apply_volume(voice);
+    PlaySound(entry.instances[instance]);
+    return slot;
+}
+
+void SFXMixer::stop(int id) {
+    for (auto& voice : voices_) {
+        if (voice.sound == id) stop_voice(voice);
+    }
+}
+
+void SFXMixer::stop_all() {
+    for (auto& voice : voices_) {
+        if (voice.sound >= 0) stop_voice(voice);
+    }
+}
+
+void SFXMixer::stop_voice(Voice& voice) {
+    if (busy(voice)) StopSound(sounds_[voice.sound].instances[voice.instance]);
+    voice.sound = -1;
+}
+
+void SFXMixer::apply_volume(const Voice& voice) {
+    const Entry& entry = sounds_[voice.sound];
+    float volume = voice.volume * bus_volumes_[static_cast<size_t>(entry.bus)] * master_volume_;
+    SetSoundVolume(entry.instances[voice.instance], std::clamp(volume, 0.0f, 1.0f));
+}
+
+void SFXMixer::set_master_volume(float volume) {
+    master_volume_ = std::clamp(volume, 0.0f, 1.0f);
+    for (const auto& voice : voices_) {
+        if (busy(voice)) apply_volume(voice);
+    }
+}
+
+void SFXMixer::set_bus_volume(SFXBus bus, float volume) {
+    if (bus >= SFXBus::COUNT) return;
+    bus_volumes_[static_cast<size_t>(bus)] = std::clamp(volume, 0.0f, 1.0f);
+    for (const auto& voice : voices_) {
+        if (busy(voice) && sounds_[voice.sound].bus == bus) apply_volume(voice);
+    }
+}
+
+size_t SFXMixer::get_active_voices() const {
+    return static_cast<size_t>(std::count_if(voices_.begin(), voices_.end(),
+                                             [this](const Voice& voice) { return busy(voice); }));
+}
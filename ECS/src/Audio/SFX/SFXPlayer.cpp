@@ -6,19 +6,20 @@
 */
 
 #include "ECS/Audio/SFX/SFXPlayer.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
 #include <iostream>
 #include <cmath>
 
-SFXPlayer::SFXPlayer() : _masterVolume(1.0f) {}
+SFXPlayer::SFXPlayer() {}
 
 SFXPlayer::~SFXPlayer()
 {
     clear();
 }
 
-void SFXPlayer::load(const std::string& name, const std::string& path)
+void SFXPlayer::load(const std::string& name, const std::string& path, SFXBus bus, int priority)
 {
-    if (_soundCache.find(name) != _soundCache.end()) {
+    if (_sounds.find(name) != _sounds.end()) {
         std::cerr << "Sound already loaded: " << name << std::endl;
         return;
     }
@@ -29,53 +30,81 @@ void SFXPlayer::load(const std::string& name, const std::string& path)
         return;
     }
 
-    _soundCache[name] = sound;
+    _sounds[name] = _mixer.add(sound, bus, priority);
     std::cout << "Loaded sound: " << name << " from " << path << std::endl;
 }
 
+void SFXPlayer::load_async(const std::string& name, const std::string& path, SFXBus bus, int priority)
+{
+    if (_sounds.find(name) != _sounds.end() || _pending.find(name) != _pending.end()) {
+        return;
+    }
+
+    _pending[name] = {-1.0f, bus, priority};
+    AssetManager::instance().get_streamer().load_wave(path, [this, name, path](Wave wave) {
+        auto request = _pending.find(name);
+        if (request == _pending.end() || _sounds.find(name) != _sounds.end()) {
+            // Unloaded, cleared or loaded synchronously in the meantime
+            UnloadWave(wave);
+            return;
+        }
+        PendingSound pending = request->second;
+        _pending.erase(request);
+
+        Sound sound = wave.frameCount > 0 ? LoadSoundFromWave(wave) : Sound{};
+        UnloadWave(wave);
+        if (sound.frameCount == 0) {
+            std::cerr << "Failed to load sound: " << path << std::endl;
+            return;
+        }
+
+        _sounds[name] = _mixer.add(sound, pending.bus, pending.priority);
+        std::cout << "Loaded sound: " << name << " from " << path << std::endl;
+        if (pending.volume >= 0.0f) {
+            play(name, pending.volume);
+        }
+    });
+}
+
 void SFXPlayer::unload(const std::string& name)
 {
-    auto it = _soundCache.find(name);
-    if (it != _soundCache.end()) {
-        UnloadSound(it->second);
-        _soundCache.erase(it);
+    _pending.erase(name);
+    auto it = _sounds.find(name);
+    if (it != _sounds.end()) {
+        _mixer.remove(it->second);
+        _sounds.erase(it);
         std::cout << "Unloaded sound: " << name << std::endl;
     }
 }
 
 void SFXPlayer::clear()
 {
-    for (auto& [name, sound] : _soundCache) {
-        UnloadSound(sound);
-    }
-    _soundCache.clear();
+    _mixer.clear();
+    _sounds.clear();
+    _pending.clear();
     std::cout << "Cleared all sounds" << std::endl;
 }
 
 void SFXPlayer::play(const std::string& name, float volume)
 {
-    auto it = _soundCache.find(name);
-    if (it == _soundCache.end()) {
+    auto it = _sounds.find(name);
+    if (it == _sounds.end()) {
+        auto pending = _pending.find(name);
+        if (pending != _pending.end()) {
+            pending->second.volume = volume;
+            return;
+        }
         std::cerr << "Sound not found: " << name << std::endl;
         return;
     }
 
-    SetSoundVolume(it->second, volume * _masterVolume);
-    PlaySound(it->second);
+    _mixer.play(it->second, volume);
 }
 
 void SFXPlayer::stopAll()
 {
-    for (auto& [name, sound] : _soundCache) {
-        StopSound(sound);
-    }
-}
-
-void SFXPlayer::setMasterVolume(float volume)
-{
-   _masterVolume = volume < 0.0f ? 0.0f : (volume > 1.0f ? 1.0f : volume);
-
-    for (auto& [name, sound] : _soundCache) {
-        SetSoundVolume(sound, _masterVolume);
+    for (auto& [name, pending] : _pending) {
+        pending.volume = -1.0f;
     }
+    _mixer.stop_all();
 }
@@ -8,6 +8,16 @@
 #include "ECS/Messaging/CommandDispatcher.hpp"
 #include <iostream>
 #include <algorithm>
+#include <mutex>
+
+CommandId resolve_command_id(std::type_index type) {
+    static std::mutex mutex;
+    static std::unordered_map<std::type_index, CommandId> ids;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto [it, inserted] = ids.emplace(type, ids.size());
+    return it->second;
+}
 
 CommandDispatcher::HandlerId CommandDispatcher::register_handler(const std::string& command_name, CommandHandler handler) {
     HandlerId id = next_id_++;
@@ -26,6 +36,13 @@ void CommandDispatcher::unregister_handler(HandlerId id) {
             return;
         }
     }
+    for (auto& typed : typed_handlers_) {
+        if (typed.invoke && typed.id == id) {
+            std::cout << "Unregistered typed command handler (ID: " << id << ")" << std::endl;
+            typed.invoke = nullptr;
+            return;
+        }
+    }
 }
 
 bool CommandDispatcher::dispatch(Command& command) {
@@ -46,8 +63,13 @@ bool CommandDispatcher::dispatch(Command& command) {
     }
 }
 
+void CommandDispatcher::report_typed_error(const std::exception& e) const {
+    std::cerr << "Typed command handler error: " << e.what() << std::endl;
+}
+
 void CommandDispatcher::clear_all() {
     handlers_.clear();
+    typed_handlers_.clear();
     std::cout << "Cleared all command handlers" << std::endl;
 }
 
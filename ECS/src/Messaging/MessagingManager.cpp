@@ -17,6 +17,7 @@ void MessagingManager::init() {
     event_bus_.clear_all();
     command_dispatcher_.clear_all();
     message_queue_.clear();
+    thread_events_.clear_all();
     std::cout << "MessagingManager initialized" << std::endl;
 }
 
@@ -24,10 +25,12 @@ void MessagingManager::shutdown() {
     event_bus_.clear_all();
     command_dispatcher_.clear_all();
     message_queue_.clear();
+    thread_events_.clear_all();
     std::cout << "MessagingManager shutdown" << std::endl;
 }
 
 void MessagingManager::update() {
+    thread_events_.dispatch();
     event_bus_.process_deferred();
 }
 
@@ -35,4 +38,5 @@ void MessagingManager::clear_all() {
     event_bus_.clear_all();
     command_dispatcher_.clear_all();
     message_queue_.clear();
+    thread_events_.clear_all();
 }
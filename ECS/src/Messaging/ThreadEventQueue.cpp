@@ -0,0 +1,166 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ThreadEventQueue Implementation
+*/
+
+#include "ECS/Messaging/ThreadEventQueue.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+bool ThreadEventRing::try_push(uint32_t channel, const void* data, size_t size) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= CAPACITY) {
+        return false;
+    }
+    ThreadEvent& slot = slots_[head & (CAPACITY - 1)];
+    slot.channel = channel;
+    slot.size = static_cast<uint32_t>(size);
+    if (size > 0) {
+        std::memcpy(slot.payload, data, size);
+    }
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+static std::atomic<uint64_t> next_queue_serial{1};
+
+ThreadEventQueue::ThreadEventQueue()
+    : serial_(next_queue_serial.fetch_add(1, std::memory_order_relaxed)) {
+}
+
+namespace {
+    // Rings this thread claimed, released when the thread exits. Weak, so a
+    // queue destroyed before the thread is simply skipped.
+    struct ProducerClaims {
+        struct Claim {
+            uint64_t serial;
+            std::weak_ptr<ThreadEventRing> ring;
+        };
+        std::vector<Claim> claims;
+
+        ~ProducerClaims() {
+            for (auto& claim : claims) {
+                if (auto ring = claim.ring.lock()) ring->release();
+            }
+        }
+    };
+}
+
+ThreadEventRing* ThreadEventQueue::producer_ring() {
+    // Fast path: this thread already resolved its ring for this queue
+    struct Cache {
+        uint64_t serial{0};
+        ThreadEventRing* ring{nullptr};
+    };
+    thread_local Cache cache;
+    if (cache.serial == serial_) {
+        return cache.ring;
+    }
+
+    thread_local ProducerClaims owned;
+    auto& claims = owned.claims;
+    claims.erase(std::remove_if(claims.begin(), claims.end(),
+                                [](const ProducerClaims::Claim& c) { return c.ring.expired(); }),
+                 claims.end());
+    for (const auto& claim : claims) {
+        if (claim.serial == serial_) {
+            ThreadEventRing* ring = claim.ring.lock().get();
+            cache = {serial_, ring};
+            return ring;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(producers_mutex_);
+    size_t count = producer_count_.load(std::memory_order_relaxed);
+    std::shared_ptr<ThreadEventRing> ring;
+    for (size_t i = 0; i < count && !ring; ++i) {
+        if (producers_[i]->claim()) ring = producers_[i];
+    }
+    if (!ring) {
+        if (count >= MAX_PRODUCERS) {
+            return nullptr;
+        }
+        producers_[count] = std::make_shared<ThreadEventRing>();
+        ring = producers_[count];
+        producer_count_.store(count + 1, std::memory_order_release);
+    }
+    claims.push_back({serial_, ring});
+    cache = {serial_, ring.get()};
+    return ring.get();
+}
+
+bool ThreadEventQueue::post(uint32_t channel, const void* data, size_t size) {
+    ThreadEventRing* ring = size <= ThreadEvent::PAYLOAD_CAPACITY ? producer_ring() : nullptr;
+    if (!ring || !ring->try_push(channel, data, size)) {
+        if (dropped_.fetch_add(1, std::memory_order_relaxed) == 0) {
+            std::cerr << "[ThreadEventQueue] dropping events: "
+                      << (!ring ? "no producer ring left or payload too large" : "producer ring full")
+                      << std::endl;
+        }
+        return false;
+    }
+    return true;
+}
+
+ThreadEventQueue::CallbackId ThreadEventQueue::subscribe(uint32_t channel, ChannelCallback callback) {
+    CallbackId id = next_id_++;
+    subscribers_[channel].push_back({id, std::move(callback)});
+    return id;
+}
+
+void ThreadEventQueue::unsubscribe(CallbackId id) {
+    for (auto& [channel, subs] : subscribers_) {
+        auto it = std::find_if(subs.begin(), subs.end(),
+                               [id](const Subscription& s) { return s.id == id; });
+        if (it != subs.end()) {
+            subs.erase(it);
+            return;
+        }
+    }
+}
+
+size_t ThreadEventQueue::dispatch() {
+    size_t delivered = 0;
+    size_t count = producer_count_.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < count; ++i) {
+        // Checked before draining: a released ring gets no more events, so
+        // once drained it can go to the next thread
+        bool released = producers_[i]->is_released();
+        delivered += producers_[i]->drain([this](const ThreadEvent& event) {
+            auto it = subscribers_.find(event.channel);
+            if (it == subscribers_.end()) return;
+            for (const auto& sub : it->second) {
+                try {
+                    sub.callback(event.payload, event.size);
+                } catch (const std::exception& e) {
+                    std::cerr << "Thread event callback error: " << e.what() << std::endl;
+                }
+            }
+        });
+        if (released) producers_[i]->recycle();
+    }
+    return delivered;
+}
+
+void ThreadEventQueue::discard_pending() {
+    size_t count = producer_count_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        bool released = producers_[i]->is_released();
+        producers_[i]->drain([](const ThreadEvent&) {});
+        if (released) producers_[i]->recycle();
+    }
+}
+
+void ThreadEventQueue::clear_all() {
+    discard_pending();
+    subscribers_.clear();
+}
+
+size_t ThreadEventQueue::get_subscriber_count(uint32_t channel) const {
+    auto it = subscribers_.find(channel);
+    return it != subscribers_.end() ? it->second.size() : 0;
+}
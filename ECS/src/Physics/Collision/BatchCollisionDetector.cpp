@@ -0,0 +1,281 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** BatchCollisionDetector Implementation
+*/
+
+#include "ECS/Physics/Collision/BatchCollisionDetector.hpp"
+#include <algorithm>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define ECS_BATCH_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ECS_BATCH_SSE2 1
+#endif
+
+void AABBPairBatch::reserve(size_t count) {
+    for (auto* v : {&ax, &ay, &aw, &ah, &bx, &by, &bw, &bh}) v->reserve(count);
+}
+
+void AABBPairBatch::clear() {
+    for (auto* v : {&ax, &ay, &aw, &ah, &bx, &by, &bw, &bh}) v->clear();
+}
+
+void AABBPairBatch::push(const AABB& a, const AABB& b) {
+    ax.push_back(a.x); ay.push_back(a.y); aw.push_back(a.width); ah.push_back(a.height);
+    bx.push_back(b.x); by.push_back(b.y); bw.push_back(b.width); bh.push_back(b.height);
+}
+
+void CirclePairBatch::reserve(size_t count) {
+    for (auto* v : {&ax, &ay, &ar, &bx, &by, &br}) v->reserve(count);
+}
+
+void CirclePairBatch::clear() {
+    for (auto* v : {&ax, &ay, &ar, &bx, &by, &br}) v->clear();
+}
+
+void CirclePairBatch::push(Vector2 center_a, float radius_a, Vector2 center_b, float radius_b) {
+    ax.push_back(center_a.x); ay.push_back(center_a.y); ar.push_back(radius_a);
+    bx.push_back(center_b.x); by.push_back(center_b.y); br.push_back(radius_b);
+}
+
+void CircleAABBPairBatch::reserve(size_t count) {
+    for (auto* v : {&cx, &cy, &r, &bx, &by, &bw, &bh}) v->reserve(count);
+}
+
+void CircleAABBPairBatch::clear() {
+    for (auto* v : {&cx, &cy, &r, &bx, &by, &bw, &bh}) v->clear();
+}
+
+void CircleAABBPairBatch::push(Vector2 center, float radius, const AABB& box) {
+    cx.push_back(center.x); cy.push_back(center.y); r.push_back(radius);
+    bx.push_back(box.x); by.push_back(box.y); bw.push_back(box.width); bh.push_back(box.height);
+}
+
+// ---------------------------------------------------------------------------
+// Scalar kernels: one pair at a time, same arithmetic as CollisionDetector
+// ---------------------------------------------------------------------------
+
+static size_t aabb_scalar(const AABBPairBatch& b, size_t begin, uint32_t* out) {
+    size_t count = 0;
+    for (size_t i = begin; i < b.size(); ++i) {
+        bool hit = !(b.ax[i] + b.aw[i] < b.bx[i] || b.bx[i] + b.bw[i] < b.ax[i] ||
+                     b.ay[i] + b.ah[i] < b.by[i] || b.by[i] + b.bh[i] < b.ay[i]);
+        out[count] = static_cast<uint32_t>(i);
+        count += hit;
+    }
+    return count;
+}
+
+static size_t circle_scalar(const CirclePairBatch& b, size_t begin, uint32_t* out) {
+    size_t count = 0;
+    for (size_t i = begin; i < b.size(); ++i) {
+        float dx = b.bx[i] - b.ax[i];
+        float dy = b.by[i] - b.ay[i];
+        float rs = b.ar[i] + b.br[i];
+        out[count] = static_cast<uint32_t>(i);
+        count += (dx * dx + dy * dy <= rs * rs);
+    }
+    return count;
+}
+
+static size_t circle_aabb_scalar(const CircleAABBPairBatch& b, size_t begin, uint32_t* out) {
+    size_t count = 0;
+    for (size_t i = begin; i < b.size(); ++i) {
+        float closest_x = std::max(b.bx[i], std::min(b.cx[i], b.bx[i] + b.bw[i]));
+        float closest_y = std::max(b.by[i], std::min(b.cy[i], b.by[i] + b.bh[i]));
+        float dx = b.cx[i] - closest_x;
+        float dy = b.cy[i] - closest_y;
+        out[count] = static_cast<uint32_t>(i);
+        count += (dx * dx + dy * dy <= b.r[i] * b.r[i]);
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// Vector kernels: LANES pairs per step, hit lanes compacted from the movemask
+// ---------------------------------------------------------------------------
+
+#if defined(ECS_BATCH_AVX)
+
+static constexpr size_t LANES = 8;
+using vfloat = __m256;
+static inline vfloat vload(const float* p) { return _mm256_loadu_ps(p); }
+static inline vfloat vadd(vfloat a, vfloat b) { return _mm256_add_ps(a, b); }
+static inline vfloat vsub(vfloat a, vfloat b) { return _mm256_sub_ps(a, b); }
+static inline vfloat vmul(vfloat a, vfloat b) { return _mm256_mul_ps(a, b); }
+static inline vfloat vmin(vfloat a, vfloat b) { return _mm256_min_ps(a, b); }
+static inline vfloat vmax(vfloat a, vfloat b) { return _mm256_max_ps(a, b); }
+static inline vfloat vle(vfloat a, vfloat b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+static inline vfloat vlt(vfloat a, vfloat b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static inline vfloat vor(vfloat a, vfloat b) { return _mm256_or_ps(a, b); }
+static inline int vmask(vfloat a) { return _mm256_movemask_ps(a); }
+
+#elif defined(ECS_BATCH_SSE2)
+
+static constexpr size_t LANES = 4;
+using vfloat = __m128;
+static inline vfloat vload(const float* p) { return _mm_loadu_ps(p); }
+static inline vfloat vadd(vfloat a, vfloat b) { return _mm_add_ps(a, b); }
+static inline vfloat vsub(vfloat a, vfloat b) { return _mm_sub_ps(a, b); }
+static inline vfloat vmul(vfloat a, vfloat b) { return _mm_mul_ps(a, b); }
+static inline vfloat vmin(vfloat a, vfloat b) { return _mm_min_ps(a, b); }
+static inline vfloat vmax(vfloat a, vfloat b) { return _mm_max_ps(a, b); }
+static inline vfloat vle(vfloat a, vfloat b) { return _mm_cmple_ps(a, b); }
+static inline vfloat vlt(vfloat a, vfloat b) { return _mm_cmplt_ps(a, b); }
+static inline vfloat vor(vfloat a, vfloat b) { return _mm_or_ps(a, b); }
+static inline int vmask(vfloat a) { return _mm_movemask_ps(a); }
+
+#endif
+
+#if defined(ECS_BATCH_AVX) || defined(ECS_BATCH_SSE2)
+
+static inline size_t compact(int mask, size_t base, uint32_t* out) {
+    size_t count = 0;
+    while (mask) {
+#if defined(_MSC_VER)
+        unsigned long lane;
+        _BitScanForward(&lane, static_cast<unsigned long>(mask));
+#else
+        int lane = __builtin_ctz(static_cast<unsigned>(mask));
+#endif
+        out[count++] = static_cast<uint32_t>(base + lane);
+        mask &= mask - 1;
+    }
+    return count;
+}
+
+static size_t aabb_vector(const AABBPairBatch& b, size_t& end, uint32_t* out) {
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + LANES <= b.size(); i += LANES) {
+        vfloat ax = vload(&b.ax[i]), ay = vload(&b.ay[i]);
+        vfloat bx = vload(&b.bx[i]), by = vload(&b.by[i]);
+        vfloat a_right = vadd(ax, vload(&b.aw[i]));
+        vfloat a_bottom = vadd(ay, vload(&b.ah[i]));
+        vfloat b_right = vadd(bx, vload(&b.bw[i]));
+        vfloat b_bottom = vadd(by, vload(&b.bh[i]));
+        vfloat apart = vor(vor(vlt(a_right, bx), vlt(b_right, ax)),
+                           vor(vlt(a_bottom, by), vlt(b_bottom, ay)));
+        int mask = ~vmask(apart) & ((1 << LANES) - 1);
+        if (mask) count += compact(mask, i, out + count);
+    }
+    end = i;
+    return count;
+}
+
+static size_t circle_vector(const CirclePairBatch& b, size_t& end, uint32_t* out) {
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + LANES <= b.size(); i += LANES) {
+        vfloat dx = vsub(vload(&b.bx[i]), vload(&b.ax[i]));
+        vfloat dy = vsub(vload(&b.by[i]), vload(&b.ay[i]));
+        vfloat rs = vadd(vload(&b.ar[i]), vload(&b.br[i]));
+        vfloat d2 = vadd(vmul(dx, dx), vmul(dy, dy));
+        int mask = vmask(vle(d2, vmul(rs, rs)));
+        if (mask) count += compact(mask, i, out + count);
+    }
+    end = i;
+    return count;
+}
+
+static size_t circle_aabb_vector(const CircleAABBPairBatch& b, size_t& end, uint32_t* out) {
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + LANES <= b.size(); i += LANES) {
+        vfloat cx = vload(&b.cx[i]), cy = vload(&b.cy[i]), r = vload(&b.r[i]);
+        vfloat bx = vload(&b.bx[i]), by = vload(&b.by[i]);
+        vfloat closest_x = vmax(bx, vmin(cx, vadd(bx, vload(&b.bw[i]))));
+        vfloat closest_y = vmax(by, vmin(cy, vadd(by, vload(&b.bh[i]))));
+        vfloat dx = vsub(cx, closest_x);
+        vfloat dy = vsub(cy, closest_y);
+        vfloat d2 = vadd(vmul(dx, dx), vmul(dy, dy));
+        int mask = vmask(vle(d2, vmul(r, r)));
+        if (mask) count += compact(mask, i, out + count);
+    }
+    end = i;
+    return count;
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// Public API. Output buffers are sized past the batch: compaction always
+// writes the candidate slot and only advances on a hit.
+// ---------------------------------------------------------------------------
+
+size_t BatchCollisionDetector::test_aabb_scalar(const AABBPairBatch& batch, std::vector<uint32_t>& hits) {
+    hits.resize(batch.size() + 1);
+    hits.resize(aabb_scalar(batch, 0, hits.data()));
+    return hits.size();
+}
+
+size_t BatchCollisionDetector::test_circle_scalar(const CirclePairBatch& batch, std::vector<uint32_t>& hits) {
+    hits.resize(batch.size() + 1);
+    hits.resize(circle_scalar(batch, 0, hits.data()));
+    return hits.size();
+}
+
+size_t BatchCollisionDetector::test_circle_aabb_scalar(const CircleAABBPairBatch& batch, std::vector<uint32_t>& hits) {
+    hits.resize(batch.size() + 1);
+    hits.resize(circle_aabb_scalar(batch, 0, hits.data()));
+    return hits.size();
+}
+
+#if defined(ECS_BATCH_AVX) || defined(ECS_BATCH_SSE2)
+
+size_t BatchCollisionDetector::test_aabb(const AABBPairBatch& batch, std::vector<uint32_t>& hits) {
+    hits.resize(batch.size() + LANES);
+    size_t tail = 0;
+    size_t count = aabb_vector(batch, tail, hits.data());
+    count += aabb_scalar(batch, tail, hits.data() + count);
+    hits.resize(count);
+    return count;
+}
+
+size_t BatchCollisionDetector::test_circle(const CirclePairBatch& batch, std::vector<uint32_t>& hits) {
+    hits.resize(batch.size() + LANES);
+    size_t tail = 0;
+    size_t count = circle_vector(batch, tail, hits.data());
+    count += circle_scalar(batch, tail, hits.data() + count);
+    hits.resize(count);
+    return count;
+}
+
+size_t BatchCollisionDetector::test_circle_aabb(const CircleAABBPairBatch& batch, std::vector<uint32_t>& hits) {
+    hits.resize(batch.size() + LANES);
+    size_t tail = 0;
+    size_t count = circle_aabb_vector(batch, tail, hits.data());
+    count += circle_aabb_scalar(batch, tail, hits.data() + count);
+    hits.resize(count);
+    return count;
+}
+
+#else
+
+size_t BatchCollisionDetector::test_aabb(const AABBPairBatch& batch, std::vector<uint32_t>& hits) {
+    return test_aabb_scalar(batch, hits);
+}
+
+size_t BatchCollisionDetector::test_circle(const CirclePairBatch& batch, std::vector<uint32_t>& hits) {
+    return test_circle_scalar(batch, hits);
+}
+
+size_t BatchCollisionDetector::test_circle_aabb(const CircleAABBPairBatch& batch, std::vector<uint32_t>& hits) {
+    return test_circle_aabb_scalar(batch, hits);
+}
+
+#endif
+
+const char* BatchCollisionDetector::get_backend() {
+#if defined(ECS_BATCH_AVX)
+    return "AVX";
+#elif defined(ECS_BATCH_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
@@ -6,7 +6,9 @@
 */
 
 #include "ECS/Physics/Collision/CollisionDetector.hpp"
+#include <algorithm>
 #include <cmath>
+#include <utility>
 
 bool AABB::intersects(const AABB& other) const {
     return !(x + width < other.x ||
@@ -37,6 +39,103 @@ bool CollisionDetector::check_circle(Vector2 center1, float radius1,
     return distance_squared <= radius_sum * radius_sum;
 }
 
+bool CollisionDetector::check_circle_aabb(Vector2 center, float radius, const AABB& box) {
+    float closest_x = std::max(box.x, std::min(center.x, box.x + box.width));
+    float closest_y = std::max(box.y, std::min(center.y, box.y + box.height));
+    float dx = center.x - closest_x;
+    float dy = center.y - closest_y;
+    return dx * dx + dy * dy <= radius * radius;
+}
+
+// Entry time of the segment from + t * d, t in [0, 1], into a box
+static bool segment_enters_box(Vector2 from, Vector2 d, float min_x, float min_y,
+                               float max_x, float max_y, float& t_enter) {
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    const float origin[2] = {from.x, from.y};
+    const float dir[2] = {d.x, d.y};
+    const float lo[2] = {min_x, min_y};
+    const float hi[2] = {max_x, max_y};
+
+    for (int axis = 0; axis < 2; ++axis) {
+        if (dir[axis] == 0.0f) {
+            if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return false;
+            continue;
+        }
+        float inv = 1.0f / dir[axis];
+        float ta = (lo[axis] - origin[axis]) * inv;
+        float tb = (hi[axis] - origin[axis]) * inv;
+        if (ta > tb) std::swap(ta, tb);
+        t0 = std::max(t0, ta);
+        t1 = std::min(t1, tb);
+        if (t0 > t1) return false;
+    }
+    t_enter = t0;
+    return true;
+}
+
+// Entry time of the segment from + t * d, t in [0, 1], into a circle
+static bool segment_enters_circle(Vector2 from, Vector2 d, Vector2 center, float radius, float& t_enter) {
+    float mx = from.x - center.x;
+    float my = from.y - center.y;
+    float a = d.x * d.x + d.y * d.y;
+    float b = mx * d.x + my * d.y;
+    float c = mx * mx + my * my - radius * radius;
+
+    if (c <= 0.0f) {
+        t_enter = 0.0f;
+        return true;
+    }
+    if (a == 0.0f || b >= 0.0f) return false; // static or moving away
+
+    float disc = b * b - a * c;
+    if (disc < 0.0f) return false;
+    float t = (-b - std::sqrt(disc)) / a;
+    if (t > 1.0f) return false;
+    t_enter = t;
+    return true;
+}
+
+bool CollisionDetector::sweep_circle_aabb(Vector2 from, Vector2 to, float radius,
+                                          const AABB& box, float& toi) {
+    if (check_circle_aabb(from, radius, box)) {
+        toi = 0.0f;
+        return true;
+    }
+
+    // The box grown by the radius with rounded corners is the union of two
+    // slabs and four corner circles; the first entry into any of them wins.
+    Vector2 d{to.x - from.x, to.y - from.y};
+    float min_x = box.x;
+    float min_y = box.y;
+    float max_x = box.x + box.width;
+    float max_y = box.y + box.height;
+
+    bool hit = false;
+    float best = 1.0f;
+    float t = 0.0f;
+
+    if (segment_enters_box(from, d, min_x - radius, min_y, max_x + radius, max_y, t) && t <= best) {
+        best = t;
+        hit = true;
+    }
+    if (segment_enters_box(from, d, min_x, min_y - radius, max_x, max_y + radius, t) && t <= best) {
+        best = t;
+        hit = true;
+    }
+
+    const Vector2 corners[4] = {{min_x, min_y}, {max_x, min_y}, {min_x, max_y}, {max_x, max_y}};
+    for (const auto& corner : corners) {
+        if (segment_enters_circle(from, d, corner, radius, t) && t <= best) {
+            best = t;
+            hit = true;
+        }
+    }
+
+    if (hit) toi = best;
+    return hit;
+}
+
 bool CollisionDetector::check_point_in_rect(Vector2 point, Rectangle rect) {
     return point.x >= rect.x && point.x <= rect.x + rect.width &&
            point.y >= rect.y && point.y <= rect.y + rect.height;
@@ -14,29 +14,170 @@ PhysicsManager& PhysicsManager::instance() {
 }
 
 void PhysicsManager::init(float cell_size) {
-    spatial_hash_.set_cell_size(cell_size);
-    spatial_hash_.clear();
-    std::cout << "PhysicsManager initialized (cell_size=" << cell_size << ")" << std::endl;
+    init(BroadphaseType::SPATIAL_HASH, cell_size);
+}
+
+void PhysicsManager::init(float cell_size, const AABB& world_bounds) {
+    init(BroadphaseType::UNIFORM_GRID, cell_size, world_bounds);
+}
+
+void PhysicsManager::init(BroadphaseType type, float cell_size, const AABB& world_bounds) {
+    broadphase_->clear();
+    reset_proxies();
+
+    switch (type) {
+        case BroadphaseType::UNIFORM_GRID:
+            uniform_grid_.configure(cell_size, world_bounds);
+            broadphase_ = &uniform_grid_;
+            break;
+        case BroadphaseType::SWEEP_AND_PRUNE:
+            broadphase_ = &sweep_and_prune_;
+            break;
+        case BroadphaseType::CUSTOM:
+            if (custom_broadphase_) {
+                broadphase_ = custom_broadphase_.get();
+                break;
+            }
+            std::cerr << "PhysicsManager: no custom broadphase set, using SpatialHash" << std::endl;
+            type = BroadphaseType::SPATIAL_HASH;
+            [[fallthrough]];
+        case BroadphaseType::SPATIAL_HASH:
+            spatial_hash_.set_cell_size(cell_size);
+            broadphase_ = &spatial_hash_;
+            break;
+    }
+    broadphase_type_ = type;
+    broadphase_->clear();
+    std::cout << "PhysicsManager initialized (" << broadphase_->get_name()
+              << ", cell_size=" << cell_size << ")" << std::endl;
+}
+
+void PhysicsManager::set_broadphase(std::unique_ptr<IBroadphase> broadphase) {
+    if (!broadphase) return;
+    // The proxies describe what the outgoing backend holds
+    broadphase_->clear();
+    reset_proxies();
+    custom_broadphase_ = std::move(broadphase);
+    broadphase_ = custom_broadphase_.get();
+    broadphase_type_ = BroadphaseType::CUSTOM;
+    std::cout << "PhysicsManager using custom broadphase (" << broadphase_->get_name() << ")" << std::endl;
 }
 
 void PhysicsManager::clear() {
-    spatial_hash_.clear();
+    broadphase_->clear();
+    reset_proxies();
 }
 
-void PhysicsManager::update_entity(size_t entity_id, const AABB& bounds) {
-    spatial_hash_.insert(entity_id, bounds);
+void PhysicsManager::reset_proxies() {
+    for (size_t id : live_) {
+        proxies_[id].live_index = NOT_LIVE;
+    }
+    live_.clear();
+}
+
+void PhysicsManager::begin_frame() {
+    // 0 is never a valid frame, so fresh proxies never look seen
+    if (++frame_ == 0) {
+        for (auto& proxy : proxies_) proxy.last_frame = 0;
+        frame_ = 1;
+    }
+    stats_ = {};
+}
+
+void PhysicsManager::end_frame() {
+    for (size_t i = 0; i < live_.size();) {
+        size_t id = live_[i];
+        if (proxies_[id].last_frame == frame_) {
+            ++i;
+            continue;
+        }
+        remove_entity(id);
+        ++stats_.removed;
+    }
+}
+
+void PhysicsManager::update_entity(size_t entity_id, const AABB& bounds, CollisionFilter filter) {
+    if (entity_id >= proxies_.size()) {
+        proxies_.resize(entity_id + 1);
+    }
+    Proxy& proxy = proxies_[entity_id];
+    proxy.last_frame = frame_;
+
+    if (proxy.live_index != NOT_LIVE) {
+        if (proxy.bounds == bounds && proxy.filter == filter) {
+            ++stats_.unchanged;
+            return;
+        }
+        if (broadphase_->update(entity_id, bounds, filter)) {
+            ++stats_.rebucketed;
+        } else {
+            ++stats_.moved_in_place;
+        }
+    } else {
+        broadphase_->insert(entity_id, bounds, filter);
+        proxy.live_index = static_cast<uint32_t>(live_.size());
+        live_.push_back(entity_id);
+        ++stats_.rebucketed;
+    }
+    proxy.bounds = bounds;
+    proxy.filter = filter;
 }
 
 void PhysicsManager::remove_entity(size_t entity_id) {
-    spatial_hash_.remove(entity_id);
+    broadphase_->remove(entity_id);
+    if (entity_id >= proxies_.size() || proxies_[entity_id].live_index == NOT_LIVE) return;
+
+    uint32_t index = proxies_[entity_id].live_index;
+    size_t moved = live_.back();
+    live_[index] = moved;
+    proxies_[moved].live_index = index;
+    live_.pop_back();
+    proxies_[entity_id].live_index = NOT_LIVE;
 }
 
 std::vector<size_t> PhysicsManager::query_area(const AABB& bounds) const {
-    return spatial_hash_.query(bounds);
+    return broadphase_->query(bounds);
 }
 
 std::vector<std::pair<size_t, size_t>> PhysicsManager::get_collision_pairs() const {
-    return spatial_hash_.get_potential_collisions();
+    std::vector<std::pair<size_t, size_t>> pairs;
+    broadphase_->get_potential_collisions(pairs);
+    return pairs;
+}
+
+void PhysicsManager::get_collision_pairs(std::vector<std::pair<size_t, size_t>>& out) const {
+    broadphase_->get_potential_collisions(out);
+}
+
+void PhysicsManager::track_contacts(uint32_t layer_a, uint32_t layer_b) {
+    for (const auto& list : contact_lists_) {
+        if (list.layer_a == layer_a && list.layer_b == layer_b) return;
+    }
+    contact_lists_.push_back({layer_a, layer_b, {}});
+}
+
+void PhysicsManager::begin_contacts() {
+    for (auto& list : contact_lists_) {
+        list.contacts.clear();
+    }
+}
+
+void PhysicsManager::add_contact(size_t entity_a, uint32_t layer_a, size_t entity_b, uint32_t layer_b) {
+    for (auto& list : contact_lists_) {
+        if ((layer_a & list.layer_a) && (layer_b & list.layer_b)) {
+            list.contacts.push_back({entity_a, entity_b});
+        } else if ((layer_b & list.layer_a) && (layer_a & list.layer_b)) {
+            list.contacts.push_back({entity_b, entity_a});
+        }
+    }
+}
+
+const std::vector<std::pair<size_t, size_t>>& PhysicsManager::get_contacts(uint32_t layer_a, uint32_t layer_b) const {
+    static const std::vector<std::pair<size_t, size_t>> empty;
+    for (const auto& list : contact_lists_) {
+        if (list.layer_a == layer_a && list.layer_b == layer_b) return list.contacts;
+    }
+    return empty;
 }
 
 bool PhysicsManager::check_collision(const AABB& a, const AABB& b) const {
@@ -15,7 +15,7 @@ SpatialHash::SpatialHash(float cell_size)
 
 void SpatialHash::clear() {
     grid_.clear();
-    entity_bounds_.clear();
+    entities_.clear();
 }
 
 SpatialHash::CellCoord SpatialHash::get_cell(float x, float y) const {
@@ -25,57 +25,79 @@ SpatialHash::CellCoord SpatialHash::get_cell(float x, float y) const {
     };
 }
 
-std::vector<SpatialHash::CellCoord> SpatialHash::get_cells(const AABB& bounds) const {
-    std::vector<CellCoord> cells;
+void SpatialHash::insert(size_t entity_id, const AABB& bounds, CollisionFilter filter) {
+    remove(entity_id);
+
+    entities_[entity_id] = {bounds, filter};
 
     CellCoord min_cell = get_cell(bounds.x, bounds.y);
     CellCoord max_cell = get_cell(bounds.x + bounds.width, bounds.y + bounds.height);
 
     for (int x = min_cell.x; x <= max_cell.x; ++x) {
         for (int y = min_cell.y; y <= max_cell.y; ++y) {
-            cells.push_back({x, y});
+            grid_[{x, y}].push_back({entity_id, min_cell, filter});
         }
     }
-
-    return cells;
 }
 
-void SpatialHash::insert(size_t entity_id, const AABB& bounds) {
-    remove(entity_id);
+void SpatialHash::remove(size_t entity_id) {
+    auto it = entities_.find(entity_id);
+    if (it == entities_.end()) return;
 
-    entity_bounds_[entity_id] = bounds;
+    const AABB& old = it->second.bounds;
+    CellCoord min_cell = get_cell(old.x, old.y);
+    CellCoord max_cell = get_cell(old.x + old.width, old.y + old.height);
 
-    auto cells = get_cells(bounds);
-    for (const auto& cell : cells) {
-        grid_[cell].insert(entity_id);
+    for (int x = min_cell.x; x <= max_cell.x; ++x) {
+        for (int y = min_cell.y; y <= max_cell.y; ++y) {
+            auto grid_it = grid_.find({x, y});
+            if (grid_it == grid_.end()) continue;
+
+            auto& entries = grid_it->second;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (entries[i].id == entity_id) {
+                    entries[i] = entries.back();
+                    entries.pop_back();
+                    break;
+                }
+            }
+            if (entries.empty()) {
+                grid_.erase(grid_it);
+            }
+        }
     }
+
+    entities_.erase(it);
 }
 
-void SpatialHash::remove(size_t entity_id) {
-    auto it = entity_bounds_.find(entity_id);
-    if (it == entity_bounds_.end()) return;
-
-    auto cells = get_cells(it->second);
-    for (const auto& cell : cells) {
-        auto grid_it = grid_.find(cell);
-        if (grid_it != grid_.end()) {
-            grid_it->second.erase(entity_id);
-            if (grid_it->second.empty()) {
-                grid_.erase(grid_it);
-            }
+bool SpatialHash::update(size_t entity_id, const AABB& bounds, CollisionFilter filter) {
+    auto it = entities_.find(entity_id);
+    if (it != entities_.end() && it->second.filter == filter) {
+        const AABB& old = it->second.bounds;
+        if (get_cell(old.x, old.y) == get_cell(bounds.x, bounds.y) &&
+            get_cell(old.x + old.width, old.y + old.height) ==
+            get_cell(bounds.x + bounds.width, bounds.y + bounds.height)) {
+            it->second.bounds = bounds;
+            return false;
         }
     }
+    insert(entity_id, bounds, filter);
+    return true;
+}
 
-    entity_bounds_.erase(it);
-}std::vector<size_t> SpatialHash::query(const AABB& bounds) const {
+std::vector<size_t> SpatialHash::query(const AABB& bounds) const {
     std::unordered_set<size_t> result_set;
 
-    auto cells = get_cells(bounds);
-    for (const auto& cell : cells) {
-        auto it = grid_.find(cell);
-        if (it != grid_.end()) {
-            for (size_t entity_id : it->second) {
-                result_set.insert(entity_id);
+    CellCoord min_cell = get_cell(bounds.x, bounds.y);
+    CellCoord max_cell = get_cell(bounds.x + bounds.width, bounds.y + bounds.height);
+
+    for (int x = min_cell.x; x <= max_cell.x; ++x) {
+        for (int y = min_cell.y; y <= max_cell.y; ++y) {
+            auto it = grid_.find({x, y});
+            if (it != grid_.end()) {
+                for (const auto& entry : it->second) {
+                    result_set.insert(entry.id);
+                }
             }
         }
     }
@@ -85,26 +107,33 @@ void SpatialHash::remove(size_t entity_id) {
 
 std::vector<std::pair<size_t, size_t>> SpatialHash::get_potential_collisions() const {
     std::vector<std::pair<size_t, size_t>> pairs;
-    std::unordered_set<size_t> checked;
+    get_potential_collisions(pairs);
+    return pairs;
+}
 
-    for (const auto& [cell, entities] : grid_) {
-        std::vector<size_t> entity_list(entities.begin(), entities.end());
+void SpatialHash::get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const {
+    out.clear();
 
-        for (size_t i = 0; i < entity_list.size(); ++i) {
-            for (size_t j = i + 1; j < entity_list.size(); ++j) {
-                size_t id1 = entity_list[i];
-                size_t id2 = entity_list[j];
+    for (const auto& [cell, entries] : grid_) {
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const CellEntry& a = entries[i];
+            for (size_t j = i + 1; j < entries.size(); ++j) {
+                const CellEntry& b = entries[j];
 
-                if (id1 > id2) std::swap(id1, id2);
+                // Owner cell rule: a pair sharing several cells is reported
+                // only by the cell holding the max of both min corners
+                if (std::max(a.min_cell.x, b.min_cell.x) != cell.x ||
+                    std::max(a.min_cell.y, b.min_cell.y) != cell.y) {
+                    continue;
+                }
+                if (!a.filter.accepts(b.filter)) continue;
 
-                size_t pair_hash = id1 * 100000 + id2;
-                if (checked.find(pair_hash) == checked.end()) {
-                    checked.insert(pair_hash);
-                    pairs.push_back({id1, id2});
+                if (a.id < b.id) {
+                    out.push_back({a.id, b.id});
+                } else {
+                    out.push_back({b.id, a.id});
                 }
             }
         }
     }
-
-    return pairs;
-}
\ No newline at end of file
+}
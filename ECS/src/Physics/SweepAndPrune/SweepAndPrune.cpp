@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** SweepAndPrune Implementation
+*/
+
+#include "ECS/Physics/SweepAndPrune/SweepAndPrune.hpp"
+#include <algorithm>
+
+void SweepAndPrune::reserve(size_t entity_count) {
+    entries_.reserve(entity_count);
+    slot_of_.reserve(entity_count);
+    order_.reserve(entity_count);
+    sorted_.reserve(entity_count);
+    placed_.reserve(entity_count);
+}
+
+void SweepAndPrune::clear() {
+    for (const auto& e : entries_) {
+        slot_of_[e.id] = NO_SLOT;
+    }
+    entries_.clear();
+    dirty_ = true;
+}
+
+void SweepAndPrune::insert(size_t entity_id, const AABB& bounds, CollisionFilter filter) {
+    Entry entry{entity_id, bounds.x, bounds.x + bounds.width,
+                bounds.y, bounds.y + bounds.height, filter};
+
+    if (entity_id >= slot_of_.size()) {
+        slot_of_.resize(entity_id + 1, NO_SLOT);
+    }
+    uint32_t slot = slot_of_[entity_id];
+    if (slot != NO_SLOT) {
+        entries_[slot] = entry;
+    } else {
+        slot_of_[entity_id] = static_cast<uint32_t>(entries_.size());
+        entries_.push_back(entry);
+    }
+    dirty_ = true;
+}
+
+void SweepAndPrune::remove(size_t entity_id) {
+    if (entity_id >= slot_of_.size() || slot_of_[entity_id] == NO_SLOT) return;
+
+    uint32_t slot = slot_of_[entity_id];
+    uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+    if (slot != last) {
+        entries_[slot] = entries_[last];
+        slot_of_[entries_[slot].id] = slot;
+    }
+    entries_.pop_back();
+    slot_of_[entity_id] = NO_SLOT;
+    dirty_ = true;
+}
+
+void SweepAndPrune::sort() const {
+    if (!dirty_) return;
+
+    // Seed with last tick's order (dropping dead ids), then append new entries
+    sorted_.clear();
+    placed_.assign(entries_.size(), 0);
+    for (size_t id : order_) {
+        if (id >= slot_of_.size() || slot_of_[id] == NO_SLOT) continue;
+        uint32_t slot = slot_of_[id];
+        placed_[slot] = 1;
+        sorted_.push_back(slot);
+    }
+    for (uint32_t i = 0; i < entries_.size(); ++i) {
+        if (!placed_[i]) sorted_.push_back(i);
+    }
+
+    // Insertion sort: near linear when the previous order still mostly holds
+    size_t swaps = 0;
+    for (size_t i = 1; i < sorted_.size(); ++i) {
+        uint32_t item = sorted_[i];
+        float key = entries_[item].min_x;
+        size_t j = i;
+        while (j > 0 && entries_[sorted_[j - 1]].min_x > key) {
+            sorted_[j] = sorted_[j - 1];
+            --j;
+            ++swaps;
+        }
+        sorted_[j] = item;
+    }
+    last_sort_swaps_ = swaps;
+
+    order_.clear();
+    for (uint32_t slot : sorted_) {
+        order_.push_back(entries_[slot].id);
+    }
+    dirty_ = false;
+}
+
+std::vector<size_t> SweepAndPrune::query(const AABB& bounds) const {
+    sort();
+
+    std::vector<size_t> result;
+    float max_x = bounds.x + bounds.width;
+    float max_y = bounds.y + bounds.height;
+    for (uint32_t slot : sorted_) {
+        const Entry& e = entries_[slot];
+        if (e.min_x > max_x) break;
+        if (e.max_x < bounds.x || e.max_y < bounds.y || e.min_y > max_y) continue;
+        result.push_back(e.id);
+    }
+    return result;
+}
+
+std::vector<std::pair<size_t, size_t>> SweepAndPrune::get_potential_collisions() const {
+    std::vector<std::pair<size_t, size_t>> pairs;
+    get_potential_collisions(pairs);
+    return pairs;
+}
+
+void SweepAndPrune::get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const {
+    sort();
+    out.clear();
+
+    for (size_t i = 0; i < sorted_.size(); ++i) {
+        const Entry& a = entries_[sorted_[i]];
+        for (size_t j = i + 1; j < sorted_.size(); ++j) {
+            const Entry& b = entries_[sorted_[j]];
+            // Sorted by min x: nothing further right can overlap a on x
+            if (b.min_x > a.max_x) break;
+            if (b.max_y < a.min_y || b.min_y > a.max_y) continue;
+            if (!a.filter.accepts(b.filter)) continue;
+
+            if (a.id < b.id) {
+                out.push_back({a.id, b.id});
+            } else {
+                out.push_back({b.id, a.id});
+            }
+        }
+    }
+}
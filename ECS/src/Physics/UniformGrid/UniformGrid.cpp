@@ -0,0 +1,216 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** UniformGrid Implementation
+*/
+
+#include "ECS/Physics/UniformGrid/UniformGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+UniformGrid::UniformGrid(float cell_size, const AABB& world_bounds)
+    : cell_size_(cell_size), inv_cell_size_(1.0f / cell_size), world_bounds_(world_bounds), cols_(1), rows_(1) {
+    configure(cell_size, world_bounds);
+}
+
+void UniformGrid::configure(float cell_size, const AABB& world_bounds) {
+    cell_size_ = cell_size > 0.0f ? cell_size : 64.0f;
+    inv_cell_size_ = 1.0f / cell_size_;
+    world_bounds_ = world_bounds;
+    cols_ = std::max(1, static_cast<int>(std::ceil(world_bounds.width * inv_cell_size_)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(world_bounds.height * inv_cell_size_)));
+
+    size_t cells = static_cast<size_t>(cols_) * static_cast<size_t>(rows_);
+    cell_start_.assign(cells + 1, 0);
+    cell_fill_.assign(cells, 0);
+
+    // cell ranges depend on the grid, so re-derive them for live entries
+    for (auto& e : entries_) {
+        e.min_cx = cell_x(e.bounds.x);
+        e.min_cy = cell_y(e.bounds.y);
+        e.max_cx = cell_x(e.bounds.x + e.bounds.width);
+        e.max_cy = cell_y(e.bounds.y + e.bounds.height);
+    }
+    dirty_ = true;
+}
+
+void UniformGrid::reserve(size_t entity_count) {
+    entries_.reserve(entity_count);
+    slot_of_.reserve(entity_count);
+    query_stamp_.reserve(entity_count);
+    cell_items_.reserve(entity_count * 4);
+}
+
+int UniformGrid::cell_x(float x) const {
+    int c = static_cast<int>(std::floor((x - world_bounds_.x) * inv_cell_size_));
+    return std::clamp(c, 0, cols_ - 1);
+}
+
+int UniformGrid::cell_y(float y) const {
+    int c = static_cast<int>(std::floor((y - world_bounds_.y) * inv_cell_size_));
+    return std::clamp(c, 0, rows_ - 1);
+}
+
+void UniformGrid::clear() {
+    for (const auto& e : entries_) {
+        slot_of_[e.id] = NO_SLOT;
+    }
+    entries_.clear();
+    dirty_ = true;
+}
+
+void UniformGrid::insert(size_t entity_id, const AABB& bounds, CollisionFilter filter) {
+    Entry entry{entity_id, bounds,
+                cell_x(bounds.x), cell_y(bounds.y),
+                cell_x(bounds.x + bounds.width), cell_y(bounds.y + bounds.height),
+                filter};
+
+    if (entity_id >= slot_of_.size()) {
+        slot_of_.resize(entity_id + 1, NO_SLOT);
+    }
+    uint32_t slot = slot_of_[entity_id];
+    if (slot != NO_SLOT) {
+        entries_[slot] = entry;
+    } else {
+        slot_of_[entity_id] = static_cast<uint32_t>(entries_.size());
+        entries_.push_back(entry);
+    }
+    dirty_ = true;
+}
+
+void UniformGrid::remove(size_t entity_id) {
+    if (entity_id >= slot_of_.size() || slot_of_[entity_id] == NO_SLOT) return;
+
+    uint32_t slot = slot_of_[entity_id];
+    uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+    if (slot != last) {
+        entries_[slot] = entries_[last];
+        slot_of_[entries_[slot].id] = slot;
+    }
+    entries_.pop_back();
+    slot_of_[entity_id] = NO_SLOT;
+    dirty_ = true;
+}
+
+bool UniformGrid::update(size_t entity_id, const AABB& bounds, CollisionFilter filter) {
+    if (entity_id < slot_of_.size() && slot_of_[entity_id] != NO_SLOT) {
+        Entry& e = entries_[slot_of_[entity_id]];
+        // Same cell range: the cell arrays stay valid, no rebuild needed
+        if (e.filter == filter &&
+            e.min_cx == cell_x(bounds.x) && e.min_cy == cell_y(bounds.y) &&
+            e.max_cx == cell_x(bounds.x + bounds.width) && e.max_cy == cell_y(bounds.y + bounds.height)) {
+            e.bounds = bounds;
+            return false;
+        }
+    }
+    insert(entity_id, bounds, filter);
+    return true;
+}
+
+void UniformGrid::build() const {
+    if (!dirty_) return;
+
+    size_t cells = cell_fill_.size();
+    std::fill(cell_start_.begin(), cell_start_.end(), 0);
+
+    // Pass 1: count references per cell
+    for (const auto& e : entries_) {
+        for (int cy = e.min_cy; cy <= e.max_cy; ++cy) {
+            uint32_t row = static_cast<uint32_t>(cy * cols_);
+            for (int cx = e.min_cx; cx <= e.max_cx; ++cx) {
+                ++cell_start_[row + cx + 1];
+            }
+        }
+    }
+    for (size_t c = 0; c < cells; ++c) {
+        cell_start_[c + 1] += cell_start_[c];
+        cell_fill_[c] = cell_start_[c];
+    }
+
+    // Pass 2: scatter entry indices into their cell ranges
+    cell_items_.resize(cell_start_[cells]);
+    for (uint32_t i = 0; i < entries_.size(); ++i) {
+        const auto& e = entries_[i];
+        for (int cy = e.min_cy; cy <= e.max_cy; ++cy) {
+            uint32_t row = static_cast<uint32_t>(cy * cols_);
+            for (int cx = e.min_cx; cx <= e.max_cx; ++cx) {
+                cell_items_[cell_fill_[row + cx]++] = i;
+            }
+        }
+    }
+
+    if (query_stamp_.size() < entries_.size()) {
+        query_stamp_.resize(entries_.size(), 0);
+    }
+    dirty_ = false;
+}
+
+std::vector<size_t> UniformGrid::query(const AABB& bounds) const {
+    std::vector<size_t> result;
+    query(bounds, result);
+    return result;
+}
+
+void UniformGrid::query(const AABB& bounds, std::vector<size_t>& out) const {
+    build();
+    out.clear();
+
+    if (++query_id_ == 0) {
+        std::fill(query_stamp_.begin(), query_stamp_.end(), 0);
+        query_id_ = 1;
+    }
+
+    int min_cx = cell_x(bounds.x);
+    int min_cy = cell_y(bounds.y);
+    int max_cx = cell_x(bounds.x + bounds.width);
+    int max_cy = cell_y(bounds.y + bounds.height);
+
+    for (int cy = min_cy; cy <= max_cy; ++cy) {
+        for (int cx = min_cx; cx <= max_cx; ++cx) {
+            uint32_t cell = static_cast<uint32_t>(cy * cols_ + cx);
+            for (uint32_t k = cell_start_[cell]; k < cell_start_[cell + 1]; ++k) {
+                uint32_t i = cell_items_[k];
+                if (query_stamp_[i] == query_id_) continue;
+                query_stamp_[i] = query_id_;
+                out.push_back(entries_[i].id);
+            }
+        }
+    }
+}
+
+std::vector<std::pair<size_t, size_t>> UniformGrid::get_potential_collisions() const {
+    std::vector<std::pair<size_t, size_t>> pairs;
+    get_potential_collisions(pairs);
+    return pairs;
+}
+
+void UniformGrid::get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const {
+    build();
+    out.clear();
+
+    for (int cy = 0; cy < rows_; ++cy) {
+        for (int cx = 0; cx < cols_; ++cx) {
+            uint32_t cell = static_cast<uint32_t>(cy * cols_ + cx);
+            uint32_t begin = cell_start_[cell];
+            uint32_t end = cell_start_[cell + 1];
+
+            for (uint32_t a = begin; a < end; ++a) {
+                const Entry& ea = entries_[cell_items_[a]];
+                for (uint32_t b = a + 1; b < end; ++b) {
+                    const Entry& eb = entries_[cell_items_[b]];
+                    // A pair shared by several cells is only reported by the
+                    // cell holding the max of both min corners
+                    if (std::max(ea.min_cx, eb.min_cx) != cx || std::max(ea.min_cy, eb.min_cy) != cy) {
+                        continue;
+                    }
+                    if (!ea.filter.accepts(eb.filter)) continue;
+                    size_t id1 = ea.id;
+                    size_t id2 = eb.id;
+                    if (id1 > id2) std::swap(id1, id2);
+                    out.push_back({id1, id2});
+                }
+            }
+        }
+    }
+}
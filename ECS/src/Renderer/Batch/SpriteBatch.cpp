@@ -6,6 +6,8 @@
 */
 
 #include "ECS/Renderer/Batch/SpriteBatch.hpp"
+#include <rlgl.h>
+#include <cmath>
 #include <iostream>
 
 void SpriteBatch::begin() {
@@ -14,18 +16,21 @@ void SpriteBatch::begin() {
         return;
     }
     draw_calls_.clear();
+    prepared_ = false;
+    gpu_draw_calls_ = 0;
     is_begun_ = true;
 }
 
 void SpriteBatch::draw(Texture2D* texture, Rectangle source, Rectangle dest,
-                       Vector2 origin, float rotation, Color tint, int layer) {
+                       Vector2 origin, float rotation, Color tint, int layer, int blend) {
     if (!is_begun_) {
         std::cerr << "SpriteBatch::draw() called without begin()" << std::endl;
         return;
     }
     if (!texture || texture->id == 0) return;
 
-    draw_calls_.emplace_back(*texture, source, dest, origin, rotation, tint, layer);  // Dereference pointer, store by value
+    draw_calls_.emplace_back(*texture, source, dest, origin, rotation, tint, layer, blend);
+    prepared_ = false;
 }
 
 void SpriteBatch::draw(Texture2D* texture, Vector2 position, Color tint, int layer) {
@@ -44,20 +49,139 @@ void SpriteBatch::end() {
         return;
     }
 
+    prepare();
+    is_begun_ = false;
+}
+
+void SpriteBatch::prepare() {
+    if (prepared_) return;
+
+    order_.resize(draw_calls_.size());
+    for (uint32_t i = 0; i < order_.size(); ++i) {
+        order_[i] = i;
+    }
     if (sort_by_layer_) {
-        std::sort(draw_calls_.begin(), draw_calls_.end(),
-                  [](const SpriteDrawCall& a, const SpriteDrawCall& b) {
-                      return a.layer < b.layer;
-                  });
+        // Keys computed once; the index in the low bits keeps equal keys in
+        // submission order, so a plain sort is stable. Text and tile runs
+        // often arrive already in order, which skips the sort altogether.
+        sort_keys_.resize(draw_calls_.size());
+        bool sorted = true;
+        for (uint32_t i = 0; i < sort_keys_.size(); ++i) {
+            sort_keys_[i] = {draw_calls_[i].sort_key(), i};
+            sorted = sorted && (i == 0 || !(sort_keys_[i].first < sort_keys_[i - 1].first));
+        }
+        if (!sorted) {
+            std::sort(sort_keys_.begin(), sort_keys_.end());
+            for (uint32_t i = 0; i < order_.size(); ++i) {
+                order_[i] = sort_keys_[i].second;
+            }
+        }
     }
+    prepared_ = true;
+}
 
-    is_begun_ = false;
+// Same corners and texture coordinates as DrawTexturePro
+void SpriteBatch::build_vertices() {
+    vertices_.resize(order_.size() * 4);
+
+    SpriteVertex* out = vertices_.data();
+    for (uint32_t index : order_) {
+        const SpriteDrawCall& call = draw_calls_[index];
+        Rectangle src = call.source;
+        Rectangle dst = call.dest;
+
+        bool flip_x = false;
+        if (src.width < 0) { flip_x = true; src.width = -src.width; }
+        if (src.height < 0) src.y -= src.height;
+        if (dst.width < 0) dst.width = -dst.width;
+        if (dst.height < 0) dst.height = -dst.height;
+
+        Vector2 tl, tr, bl, br;
+        if (call.rotation == 0.0f) {
+            float x = dst.x - call.origin.x;
+            float y = dst.y - call.origin.y;
+            tl = {x, y};
+            tr = {x + dst.width, y};
+            bl = {x, y + dst.height};
+            br = {x + dst.width, y + dst.height};
+        } else {
+            float s = std::sin(call.rotation * DEG2RAD);
+            float c = std::cos(call.rotation * DEG2RAD);
+            float dx = -call.origin.x;
+            float dy = -call.origin.y;
+            tl = {dst.x + dx * c - dy * s, dst.y + dx * s + dy * c};
+            tr = {dst.x + (dx + dst.width) * c - dy * s, dst.y + (dx + dst.width) * s + dy * c};
+            bl = {dst.x + dx * c - (dy + dst.height) * s, dst.y + dx * s + (dy + dst.height) * c};
+            br = {dst.x + (dx + dst.width) * c - (dy + dst.height) * s,
+                  dst.y + (dx + dst.width) * s + (dy + dst.height) * c};
+        }
+
+        float inv_w = 1.0f / static_cast<float>(call.texture_width);
+        float inv_h = 1.0f / static_cast<float>(call.texture_height);
+        float u0 = (flip_x ? src.x + src.width : src.x) * inv_w;
+        float u1 = (flip_x ? src.x : src.x + src.width) * inv_w;
+        float v0 = src.y * inv_h;
+        float v1 = (src.y + src.height) * inv_h;
+
+        // rlgl quad winding: top-left, bottom-left, bottom-right, top-right
+        *out++ = {tl.x, tl.y, u0, v0, call.tint};
+        *out++ = {bl.x, bl.y, u0, v1, call.tint};
+        *out++ = {br.x, br.y, u1, v1, call.tint};
+        *out++ = {tr.x, tr.y, u1, v0, call.tint};
+    }
+}
+
+size_t SpriteBatch::emit_quads(unsigned int texture_id, const SpriteVertex* vertices, size_t quad_count,
+                               bool draw) {
+    // A run larger than rlgl's batch buffer is split, one draw per chunk
+    const size_t max_quads = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+    size_t chunks = 0;
+    for (size_t done = 0; done < quad_count; done += max_quads) {
+        size_t count = std::min(max_quads, quad_count - done);
+        rlCheckRenderBatchLimit(static_cast<int>(count * 4));
+
+        rlSetTexture(texture_id);
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        const SpriteVertex* v = vertices + done * 4;
+        for (size_t i = 0; i < count * 4; ++i, ++v) {
+            rlColor4ub(v->color.r, v->color.g, v->color.b, v->color.a);
+            rlTexCoord2f(v->u, v->v);
+            rlVertex2f(v->x, v->y);
+        }
+        rlEnd();
+        rlSetTexture(0);
+
+        if (draw) rlDrawRenderBatchActive();
+        ++chunks;
+    }
+    return chunks;
+}
+
+void SpriteBatch::submit_run(unsigned int texture_id, int blend, size_t first_quad, size_t quad_count) {
+    BeginBlendMode(blend);
+    // Each chunk closed so a run is exactly one draw per chunk
+    gpu_draw_calls_ += emit_quads(texture_id, vertices_.data() + first_quad * 4, quad_count);
 }
 
 void SpriteBatch::flush() {
-    for (const auto& call : draw_calls_) {
-        DrawTexturePro(call.texture, call.source, call.dest,
-                       call.origin, call.rotation, call.tint);
+    if (!draw_calls_.empty()) {
+        prepare();
+        build_vertices();
+
+        size_t run_start = 0;
+        for (size_t i = 1; i <= order_.size(); ++i) {
+            const SpriteDrawCall& first = draw_calls_[order_[run_start]];
+            if (i < order_.size()) {
+                const SpriteDrawCall& call = draw_calls_[order_[i]];
+                if (call.texture_id == first.texture_id && call.blend == first.blend) continue;
+            }
+            submit_run(first.texture_id, first.blend, run_start, i - run_start);
+            run_start = i;
+        }
+        EndBlendMode();
     }
     draw_calls_.clear();
+    order_.clear();
+    prepared_ = false;
 }
@@ -71,3 +71,13 @@ Vector2 Camera2D_ECS::screen_to_world(Vector2 screen_pos) const {
 Vector2 Camera2D_ECS::world_to_screen(Vector2 world_pos) const {
     return GetWorldToScreen2D(world_pos, get_raylib_camera());
 }
+
+// Rotation is not applied: the engine never rotates the camera
+Rectangle Camera2D_ECS::get_view_rect(float screen_width, float screen_height) const {
+    return {
+        target_.x - offset_.x / zoom_,
+        target_.y - offset_.y / zoom_,
+        screen_width / zoom_,
+        screen_height / zoom_
+    };
+}
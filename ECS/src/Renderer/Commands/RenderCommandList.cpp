@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** RenderCommandList Implementation
+*/
+
+#include "ECS/Renderer/Commands/RenderCommandList.hpp"
+
+RenderCommand& RenderCommandList::push(RenderCommandType type, int layer, Color color) {
+    RenderCommand& command = commands_.emplace_back();
+    command.type = type;
+    command.layer = layer;
+    command.blend = BLEND_ALPHA;
+    command.color = color;
+    command.dest = {0, 0, 0, 0};
+    command.source = {0, 0, 0, 0};
+    command.origin = {0, 0};
+    command.param = 0.0f;
+    command.spacing = 0.0f;
+    command.texture = {};
+    command.text = 0;
+    command.font = 0;
+    return command;
+}
+
+void RenderCommandList::draw_sprite(const Texture2D& texture, Rectangle source, Rectangle dest,
+                                    Vector2 origin, float rotation, Color tint, int layer, int blend) {
+    if (texture.id == 0) return;
+
+    RenderCommand& command = push(RenderCommandType::SPRITE, layer, tint);
+    command.texture = texture;
+    command.source = source;
+    command.dest = dest;
+    command.origin = origin;
+    command.param = rotation;
+    command.blend = blend;
+}
+
+void RenderCommandList::draw_rectangle(Rectangle rec, Color color, int layer) {
+    push(RenderCommandType::RECTANGLE, layer, color).dest = rec;
+}
+
+void RenderCommandList::draw_rectangle_lines(Rectangle rec, float thickness, Color color, int layer) {
+    RenderCommand& command = push(RenderCommandType::RECTANGLE_LINES, layer, color);
+    command.dest = rec;
+    command.param = thickness;
+}
+
+void RenderCommandList::draw_circle(Vector2 center, float radius, Color color, int layer) {
+    RenderCommand& command = push(RenderCommandType::CIRCLE, layer, color);
+    command.dest = {center.x, center.y, 0, 0};
+    command.param = radius;
+}
+
+void RenderCommandList::draw_text(const Font& font, const std::string& text, Vector2 position,
+                                  float font_size, float spacing, Color tint, int layer) {
+    RenderCommand& command = push(RenderCommandType::TEXT, layer, tint);
+    command.dest = {position.x, position.y, 0, 0};
+    command.param = font_size;
+    command.spacing = spacing;
+
+    command.text = static_cast<uint32_t>(text_.size());
+    text_.insert(text_.end(), text.begin(), text.end());
+    text_.push_back('\0');
+
+    // Consecutive texts usually share a font
+    if (fonts_.empty() || fonts_.back().texture.id != font.texture.id || fonts_.back().baseSize != font.baseSize) {
+        fonts_.push_back(font);
+    }
+    command.font = static_cast<uint32_t>(fonts_.size() - 1);
+}
+
+void RenderCommandList::clear() {
+    commands_.clear();
+    text_.clear();
+    fonts_.clear();
+}
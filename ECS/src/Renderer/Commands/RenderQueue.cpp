@@ -0,0 +1,196 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** RenderQueue Implementation
+*/
+
+#include "ECS/Renderer/Commands/RenderQueue.hpp"
+
+size_t RenderQueue::default_worker_count() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    // One core stays with the main thread; past a few workers recording is memory bound
+    return cores > 1 ? std::min<size_t>(cores - 1, 7) : 0;
+}
+
+RenderQueue::RenderQueue(size_t worker_count) : workers_count_(worker_count) {
+}
+
+RenderQueue::~RenderQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+RenderCommandList& RenderQueue::list() {
+    if (used_ > 0 && serial_[used_ - 1]) return *lists_[used_ - 1];
+    size_t index = open_lists(1);
+    serial_[index] = true;
+    return *lists_[index];
+}
+
+size_t RenderQueue::open_lists(size_t count) {
+    size_t first = used_;
+    used_ += count;
+    while (lists_.size() < used_) {
+        lists_.push_back(std::make_unique<RenderCommandList>());
+        serial_.push_back(false);
+    }
+    for (size_t i = first; i < used_; ++i) {
+        serial_[i] = false;
+    }
+    return first;
+}
+
+void RenderQueue::start_workers() {
+    workers_.reserve(workers_count_);
+    for (size_t i = 0; i < workers_count_; ++i) {
+        workers_.emplace_back(&RenderQueue::worker_loop, this);
+    }
+}
+
+void RenderQueue::run(size_t jobs, const std::function<void(size_t)>& job) {
+    if (workers_count_ == 0 || jobs <= 1) {
+        for (size_t i = 0; i < jobs; ++i) {
+            job(i);
+        }
+        return;
+    }
+    if (workers_.empty()) start_workers();
+
+    {
+        // A worker that woke late for the previous batch must be done with it
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = &job;
+        job_count_ = jobs;
+        next_job_ = 0;
+        pending_ = jobs;
+        error_ = nullptr;
+        ++batch_;
+    }
+    wake_.notify_all();
+
+    // The main thread records chunks too instead of idling
+    drain();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0 && active_ == 0; });
+    job_ = nullptr;
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        lock.unlock();
+        std::rethrow_exception(error);
+    }
+}
+
+void RenderQueue::drain() {
+    for (;;) {
+        size_t index = next_job_.fetch_add(1);
+        if (index >= job_count_) return;
+
+        try {
+            (*job_)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+
+        if (pending_.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.notify_all();
+        }
+    }
+}
+
+void RenderQueue::worker_loop() {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [&] { return stop_ || batch_ != seen; });
+        if (stop_) return;
+        seen = batch_;
+        ++active_;
+        lock.unlock();
+
+        drain();
+
+        lock.lock();
+        if (--active_ == 0) done_.notify_all();
+    }
+}
+
+void RenderQueue::merge(std::vector<std::pair<const RenderCommandList*, const RenderCommand*>>& out) const {
+    out.clear();
+    for (size_t i = 0; i < used_; ++i) {
+        for (const RenderCommand& command : lists_[i]->commands()) {
+            out.emplace_back(lists_[i].get(), &command);
+        }
+    }
+    std::stable_sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+        return a.second->layer < b.second->layer;
+    });
+}
+
+void RenderQueue::submit(SpriteBatch& batch, TextLayoutCache* text) {
+    merge(merged_);
+
+    for (const auto& [list, command] : merged_) {
+        if (command->type == RenderCommandType::SPRITE) {
+            Texture2D texture = command->texture;
+            batch.draw(&texture, command->source, command->dest, command->origin,
+                       command->param, command->color, command->layer, command->blend);
+            continue;
+        }
+        if (command->type == RenderCommandType::TEXT && text) {
+            text->queue(batch, list->font_of(*command), list->text_of(*command), {command->dest.x, command->dest.y},
+                        command->param, command->spacing, command->color, command->layer);
+            continue;
+        }
+
+        // Shapes and text are immediate: draw the sprites queued before them first
+        if (batch.get_draw_call_count() > 0) batch.flush();
+        switch (command->type) {
+            case RenderCommandType::RECTANGLE:
+                DrawRectangleRec(command->dest, command->color);
+                break;
+            case RenderCommandType::RECTANGLE_LINES:
+                DrawRectangleLinesEx(command->dest, command->param, command->color);
+                break;
+            case RenderCommandType::CIRCLE:
+                DrawCircleV({command->dest.x, command->dest.y}, command->param, command->color);
+                break;
+            case RenderCommandType::TEXT:
+                DrawTextEx(list->font_of(*command), list->text_of(*command),
+                           {command->dest.x, command->dest.y}, command->param, command->spacing, command->color);
+                break;
+            default:
+                break;
+        }
+    }
+
+    last_submit_count_ = merged_.size();
+    merged_.clear();
+    clear();
+}
+
+void RenderQueue::clear() {
+    for (size_t i = 0; i < used_; ++i) {
+        lists_[i]->clear();
+    }
+    used_ = 0;
+}
+
+size_t RenderQueue::get_command_count() const {
+    size_t total = 0;
+    for (size_t i = 0; i < used_; ++i) {
+        total += lists_[i]->size();
+    }
+    return total;
+}
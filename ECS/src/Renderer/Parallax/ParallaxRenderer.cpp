@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParallaxRenderer Implementation
+*/
+
+#include "ECS/Renderer/Parallax/ParallaxRenderer.hpp"
+#include <rlgl.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // value within [0, size)
+    float wrap(float value, float size) {
+        value = std::fmod(value, size);
+        return value < 0.0f ? value + size : value;
+    }
+}
+
+void ParallaxRenderer::tile_size(const parallax_layer& layer, int& width, int& height) {
+    width = layer.tile_width > 0 ? layer.tile_width : std::max(GetScreenWidth(), 1);
+    height = layer.tile_height > 0 ? layer.tile_height : std::max(GetScreenHeight(), 1);
+}
+
+void ParallaxRenderer::scroll(parallax_layer& layer, float dt) {
+    int width, height;
+    tile_size(layer, width, height);
+    layer.offset_x = wrap(layer.offset_x + layer.scroll_x * dt, static_cast<float>(width));
+    layer.offset_y = wrap(layer.offset_y + layer.scroll_y * dt, static_cast<float>(height));
+}
+
+Rectangle ParallaxRenderer::source_rect(const parallax_layer& layer, const Rectangle& view) {
+    int width, height;
+    tile_size(layer, width, height);
+    // Content drifting left by offset_x is the tile sampled offset_x further right
+    return {
+        wrap(view.x * layer.depth - layer.offset_x, static_cast<float>(width)),
+        wrap(view.y * layer.depth - layer.offset_y, static_cast<float>(height)),
+        view.width, view.height
+    };
+}
+
+void ParallaxRenderer::draw(size_t entity, parallax_layer& layer, const Rectangle& view, SpriteBatch& batch) {
+    if (!layer.paint || view.width <= 0.0f || view.height <= 0.0f) return;
+
+    int width, height;
+    tile_size(layer, width, height);
+    RenderTexture2D& tile = tiles_[entity];
+    if (tile.id == 0 || layer.repaint || tile.texture.width != width || tile.texture.height != height) {
+        paint(layer, tile, width, height);
+    }
+    if (tile.id == 0) return;
+
+    // Render textures are stored bottom-up: sample rows [y, y + h) of the
+    // painted tile from the flipped side; the repeat wrap takes care of the sign
+    Rectangle source = source_rect(layer, view);
+    source.y = wrap(-(source.y + source.height), static_cast<float>(height));
+    source.height = -source.height;
+
+    // The tile holds premultiplied colors, so the tint has to be as well
+    Color tint = layer.tint;
+    tint.r = static_cast<unsigned char>(tint.r * tint.a / 255);
+    tint.g = static_cast<unsigned char>(tint.g * tint.a / 255);
+    tint.b = static_cast<unsigned char>(tint.b * tint.a / 255);
+    batch.draw(&tile.texture, source, view, {0.0f, 0.0f}, 0.0f, tint, layer.layer, BLEND_ALPHA_PREMULTIPLY);
+}
+
+void ParallaxRenderer::paint(parallax_layer& layer, RenderTexture2D& tile, int width, int height) {
+    if (tile.id != 0 && (tile.texture.width != width || tile.texture.height != height)) {
+        UnloadRenderTexture(tile);
+        tile = {};
+    }
+    if (tile.id == 0) {
+        tile = LoadRenderTexture(width, height);
+        if (tile.id == 0) return;
+        SetTextureWrap(tile.texture, TEXTURE_WRAP_REPEAT);
+    }
+
+    BeginTextureMode(tile);
+    ClearBackground(BLANK);
+    // Same premultiplied blending as RetainedUI's cache, so translucent
+    // content composites exactly when the tile is drawn
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    layer.paint(width, height);
+    EndBlendMode();
+    EndTextureMode();
+
+    layer.repaint = false;
+    ++paint_count_;
+}
+
+void ParallaxRenderer::prune(const std::function<bool(size_t)>& alive) {
+    for (auto it = tiles_.begin(); it != tiles_.end();) {
+        if (alive(it->first)) {
+            ++it;
+            continue;
+        }
+        if (it->second.id != 0) UnloadRenderTexture(it->second);
+        it = tiles_.erase(it);
+    }
+}
+
+void ParallaxRenderer::unload() {
+    for (auto& [entity, tile] : tiles_) {
+        if (tile.id != 0) UnloadRenderTexture(tile);
+    }
+    tiles_.clear();
+}
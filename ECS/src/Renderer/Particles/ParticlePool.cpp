@@ -0,0 +1,115 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParticlePool Implementation
+*/
+
+#include "ECS/Renderer/Particles/ParticlePool.hpp"
+#include <cmath>
+
+ParticlePool::ParticlePool(size_t capacity, uint32_t seed)
+    : x_(capacity), y_(capacity), vx_(capacity), vy_(capacity), age_(capacity), life_(capacity),
+      size_(capacity), flicker_(capacity), phase_(capacity), fade_(capacity), color_(capacity),
+      rng_(seed ? seed : 1) {
+}
+
+float ParticlePool::random01() {
+    // xorshift32: cheap and good enough for visuals
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return static_cast<float>(rng_ >> 8) * (1.0f / 16777216.0f);
+}
+
+bool ParticlePool::spawn(const ParticleSpawn& particle) {
+    if (count_ >= capacity()) return false;
+
+    size_t i = count_++;
+    x_[i] = particle.position.x;
+    y_[i] = particle.position.y;
+    vx_[i] = particle.velocity.x;
+    vy_[i] = particle.velocity.y;
+    age_[i] = 0.0f;
+    life_[i] = particle.life;
+    size_[i] = particle.size;
+    flicker_[i] = particle.flicker;
+    phase_[i] = random01() * 2.0f * PI;
+    fade_[i] = particle.fade ? 1.0f : 0.0f;
+    color_[i] = particle.color;
+    return true;
+}
+
+size_t ParticlePool::burst(size_t count, float min_speed, float max_speed, const ParticleSpawn& base) {
+    ParticleSpawn particle = base;
+    size_t spawned = 0;
+    for (; spawned < count; ++spawned) {
+        float angle = random01() * 2.0f * PI;
+        float speed = min_speed + (max_speed - min_speed) * random01();
+        particle.velocity = {base.velocity.x + std::cos(angle) * speed, base.velocity.y + std::sin(angle) * speed};
+        // Some spread in the life so the burst does not vanish all at once
+        particle.life = base.life * (0.6f + 0.4f * random01());
+        if (!spawn(particle)) break;
+    }
+    return spawned;
+}
+
+void ParticlePool::set_wrap(Rectangle area) {
+    wrap_area_ = area;
+    wrap_ = true;
+}
+
+void ParticlePool::update(float dt) {
+    const size_t n = count_;
+    float* px = x_.data();
+    float* py = y_.data();
+    float* page = age_.data();
+    const float* pvx = vx_.data();
+    const float* pvy = vy_.data();
+
+    for (size_t i = 0; i < n; ++i) {
+        px[i] += pvx[i] * dt;
+        py[i] += pvy[i] * dt;
+        page[i] += dt;
+    }
+
+    if (wrap_) wrap();
+    remove_dead();
+}
+
+void ParticlePool::wrap() {
+    const float left = wrap_area_.x;
+    const float right = wrap_area_.x + wrap_area_.width;
+    for (size_t i = 0; i < count_; ++i) {
+        if (x_[i] < left) {
+            x_[i] = right;
+            y_[i] = wrap_area_.y + random01() * wrap_area_.height;
+        }
+    }
+}
+
+void ParticlePool::remove_dead() {
+    size_t i = 0;
+    while (i < count_) {
+        if (age_[i] >= life_[i]) {
+            move(--count_, i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void ParticlePool::move(size_t from, size_t to) {
+    if (from == to) return;
+    x_[to] = x_[from];
+    y_[to] = y_[from];
+    vx_[to] = vx_[from];
+    vy_[to] = vy_[from];
+    age_[to] = age_[from];
+    life_[to] = life_[from];
+    size_[to] = size_[from];
+    flicker_[to] = flicker_[from];
+    phase_[to] = phase_[from];
+    fade_[to] = fade_[from];
+    color_[to] = color_[from];
+}
@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParticleRenderer Implementation
+*/
+
+#include "ECS/Renderer/Particles/ParticleRenderer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr int DOT_SIZE = 32;
+    constexpr float FLICKER_SPEED = 3.0f;
+
+    // Parabolic sine, max error ~0.001: plenty for a twinkle, and unlike
+    // std::sin it vectorizes
+    inline float fast_sin(float x) {
+        constexpr float TWO_PI = 6.28318530718f;
+        x -= TWO_PI * std::floor(x * (1.0f / TWO_PI) + 0.5f);
+        float y = 1.27323954f * x - 0.405284735f * x * std::fabs(x);
+        return 0.225f * (y * std::fabs(y) - y) + y;
+    }
+}
+
+void ParticleRenderer::ensure_texture() {
+    if (dot_.id != 0) return;
+
+    // White disc with a one pixel soft edge; the vertex color tints it
+    Image image = GenImageColor(DOT_SIZE, DOT_SIZE, BLANK);
+    Color* pixels = static_cast<Color*>(image.data);
+    const float center = DOT_SIZE * 0.5f;
+    for (int y = 0; y < DOT_SIZE; ++y) {
+        for (int x = 0; x < DOT_SIZE; ++x) {
+            float dx = x + 0.5f - center;
+            float dy = y + 0.5f - center;
+            float coverage = std::clamp(center - std::sqrt(dx * dx + dy * dy), 0.0f, 1.0f);
+            pixels[y * DOT_SIZE + x] = {255, 255, 255, static_cast<unsigned char>(coverage * 255.0f)};
+        }
+    }
+    dot_ = LoadTextureFromImage(image);
+    UnloadImage(image);
+    SetTextureFilter(dot_, TEXTURE_FILTER_BILINEAR);
+}
+
+void ParticleRenderer::build(const ParticlePool& pool, float time) {
+    const size_t n = pool.size();
+    vertices_.resize(n * 4);
+
+    const float* px = pool.x();
+    const float* py = pool.y();
+    const float* radius = pool.radius();
+    const float* age = pool.age();
+    const float* life = pool.life();
+    const float* fade = pool.fade();
+    const float* flicker = pool.flicker();
+    const float* phase = pool.phase();
+    const Color* color = pool.color();
+
+    // Brightness and alpha first, in straight loops over the arrays
+    brightness_.resize(n);
+    alpha_.resize(n);
+    float* brightness = brightness_.data();
+    float* alpha = alpha_.data();
+    for (size_t i = 0; i < n; ++i) {
+        brightness[i] = 1.0f - flicker[i] + flicker[i] * fast_sin(time * FLICKER_SPEED + phase[i]);
+        // age / life is 0 for immortal particles
+        alpha[i] = 1.0f - fade[i] * std::min(age[i] / life[i], 1.0f);
+    }
+
+    SpriteVertex* out = vertices_.data();
+    for (size_t i = 0; i < n; ++i) {
+        Color tint = {
+            static_cast<unsigned char>(color[i].r * brightness[i]),
+            static_cast<unsigned char>(color[i].g * brightness[i]),
+            static_cast<unsigned char>(color[i].b * brightness[i]),
+            static_cast<unsigned char>(color[i].a * alpha[i])
+        };
+
+        float x0 = px[i] - radius[i];
+        float x1 = px[i] + radius[i];
+        float y0 = py[i] - radius[i];
+        float y1 = py[i] + radius[i];
+        // rlgl quad winding: top-left, bottom-left, bottom-right, top-right
+        *out++ = {x0, y0, 0.0f, 0.0f, tint};
+        *out++ = {x0, y1, 0.0f, 1.0f, tint};
+        *out++ = {x1, y1, 1.0f, 1.0f, tint};
+        *out++ = {x1, y0, 1.0f, 0.0f, tint};
+    }
+}
+
+void ParticleRenderer::draw(const ParticlePool& pool, float time, int blend) {
+    last_draw_calls_ = 0;
+    if (pool.empty()) return;
+
+    ensure_texture();
+    build(pool, time);
+
+    BeginBlendMode(blend);
+    last_draw_calls_ = SpriteBatch::emit_quads(dot_.id, vertices_.data(), pool.size());
+    EndBlendMode();
+}
+
+void ParticleRenderer::unload() {
+    if (dot_.id != 0) {
+        UnloadTexture(dot_);
+        dot_ = {};
+    }
+}
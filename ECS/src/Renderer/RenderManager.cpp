@@ -6,6 +6,7 @@
 */
 
 #include "ECS/Renderer/RenderManager.hpp"
+#include <algorithm>
 #include <iostream>
 
 RenderManager& RenderManager::instance()
@@ -111,6 +112,7 @@ void RenderManager::init(const char *title, float scale, bool fullscreen)
     // To make world coordinates match screen coordinates (0,0 = top-left):
     // We don't use camera transform - just set offset=target=0 or disable camera
     camera_.set_position(0.0f, 0.0f);
+    update_view_rect();
     std::cout << "RenderManager initialized (camera disabled for 1:1 screen mapping)" << std::endl;
 }
 
@@ -125,6 +127,8 @@ void RenderManager::init(const char *title, bool windowed)
 }
 
 void RenderManager::shutdown() {
+    particle_renderer_.unload();
+    text_cache_.clear();
     CloseWindow();
     std::cout << "RenderManager shutdown" << std::endl;
 }
@@ -135,13 +139,36 @@ void RenderManager::begin_frame()
     ClearBackground(clear_color_);
     // Disable camera for now - use direct screen coordinates
     // camera_.begin_mode();
+    update_view_rect();
+    cull_stats_ = {};
+    queue_.clear();
     batch_.begin();
 }
 
+void RenderManager::update_view_rect()
+{
+    view_rect_ = camera_.get_view_rect(static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight()));
+}
+
+void RenderManager::flush()
+{
+    queue_.submit(batch_, &text_cache_);
+    batch_.flush();
+}
+
+void RenderManager::draw_particles(const ParticlePool& pool, int blend)
+{
+    flush();
+    particle_renderer_.draw(pool, static_cast<float>(GetTime()), blend);
+}
+
 void RenderManager::end_frame()
 {
+    queue_.submit(batch_, &text_cache_);
     batch_.end();
     batch_.flush();
+    text_cache_.end_frame();
+    last_cull_stats_ = cull_stats_;
     // camera_.end_mode();
     EndDrawing();
 }
@@ -159,15 +186,26 @@ int RenderManager::get_fps() const
 void RenderManager::draw_text(const char *text, int posX, int posY, int fontSize, Color color) const
 {
     if (_font.texture.id != 0) {
-        DrawTextEx(_font, text, {static_cast<float>(posX), static_cast<float>(posY)},
-                   static_cast<float>(fontSize), 1.0f, color);
+        text_cache_.draw(_font, text, {static_cast<float>(posX), static_cast<float>(posY)},
+                         static_cast<float>(fontSize), 1.0f, color);
     } else {
-        DrawText(text, posX, posY, fontSize, color);
+        // What DrawText does: built-in font, at least 10px, spacing of a tenth of the size
+        int size = std::max(fontSize, 10);
+        text_cache_.draw(GetFontDefault(), text, {static_cast<float>(posX), static_cast<float>(posY)},
+                         static_cast<float>(size), static_cast<float>(size / 10), color);
     }
 }
 
 void RenderManager::draw_text_ex(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) const {
-    DrawTextEx(font, text, position, fontSize, spacing, tint);
+    text_cache_.draw(font, text, position, fontSize, spacing, tint);
+}
+
+Vector2 RenderManager::measure_text_ex(Font font, const char *text, float fontSize, float spacing) const {
+    return text_cache_.measure(font, text, fontSize, spacing);
+}
+
+void RenderManager::draw_text_batched(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint, int layer) {
+    text_cache_.queue(batch_, font, text, position, fontSize, spacing, tint, layer);
 }
 
 void RenderManager::draw_circle(int centerX, int centerY, float radius, Color color) {
@@ -213,6 +251,7 @@ bool RenderManager::load_font(const char *fontPath)
 void RenderManager::unload_font()
 {
     if (_font.texture.id != 0) {
+        text_cache_.clear();
         UnloadFont(_font);
         std::cout << "RenderManager: Unloaded font" << std::endl;
         _font = Font{};
@@ -0,0 +1,244 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextLayoutCache Implementation
+*/
+
+#include "ECS/Renderer/Text/TextLayoutCache.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    // raylib's default SetTextLineSpacing()
+    constexpr float LINE_SPACING = 2.0f;
+
+    uint64_t hash_key(unsigned int texture_id, const GlyphInfo* glyphs, float font_size, float spacing,
+                      const char* text, size_t length) {
+        uint64_t hash = 1469598103934665603ull;
+        auto mix = [&hash](uint64_t value) {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        };
+        for (size_t i = 0; i < length; ++i) {
+            mix(static_cast<unsigned char>(text[i]));
+        }
+        uint32_t size_bits;
+        uint32_t spacing_bits;
+        std::memcpy(&size_bits, &font_size, sizeof(size_bits));
+        std::memcpy(&spacing_bits, &spacing, sizeof(spacing_bits));
+        mix(texture_id);
+        mix(reinterpret_cast<uintptr_t>(glyphs));
+        mix((static_cast<uint64_t>(size_bits) << 32) | spacing_bits);
+        return hash;
+    }
+
+    // Same decoding as raylib's GetCodepointNext: '?' for malformed bytes
+    int next_codepoint(const unsigned char* text, int& bytes) {
+        bytes = 1;
+        if (text[0] < 0x80) return text[0];
+        if ((text[0] & 0xe0) == 0xc0 && (text[1] & 0xc0) == 0x80) {
+            bytes = 2;
+            return ((text[0] & 0x1f) << 6) | (text[1] & 0x3f);
+        }
+        if ((text[0] & 0xf0) == 0xe0 && (text[1] & 0xc0) == 0x80 && (text[2] & 0xc0) == 0x80) {
+            bytes = 3;
+            return ((text[0] & 0x0f) << 12) | ((text[1] & 0x3f) << 6) | (text[2] & 0x3f);
+        }
+        if ((text[0] & 0xf8) == 0xf0 && (text[1] & 0xc0) == 0x80 && (text[2] & 0xc0) == 0x80 &&
+            (text[3] & 0xc0) == 0x80) {
+            bytes = 4;
+            return ((text[0] & 0x07) << 18) | ((text[1] & 0x3f) << 12) | ((text[2] & 0x3f) << 6) | (text[3] & 0x3f);
+        }
+        return '?';
+    }
+}
+
+const TextLayoutCache::GlyphTable& TextLayoutCache::table_for(const Font& font) {
+    for (const GlyphTable& table : tables_) {
+        if (table.texture_id == font.texture.id && table.glyphs == font.glyphs) return table;
+    }
+
+    GlyphTable table;
+    table.texture_id = font.texture.id;
+    table.glyphs = font.glyphs;
+    // Like GetGlyphIndex: the first glyph with the codepoint wins, else '?'
+    table.ascii.fill(-1);
+    for (int i = font.glyphCount - 1; i >= 0; --i) {
+        int codepoint = font.glyphs[i].value;
+        if (codepoint >= 0 && codepoint < 128) {
+            table.ascii[codepoint] = i;
+        } else {
+            table.others[codepoint] = i;
+        }
+    }
+    table.fallback = std::max(table.ascii['?'], 0);
+    for (int& index : table.ascii) {
+        if (index < 0) index = table.fallback;
+    }
+    tables_.push_back(std::move(table));
+    return tables_.back();
+}
+
+// Same positions as DrawTextEx/DrawTextCodepoint and same size as MeasureTextEx
+void TextLayoutCache::build(const Font& font, const GlyphTable& table, Entry& entry) {
+    TextLayout& out = entry.layout;
+    out.glyphs.clear();
+    out.size = {0, 0};
+    if (font.baseSize == 0 || entry.text.empty()) return;
+
+    const float scale = entry.font_size / static_cast<float>(font.baseSize);
+    const float padding = static_cast<float>(font.glyphPadding);
+    float offset_x = 0.0f;
+    float offset_y = 0.0f;
+
+    float line_width = 0.0f;        // unscaled, as MeasureTextEx sums it
+    float max_line_width = 0.0f;
+    int line_codepoints = 0;
+    int max_line_codepoints = 0;
+    float height = entry.font_size;
+
+    const unsigned char* text = reinterpret_cast<const unsigned char*>(entry.text.c_str());
+    for (size_t i = 0; i < entry.text.size();) {
+        int bytes = 1;
+        int codepoint = next_codepoint(text + i, bytes);
+        i += bytes;
+        ++line_codepoints;
+
+        int index = table.fallback;
+        if (codepoint >= 0 && codepoint < 128) {
+            index = table.ascii[codepoint];
+        } else {
+            auto found = table.others.find(codepoint);
+            if (found != table.others.end()) index = found->second;
+        }
+        const GlyphInfo& glyph = font.glyphs[index];
+        const Rectangle& rec = font.recs[index];
+
+        if (codepoint == '\n') {
+            offset_y += entry.font_size + LINE_SPACING;
+            offset_x = 0.0f;
+            max_line_width = std::max(max_line_width, line_width);
+            line_width = 0.0f;
+            line_codepoints = 0;
+            height += entry.font_size + LINE_SPACING;
+        } else {
+            if (codepoint != ' ' && codepoint != '\t') {
+                GlyphQuad quad;
+                quad.source = {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding};
+                quad.dest = {offset_x + (glyph.offsetX - padding) * scale, offset_y + (glyph.offsetY - padding) * scale,
+                             (rec.width + 2.0f * padding) * scale, (rec.height + 2.0f * padding) * scale};
+                out.glyphs.push_back(quad);
+            }
+            if (glyph.advanceX == 0) {
+                offset_x += rec.width * scale + entry.spacing;
+                line_width += rec.width + glyph.offsetX;
+            } else {
+                offset_x += glyph.advanceX * scale + entry.spacing;
+                line_width += glyph.advanceX;
+            }
+        }
+        max_line_codepoints = std::max(max_line_codepoints, line_codepoints);
+    }
+    max_line_width = std::max(max_line_width, line_width);
+    out.size = {max_line_width * scale + (max_line_codepoints - 1) * entry.spacing, height};
+}
+
+const TextLayout& TextLayoutCache::layout(const Font& font, const char* text, float font_size, float spacing) {
+    if (!text) text = "";
+    size_t length = std::strlen(text);
+    uint64_t key = hash_key(font.texture.id, font.glyphs, font_size, spacing, text, length);
+
+    auto [slot, inserted] = entries_.try_emplace(key);
+    Entry& entry = slot->second;
+    if (!inserted && entry.texture_id == font.texture.id && entry.glyphs == font.glyphs &&
+        entry.font_size == font_size && entry.spacing == spacing &&
+        entry.text.compare(0, std::string::npos, text, length) == 0) {
+        entry.last_used = frame_;
+        ++hits_;
+        return entry.layout;
+    }
+
+    // New string, or a hash collision: the slot is rebuilt either way
+    ++misses_;
+    entry.texture_id = font.texture.id;
+    entry.glyphs = font.glyphs;
+    entry.font_size = font_size;
+    entry.spacing = spacing;
+    entry.text.assign(text, length);
+    entry.last_used = frame_;
+    if (font.glyphs && font.recs && font.glyphCount > 0) {
+        build(font, table_for(font), entry);
+    } else {
+        entry.layout.glyphs.clear();
+        entry.layout.size = {0, 0};
+    }
+    return entry.layout;
+}
+
+Vector2 TextLayoutCache::measure(const Font& font, const char* text, float font_size, float spacing) {
+    // MeasureTextEx gives nothing for an unloaded font
+    if (font.texture.id == 0) return {0, 0};
+    return layout(font, text, font_size, spacing).size;
+}
+
+void TextLayoutCache::draw(const Font& requested, const char* text, Vector2 position, float font_size,
+                           float spacing, Color tint) {
+    // DrawTextEx falls back to the built-in font
+    const Font font = requested.texture.id != 0 ? requested : GetFontDefault();
+    const TextLayout& text_layout = layout(font, text, font_size, spacing);
+    if (text_layout.glyphs.empty() || font.texture.id == 0) return;
+
+    const float inv_w = 1.0f / static_cast<float>(font.texture.width);
+    const float inv_h = 1.0f / static_cast<float>(font.texture.height);
+
+    const size_t quad_count = text_layout.glyphs.size();
+    vertices_.resize(quad_count * 4);
+    SpriteVertex* out = vertices_.data();
+    for (const GlyphQuad& quad : text_layout.glyphs) {
+        float x0 = position.x + quad.dest.x;
+        float y0 = position.y + quad.dest.y;
+        float x1 = x0 + quad.dest.width;
+        float y1 = y0 + quad.dest.height;
+        float u0 = quad.source.x * inv_w;
+        float v0 = quad.source.y * inv_h;
+        float u1 = (quad.source.x + quad.source.width) * inv_w;
+        float v1 = (quad.source.y + quad.source.height) * inv_h;
+        // rlgl quad winding: top-left, bottom-left, bottom-right, top-right
+        *out++ = {x0, y0, u0, v0, tint};
+        *out++ = {x0, y1, u0, v1, tint};
+        *out++ = {x1, y1, u1, v1, tint};
+        *out++ = {x1, y0, u1, v0, tint};
+    }
+    // No forced flush: consecutive strings in the same font share rlgl's draw
+    SpriteBatch::emit_quads(font.texture.id, vertices_.data(), quad_count, false);
+}
+
+void TextLayoutCache::queue(SpriteBatch& batch, const Font& requested, const char* text, Vector2 position,
+                            float font_size, float spacing, Color tint, int layer, int blend) {
+    const Font font = requested.texture.id != 0 ? requested : GetFontDefault();
+    const TextLayout& text_layout = layout(font, text, font_size, spacing);
+    Texture2D atlas = font.texture;
+    for (const GlyphQuad& quad : text_layout.glyphs) {
+        Rectangle dest = {position.x + quad.dest.x, position.y + quad.dest.y, quad.dest.width, quad.dest.height};
+        batch.draw(&atlas, quad.source, dest, {0, 0}, 0.0f, tint, layer, blend);
+    }
+}
+
+void TextLayoutCache::end_frame() {
+    if (entries_.size() > capacity_) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.last_used != frame_) {
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    ++frame_;
+}
+
+void TextLayoutCache::clear() {
+    entries_.clear();
+    tables_.clear();
+}
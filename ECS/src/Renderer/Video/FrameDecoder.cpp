@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FrameDecoder Implementation
+*/
+
+#include "ECS/Renderer/Video/FrameDecoder.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+bool copy_frame_pixels(Image image, int width, int height, unsigned char* rgba) {
+    if (image.data == nullptr) return false;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+    if (image.width != width || image.height != height) {
+        ImageResize(&image, width, height);
+    }
+    std::memcpy(rgba, image.data, static_cast<size_t>(width) * height * 4);
+    UnloadImage(image);
+    return true;
+}
+
+ImageSequenceDecoder::ImageSequenceDecoder(std::vector<std::string> paths, float frame_rate)
+    : paths_(std::move(paths)), frame_rate_(frame_rate) {
+    if (paths_.empty()) return;
+    first_ = LoadImage(paths_[0].c_str());
+    if (first_.data == nullptr) {
+        std::cerr << "ImageSequenceDecoder: failed to load " << paths_[0] << std::endl;
+        paths_.clear();
+        return;
+    }
+    width_ = first_.width;
+    height_ = first_.height;
+}
+
+ImageSequenceDecoder::~ImageSequenceDecoder() {
+    if (first_.data) UnloadImage(first_);
+}
+
+std::vector<std::string> ImageSequenceDecoder::list_frames(const std::string& directory) {
+    std::vector<std::string> files;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        if (entry.is_regular_file()) files.push_back(entry.path().string());
+    }
+    return order_frames(files);
+}
+
+std::vector<std::string> ImageSequenceDecoder::order_frames(const std::vector<std::string>& files) {
+    struct Frame {
+        long number;
+        std::string path;
+    };
+    std::vector<Frame> frames;
+
+    for (const auto& file : files) {
+        fs::path path(file);
+        std::string extension = path.extension().string();
+        if (extension != ".png" && extension != ".jpg" && extension != ".bmp") continue;
+
+        std::string stem = path.stem().string();
+        size_t digits = stem.size();
+        while (digits > 0 && std::isdigit(static_cast<unsigned char>(stem[digits - 1]))) --digits;
+        long number = digits < stem.size() ? std::stol(stem.substr(digits)) : -1;
+        frames.push_back({number, file});
+    }
+
+    std::sort(frames.begin(), frames.end(), [](const Frame& a, const Frame& b) {
+        return a.number != b.number ? a.number < b.number : a.path < b.path;
+    });
+    std::vector<std::string> paths;
+    paths.reserve(frames.size());
+    for (auto& frame : frames) {
+        paths.push_back(std::move(frame.path));
+    }
+    return paths;
+}
+
+bool ImageSequenceDecoder::decode_next(unsigned char* rgba) {
+    if (next_ >= paths_.size()) return false;
+
+    Image image;
+    if (next_ == 0) {
+        image = first_;
+        first_ = Image{};
+    } else {
+        image = LoadImage(paths_[next_].c_str());
+    }
+    if (!copy_frame_pixels(image, width_, height_, rgba)) {
+        std::cerr << "ImageSequenceDecoder: failed to load " << paths_[next_] << std::endl;
+        return false;
+    }
+    ++next_;
+    return true;
+}
@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FramePack Implementation
+*/
+
+#include "ECS/Renderer/Video/FramePack.hpp"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr char MAGIC[4] = {'R', 'F', 'P', 'K'};
+    constexpr uint32_t VERSION = 1;
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        int32_t width;
+        int32_t height;
+        uint32_t frame_count;
+        float frame_rate;
+        char extension[8];
+    };
+}
+
+FramePack::FramePack(const std::string& path) : file_(path, std::ios::binary) {
+    Header header{};
+    if (!file_ || !file_.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        std::cerr << "FramePack: cannot read " << path << std::endl;
+        return;
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+        std::cerr << "FramePack: " << path << " is not a version " << VERSION << " frame pack" << std::endl;
+        return;
+    }
+
+    offsets_.resize(header.frame_count + 1);
+    if (!file_.read(reinterpret_cast<char*>(offsets_.data()), offsets_.size() * sizeof(uint64_t))) {
+        std::cerr << "FramePack: truncated offset table in " << path << std::endl;
+        return;
+    }
+    header.extension[sizeof(header.extension) - 1] = '\0';
+    extension_ = header.extension;
+    width_ = header.width;
+    height_ = header.height;
+    frame_rate_ = header.frame_rate;
+    frame_count_ = header.frame_count;
+}
+
+bool FramePack::write(const std::string& path, const std::vector<std::string>& frames, float frame_rate) {
+    if (frames.empty()) return false;
+
+    Image first = LoadImage(frames[0].c_str());
+    if (first.data == nullptr) {
+        std::cerr << "FramePack: failed to load " << frames[0] << std::endl;
+        return false;
+    }
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.width = first.width;
+    header.height = first.height;
+    header.frame_count = static_cast<uint32_t>(frames.size());
+    header.frame_rate = frame_rate;
+    UnloadImage(first);
+
+    std::string extension = GetFileExtension(frames[0].c_str());
+    if (extension.size() >= sizeof(header.extension)) return false;
+    std::memcpy(header.extension, extension.c_str(), extension.size());
+
+    std::error_code ec;
+    fs::create_directories(fs::path(path).parent_path(), ec);
+    // Written next to path and renamed over it once complete: a pack cut
+    // short would otherwise look newer than its frames and never be rebuilt
+    std::string temp = path + ".tmp";
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "FramePack: cannot write " << temp << std::endl;
+        return false;
+    }
+    auto fail = [&out, &temp, &ec]() {
+        out.close();
+        fs::remove(temp, ec);
+        return false;
+    };
+
+    // Offsets are only known once every frame is read: write the table last
+    std::vector<uint64_t> offsets;
+    offsets.reserve(frames.size() + 1);
+    uint64_t offset = sizeof(Header) + (frames.size() + 1) * sizeof(uint64_t);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.seekp(static_cast<std::streamoff>(offset));
+
+    for (const auto& frame : frames) {
+        if (extension != GetFileExtension(frame.c_str())) {
+            std::cerr << "FramePack: " << frame << " is not a " << extension << " image" << std::endl;
+            return fail();
+        }
+        int size = 0;
+        unsigned char* data = LoadFileData(frame.c_str(), &size);
+        if (data == nullptr) return fail();
+        offsets.push_back(offset);
+        out.write(reinterpret_cast<const char*>(data), size);
+        offset += static_cast<uint64_t>(size);
+        UnloadFileData(data);
+    }
+    offsets.push_back(offset);
+
+    out.seekp(sizeof(Header));
+    out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint64_t));
+    out.close();
+    if (!out) {
+        std::cerr << "FramePack: failed writing " << temp << std::endl;
+        return fail();
+    }
+    fs::rename(temp, path, ec);
+    if (ec) {
+        std::cerr << "FramePack: cannot replace " << path << ": " << ec.message() << std::endl;
+        return fail();
+    }
+    std::cout << "FramePack: wrote " << path << " (" << frames.size() << " frames)" << std::endl;
+    return true;
+}
+
+bool FramePack::is_stale(const std::string& path, const std::vector<std::string>& frames) {
+    std::error_code ec;
+    auto pack_time = fs::last_write_time(path, ec);
+    if (ec) return true;
+    for (const auto& frame : frames) {
+        auto frame_time = fs::last_write_time(frame, ec);
+        if (!ec && frame_time > pack_time) return true;
+    }
+    return false;
+}
+
+bool FramePack::decode_next(unsigned char* rgba) {
+    if (next_ >= frame_count_) return false;
+
+    uint64_t size = offsets_[next_ + 1] - offsets_[next_];
+    bytes_.resize(size);
+    file_.seekg(static_cast<std::streamoff>(offsets_[next_]));
+    if (!file_.read(reinterpret_cast<char*>(bytes_.data()), static_cast<std::streamsize>(size))) {
+        std::cerr << "FramePack: truncated frame " << next_ << std::endl;
+        return false;
+    }
+    ++next_;
+
+    Image image = LoadImageFromMemory(extension_.c_str(), bytes_.data(), static_cast<int>(size));
+    return copy_frame_pixels(image, width_, height_, rgba);
+}
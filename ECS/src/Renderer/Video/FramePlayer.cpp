@@ -0,0 +1,175 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FramePlayer Implementation
+*/
+
+#include "ECS/Renderer/Video/FramePlayer.hpp"
+#include "ECS/Renderer/Video/FramePack.hpp"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <iostream>
+#include <unordered_map>
+
+namespace {
+    std::unordered_map<std::string, FramePlayer::DecoderFactory>& decoders() {
+        static std::unordered_map<std::string, FramePlayer::DecoderFactory> registry = {
+            {".frames", [](const std::string& path, float) -> std::unique_ptr<IFrameDecoder> {
+                auto pack = std::make_unique<FramePack>(path);
+                if (!pack->is_open()) return nullptr;
+                return pack;
+            }},
+        };
+        return registry;
+    }
+
+    std::string lowercase(std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    }
+}
+
+void FramePlayer::register_decoder(const std::string& extension, DecoderFactory factory) {
+    decoders()[lowercase(extension)] = std::move(factory);
+}
+
+std::unique_ptr<IFrameDecoder> FramePlayer::open_decoder(const std::string& path, float frame_rate) {
+    std::error_code ec;
+    if (std::filesystem::is_directory(path, ec)) {
+        auto sequence = std::make_unique<ImageSequenceDecoder>(ImageSequenceDecoder::list_frames(path), frame_rate);
+        if (sequence->frame_count() == 0) return nullptr;
+        return sequence;
+    }
+
+    std::string extension = lowercase(std::filesystem::path(path).extension().string());
+    auto it = decoders().find(extension);
+    if (it == decoders().end()) {
+        std::cerr << "FramePlayer: no decoder registered for " << extension << " (" << path << ")" << std::endl;
+        return nullptr;
+    }
+    return it->second(path, frame_rate);
+}
+
+FramePlayer::FramePlayer(AssetStreamer& streamer, size_t ring_size)
+    : streamer_(streamer), ring_size_(std::max<size_t>(ring_size, 1)) {
+}
+
+FramePlayer::~FramePlayer() {
+    close();
+}
+
+bool FramePlayer::open(const std::string& path, float frame_rate) {
+    return open(open_decoder(path, frame_rate));
+}
+
+bool FramePlayer::open(std::unique_ptr<IFrameDecoder> decoder) {
+    close();
+    if (!decoder || decoder->width() <= 0 || decoder->height() <= 0) return false;
+
+    const int width = decoder->width();
+    const int height = decoder->height();
+    float rate = decoder->frame_rate();
+    frame_time_ = rate > 0.0f ? 1.0f / rate : 1.0f / 30.0f;
+
+    stream_ = std::make_shared<Stream>();
+    stream_->decoder = std::move(decoder);
+    stream_->buffers.resize(ring_size_);
+    for (auto& buffer : stream_->buffers) {
+        buffer.resize(static_cast<size_t>(width) * height * 4);
+    }
+
+    Image blank = GenImageColor(width, height, BLANK);
+    for (auto& texture : textures_) {
+        texture = LoadTextureFromImage(blank);
+        SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+    }
+    UnloadImage(blank);
+
+    decode_ahead();
+    return true;
+}
+
+void FramePlayer::close() {
+    if (stream_) {
+        // A job still decoding keeps the stream alive and drops its result
+        stream_->closed = true;
+        stream_.reset();
+        for (auto& texture : textures_) {
+            UnloadTexture(texture);
+            texture = Texture2D{};
+        }
+    }
+    front_ = 0;
+    clock_ = 0.0f;
+    shown_ = 0;
+    dropped_ = 0;
+}
+
+bool FramePlayer::is_finished() const {
+    return stream_ && stream_->ended && stream_->ready == 0 && !stream_->decoding;
+}
+
+size_t FramePlayer::tail() const {
+    return (stream_->head + ring_size_ - stream_->ready) % ring_size_;
+}
+
+void FramePlayer::decode_ahead() {
+    std::shared_ptr<Stream> stream = stream_;
+    if (!stream || stream->decoding || stream->ended || stream->ready == ring_size_) return;
+
+    stream->decoding = true;
+    unsigned char* target = stream->buffers[stream->head].data();
+    streamer_.enqueue([stream, target] {
+        stream->decoded = stream->decoder->decode_next(target);
+    }, [this, stream] {
+        stream->decoding = false;
+        if (stream->closed) return;
+        if (stream->decoded) {
+            stream->head = (stream->head + 1) % ring_size_;
+            ++stream->ready;
+        } else {
+            stream->ended = true;
+        }
+        decode_ahead();
+    });
+}
+
+void FramePlayer::present() {
+    int back = front_ ^ 1;
+    UpdateTexture(textures_[back], stream_->buffers[tail()].data());
+    front_ = back;
+    --stream_->ready;
+    ++shown_;
+}
+
+void FramePlayer::update(float delta_time) {
+    if (!stream_) return;
+
+    if (shown_ == 0) {
+        // The clock starts with the first frame, however long it took to decode
+        if (stream_->ready > 0) {
+            present();
+            clock_ = 0.0f;
+        }
+    } else {
+        clock_ += delta_time;
+        while (clock_ >= frame_time_) {
+            if (stream_->ready == 0) {
+                clock_ = std::min(clock_, frame_time_);
+                break;
+            }
+            clock_ -= frame_time_;
+            if (clock_ >= frame_time_ && stream_->ready > 1) {
+                --stream_->ready;
+                ++dropped_;
+                continue;
+            }
+            present();
+            break;
+        }
+    }
+    decode_ahead();
+}
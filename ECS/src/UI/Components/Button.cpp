@@ -103,10 +103,10 @@ namespace UI {
         Color text_color = getCurrentTextColor();
 
         // Calculate text position to center it in the button
-        Vector2 textSize = MeasureTextEx(renderManager.get_font(), _text.c_str(), _style.getFontSize(), 1.0f);
+        Vector2 textSize = renderManager.measure_text_ex(renderManager.get_font(), _text.c_str(), _style.getFontSize(), 1.0f);
         float textX = _position.x + (_size.x - textSize.x) / 2.0f;
         float textY = _position.y + (_size.y - textSize.y) / 2.0f;
 
-        DrawTextEx(renderManager.get_font(), _text.c_str(), {textX, textY}, _style.getFontSize(), 1.0f, text_color);
+        renderManager.draw_text_ex(renderManager.get_font(), _text.c_str(), {textX, textY}, _style.getFontSize(), 1.0f, text_color);
     }
 }
\ No newline at end of file
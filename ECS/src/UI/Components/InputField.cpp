@@ -146,7 +146,7 @@ namespace UI {
         float text_x = _position.x + _style.getPadding();
         float text_y = _position.y + (_size.y - _style.getFontSize()) / 2.0f;
 
-        DrawTextEx(
+        renderManager.draw_text_ex(
             renderManager.get_font(),
             display_text.c_str(),
             {text_x, text_y},
@@ -164,7 +164,7 @@ namespace UI {
         float text_x = _position.x + _style.getPadding();
         float text_y = _position.y + (_size.y - _style.getFontSize()) / 2.0f;
 
-        Vector2 text_size = MeasureTextEx(
+        Vector2 text_size = renderManager.measure_text_ex(
             renderManager.get_font(),
             display_text.c_str(),
             _style.getFontSize(),
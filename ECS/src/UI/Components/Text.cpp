@@ -7,6 +7,8 @@
 
 #include "ECS/UI/Components/Text.hpp"
 #include "ECS/Renderer/RenderManager.hpp"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace UI {
@@ -37,7 +39,7 @@ namespace UI {
 
     Vector2 UIText::getTextSize() const {
         auto &renderManager = RenderManager::instance();
-        return MeasureTextEx(
+        return renderManager.measure_text_ex(
             renderManager.get_font(),
             _text.c_str(),
             _style.getFontSize(),
@@ -49,6 +51,22 @@ namespace UI {
         _size = getTextSize();
     }
 
+    Rectangle UIText::getRenderBounds() const {
+        if (_customRender) return AUIComponent::getRenderBounds();
+
+        Vector2 pos = calculateTextPosition();
+        Vector2 size = getTextSize();
+        Rectangle bounds = {pos.x, pos.y, size.x, size.y};
+        if (_style.hasShadow()) {
+            Vector2 offset = _style.getShadowOffset();
+            bounds.x += std::min(offset.x, 0.0f);
+            bounds.y += std::min(offset.y, 0.0f);
+            bounds.width += std::fabs(offset.x);
+            bounds.height += std::fabs(offset.y);
+        }
+        return bounds;
+    }
+
     Vector2 UIText::calculateTextPosition() const {
         Vector2 text_size = getTextSize();
         Vector2 pos = _position;
@@ -79,7 +97,7 @@ namespace UI {
             pos.y + _style.getShadowOffset().y
         };
 
-        DrawTextEx(
+        renderManager.draw_text_ex(
             renderManager.get_font(),
             _text.c_str(),
             shadow_pos,
@@ -93,7 +111,7 @@ namespace UI {
         auto &renderManager = RenderManager::instance();
         Vector2 pos = calculateTextPosition();
 
-        DrawTextEx(
+        renderManager.draw_text_ex(
             renderManager.get_font(),
             _text.c_str(),
             pos,
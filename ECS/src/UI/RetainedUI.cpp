@@ -0,0 +1,281 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RetainedUI Implementation
+*/
+
+#include "ECS/UI/RetainedUI.hpp"
+#include <rlgl.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float BOUNDS_MARGIN = 8.0f;   // glows and borders drawn past the bounds
+    constexpr uint32_t HOT_STREAK = 3;      // new version this many frames in a row: stop caching
+    constexpr uint64_t HOT_COOLDOWN = 30;   // frames without a change before caching it again
+
+    Rectangle padded(const Rectangle& r) {
+        return {r.x - BOUNDS_MARGIN, r.y - BOUNDS_MARGIN, r.width + 2 * BOUNDS_MARGIN, r.height + 2 * BOUNDS_MARGIN};
+    }
+
+    bool same(const Rectangle& a, const Rectangle& b) {
+        return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+    }
+
+    bool overlaps(const Rectangle& a, const Rectangle& b) {
+        return a.x < b.x + b.width && a.x + a.width > b.x && a.y < b.y + b.height && a.y + a.height > b.y;
+    }
+
+    bool empty(const Rectangle& r) {
+        return r.width <= 0.0f || r.height <= 0.0f;
+    }
+
+    AABB to_aabb(const Rectangle& r) {
+        return AABB(r.x, r.y, r.width, r.height);
+    }
+}
+
+namespace UI {
+    void RetainedUI::sync(sparse_set<UIComponent>& components) {
+        bool same_layout = components.size() == widgets_.size();
+        for (size_t i = 0; same_layout && i < widgets_.size(); ++i) {
+            same_layout = widgets_[i].entity == components.entity_at(i) &&
+                          widgets_[i].element == components[i]._ui_element.get();
+        }
+        if (!same_layout) {
+            rebuild(components);
+            return;
+        }
+
+        std::vector<bool> was_cached(widgets_.size());
+        std::vector<Rectangle> old_bounds(widgets_.size());
+        std::vector<bool> changed(widgets_.size());
+
+        for (size_t i = 0; i < widgets_.size(); ++i) {
+            Widget& w = widgets_[i];
+            was_cached[i] = w.visible && !w.live;
+            old_bounds[i] = w.bounds;
+            if (!w.element) continue;
+
+            Rectangle bounds = padded(w.element->getRenderBounds());
+            bool visible = w.element->isVisible();
+            UIState state = w.element->getState();
+            uint32_t version = w.element->getVersion();
+
+            if (version != w.version) {
+                w.change_streak = w.last_change + 1 >= frame_ ? w.change_streak + 1 : 1;
+                w.last_change = frame_;
+            }
+            if (!same(bounds, w.bounds) || visible != w.visible) index_dirty_ = true;
+            changed[i] = version != w.version || state != w.state || visible != w.visible || !same(bounds, w.bounds);
+
+            w.bounds = bounds;
+            w.visible = visible;
+            w.state = state;
+            w.version = version;
+        }
+
+        update_liveness();
+
+        // The cache changes where a cached widget changed, or where a widget
+        // moved between the cache and the live set
+        for (size_t i = 0; i < widgets_.size(); ++i) {
+            const Widget& w = widgets_[i];
+            bool cached = w.visible && !w.live;
+            if (was_cached[i] && (changed[i] || !cached)) add_dirty(old_bounds[i]);
+            if (cached && (changed[i] || !was_cached[i])) add_dirty(w.bounds);
+        }
+    }
+
+    void RetainedUI::rebuild(sparse_set<UIComponent>& components) {
+        widgets_.clear();
+        widgets_.reserve(components.size());
+        for (size_t i = 0; i < components.size(); ++i) {
+            IUIComponent* element = components[i]._ui_element.get();
+            Widget w{};
+            w.entity = components.entity_at(i);
+            w.element = element;
+            if (element) {
+                w.bounds = padded(element->getRenderBounds());
+                w.state = element->getState();
+                w.version = element->getVersion();
+                w.visible = element->isVisible();
+            }
+            widgets_.push_back(w);
+        }
+        index_dirty_ = true;
+        full_redraw_ = true;
+        update_liveness();
+    }
+
+    void RetainedUI::rebuild_index() {
+        float width = static_cast<float>(std::max(GetScreenWidth(), 1));
+        float height = static_cast<float>(std::max(GetScreenHeight(), 1));
+        AABB screen(0, 0, width, height);
+        if (index_.get_world_bounds() != screen) {
+            index_.configure(index_.get_cell_size(), screen);
+        }
+
+        index_.clear();
+        index_.reserve(widgets_.size());
+        for (size_t i = 0; i < widgets_.size(); ++i) {
+            if (widgets_[i].element && widgets_[i].visible) {
+                index_.insert(i, to_aabb(widgets_[i].bounds));
+            }
+        }
+        index_dirty_ = false;
+    }
+
+    void RetainedUI::update_liveness() {
+        if (index_dirty_) rebuild_index();
+
+        live_count_ = 0;
+        for (size_t i = 0; i < widgets_.size(); ++i) {
+            Widget& w = widgets_[i];
+            if (!w.element || !w.visible) {
+                w.live = false;
+                continue;
+            }
+
+            bool hot = w.change_streak >= HOT_STREAK && frame_ - w.last_change < HOT_COOLDOWN;
+            w.live = hot || w.element->isAnimated() ||
+                     w.state == UIState::Hovered || w.state == UIState::Pressed;
+
+            // A cached widget would end up under a live one drawn below it
+            if (!w.live && live_count_ > 0) {
+                index_.query(to_aabb(w.bounds), query_);
+                for (size_t j : query_) {
+                    if (j < i && widgets_[j].live && overlaps(widgets_[j].bounds, w.bounds)) {
+                        w.live = true;
+                        break;
+                    }
+                }
+            }
+            if (w.live) ++live_count_;
+        }
+    }
+
+    void RetainedUI::add_dirty(const Rectangle& area) {
+        if (empty(area)) return;
+        if (empty(dirty_)) {
+            dirty_ = area;
+            return;
+        }
+        float x0 = std::min(dirty_.x, area.x);
+        float y0 = std::min(dirty_.y, area.y);
+        float x1 = std::max(dirty_.x + dirty_.width, area.x + area.width);
+        float y1 = std::max(dirty_.y + dirty_.height, area.y + area.height);
+        dirty_ = {x0, y0, x1 - x0, y1 - y0};
+    }
+
+    size_t RetainedUI::hit_test(float x, float y) const {
+        if (index_dirty_) {
+            // Layout changed since the last sync(): fall back to a scan
+            for (size_t i = widgets_.size(); i-- > 0;) {
+                const Widget& w = widgets_[i];
+                if (w.element && w.element->isVisible() && w.element->isEnabled() && w.element->isPointInside(x, y)) {
+                    return w.entity;
+                }
+            }
+            return NO_ENTITY;
+        }
+
+        index_.query(AABB(x, y, 0, 0), query_);
+        size_t best = NO_ENTITY;
+        for (size_t i : query_) {
+            if (best != NO_ENTITY && i < best) continue;
+            const Widget& w = widgets_[i];
+            if (w.element->isVisible() && w.element->isEnabled() && w.element->isPointInside(x, y)) {
+                best = i;
+            }
+        }
+        return best == NO_ENTITY ? NO_ENTITY : widgets_[best].entity;
+    }
+
+    bool RetainedUI::ensure_cache() {
+        int width = std::max(GetScreenWidth(), 1);
+        int height = std::max(GetScreenHeight(), 1);
+        if (cache_.id != 0 && cache_.texture.width == width && cache_.texture.height == height) {
+            return false;
+        }
+        release();
+        cache_ = LoadRenderTexture(width, height);
+        return true;
+    }
+
+    void RetainedUI::redraw_cache() {
+        // Whole pixels, so the scissor covers every touched pixel
+        int x0 = static_cast<int>(std::floor(dirty_.x));
+        int y0 = static_cast<int>(std::floor(dirty_.y));
+        int x1 = static_cast<int>(std::ceil(dirty_.x + dirty_.width));
+        int y1 = static_cast<int>(std::ceil(dirty_.y + dirty_.height));
+        Rectangle region = {static_cast<float>(x0), static_cast<float>(y0),
+                            static_cast<float>(x1 - x0), static_cast<float>(y1 - y0)};
+
+        BeginTextureMode(cache_);
+        BeginScissorMode(x0, y0, x1 - x0, y1 - y0);
+        ClearBackground(BLANK);
+
+        // Keep the cache premultiplied so compositing it is exact for
+        // translucent widgets
+        rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                                  RL_FUNC_ADD, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+        for (const Widget& w : widgets_) {
+            if (w.visible && !w.live && overlaps(w.bounds, region)) {
+                w.element->render();
+                ++last_redraw_count_;
+            }
+        }
+        EndBlendMode();
+
+        EndScissorMode();
+        EndTextureMode();
+
+        last_dirty_ = region;
+        dirty_ = {0, 0, 0, 0};
+        full_redraw_ = false;
+    }
+
+    void RetainedUI::render() {
+        ++frame_;
+        last_redraw_count_ = 0;
+        last_dirty_ = {0, 0, 0, 0};
+
+        size_t visible = 0;
+        for (const Widget& w : widgets_) {
+            if (w.element && w.visible) ++visible;
+        }
+
+        if (visible > live_count_) {
+            if (ensure_cache()) full_redraw_ = true;
+            if (full_redraw_) {
+                dirty_ = {0, 0, static_cast<float>(cache_.texture.width), static_cast<float>(cache_.texture.height)};
+            }
+            if (!empty(dirty_)) redraw_cache();
+
+            // Render textures are stored bottom-up
+            Rectangle source = {0, 0, static_cast<float>(cache_.texture.width), -static_cast<float>(cache_.texture.height)};
+            BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+            DrawTextureRec(cache_.texture, source, {0, 0}, WHITE);
+            EndBlendMode();
+        } else {
+            // Nothing cached: whatever the cache holds is stale by the time it is used again
+            dirty_ = {0, 0, 0, 0};
+            full_redraw_ = true;
+        }
+
+        for (const Widget& w : widgets_) {
+            if (w.live) w.element->render();
+        }
+    }
+
+    void RetainedUI::release() {
+        if (cache_.id != 0) {
+            UnloadRenderTexture(cache_);
+            cache_ = {};
+        }
+        full_redraw_ = true;
+    }
+}
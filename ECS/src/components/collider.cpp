@@ -8,4 +8,5 @@
 #include "ECS/Components/Collider.hpp"
 
 collider::collider() {}
-collider::collider(float nw, float nh, float ox, float oy, bool trig) : w(nw), h(nh), offset_x(ox), offset_y(oy), is_trigger(trig) {}
+collider::collider(float nw, float nh, float ox, float oy, bool trig, uint32_t lyr, uint32_t msk)
+    : w(nw), h(nh), offset_x(ox), offset_y(oy), is_trigger(trig), layer(lyr), mask(msk) {}
@@ -28,6 +28,7 @@ extern "C" void register_components(registry &r) {
     r.register_component<collider>();
     r.register_component<sprite>();
     r.register_component<animation>();
+    r.register_component<parallax_layer>();
 }
 
 extern "C"
@@ -6,6 +6,8 @@
 */
 
 #include "ECS/Registry.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
+#include "ECS/Renderer/Particles/ParticlePool.hpp"
 
 #include <algorithm>
 
@@ -34,6 +36,20 @@ void registry::run_systems() {
     for (auto &s : _systems) s(*this);
 }
 
+PhysicsManager& registry::get_physics() {
+    if (!_physics) {
+        _physics = std::make_unique<PhysicsManager>();
+    }
+    return *_physics;
+}
+
+ParticlePool& registry::get_effects() {
+    if (!_effects) {
+        _effects = std::make_unique<ParticlePool>();
+    }
+    return *_effects;
+}
+
 void registry::set_random_seed(unsigned int seed) {
     _random_seed = seed;
     _seed_set = true;
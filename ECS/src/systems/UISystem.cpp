@@ -11,6 +11,13 @@
 #include <iostream>
 
 namespace UI {
+    UISystem::~UISystem() {
+        // The render texture belongs to the GL context
+        if (IsWindowReady()) {
+            _retained.release();
+        }
+    }
+
     void UISystem::update(registry& registry, float deltaTime) {
         if (!_enabled) return;
 
@@ -24,6 +31,8 @@ namespace UI {
                 ui_comp._ui_element->update(deltaTime);
             }
         }
+        // Hover states are settled: refresh the cache state and hit-test index
+        _retained.sync(*ui_components);
         this->process_input(registry);
         this->render(registry);
     }
@@ -42,11 +51,9 @@ namespace UI {
         auto* ui_components = registry.get_if<UI::UIComponent>();
         if (!ui_components) return;
 
-        for (auto [ui_comp, entity_id] : zipper(*ui_components)) {
-            if (ui_comp._ui_element) {
-                ui_comp._ui_element->render();
-            }
-        }
+        // Input callbacks may have changed widgets since update()
+        _retained.sync(*ui_components);
+        _retained.render();
     }
 
     void UISystem::handle_mouse_input(registry& registry) {
@@ -65,7 +72,7 @@ namespace UI {
 
         // Update focus on click
         if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
-            size_t clicked_entity = get_entity_at_position(registry, mouse_pos.x, mouse_pos.y);
+            size_t clicked_entity = get_entity_at_position(mouse_pos.x, mouse_pos.y);
             if (clicked_entity != static_cast<size_t>(-1)) {
                 set_focused_entity(clicked_entity);
             } else {
@@ -92,29 +99,9 @@ namespace UI {
         }
     }
 
-    size_t UISystem::get_entity_at_position(registry& registry, float x, float y) {
-        auto* ui_components = registry.get_if<UI::UIComponent>();
-        if (!ui_components) return static_cast<size_t>(-1);
-
-        // Store all clickable entities with their z-index
-        std::vector<std::pair<size_t, int>> clickable_entities;
-
-        // Use zipper to find all components under the cursor
-        for (auto [ui_comp, entity_id] : zipper(*ui_components)) {
-            if (ui_comp._ui_element &&
-                ui_comp._ui_element->isVisible() &&
-                ui_comp._ui_element->isEnabled() &&
-                ui_comp._ui_element->isPointInside(x, y)) {
-                clickable_entities.push_back({entity_id, 0});
-            }
-        }
-
-        // Return the last entity found (top-most in z-order)
-        if (!clickable_entities.empty()) {
-            return clickable_entities.back().first;
-        }
-
-        return static_cast<size_t>(-1); // No entity found
+    size_t UISystem::get_entity_at_position(float x, float y) const {
+        // Topmost in z-order, through the retained layer's spatial index
+        return _retained.hit_test(x, y);
     }
 } // namespace UI
 
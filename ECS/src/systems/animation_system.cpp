@@ -6,11 +6,13 @@
 */
 
 #include <raylib.h>
-#include <iostream>
+#include <atomic>
+#include <mutex>
 #include "ECS/Registry.hpp"
 #include "ECS/Components.hpp"
 #include "ECS/Zipper.hpp"
 #include "ECS/Renderer/RenderManager.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
 #include "ECS/Systems/Animation.hpp"
 
 static void killEnt(registry &r, std::vector<entity> ents)
@@ -20,59 +22,74 @@ static void killEnt(registry &r, std::vector<entity> ents)
     }
 }
 
-Texture2D AnimationSystem::load_texture(const std::string& path) {
-    auto it = texture_cache_.find(path);
-    if (it != texture_cache_.end()) {
-        return it->second;
-    }
-
-    Texture2D texture = LoadTexture(path.c_str());
-    if (texture.id == 0) {
-        std::cerr << "Failed to load texture: " << path << std::endl;
-        Image img = GenImageColor(1, 1, WHITE);
-        texture = LoadTextureFromImage(img);
-        UnloadImage(img);
-    }
-
-    texture_cache_[path] = texture;
-    return texture;
-}
-
 void AnimationSystem::update(registry& r, float dt) {
     auto *anim_arr = r.get_if<animation>();
     auto *pos_arr = r.get_if<position>();
-    std::vector<entity> entsToKill;
+    auto *vel_arr = r.get_if<velocity>();
 
     if (!anim_arr || !pos_arr) return;
 
-    for (auto [anim, pos, ent] : zipper(*anim_arr, *pos_arr)) {
-        if (anim.frame_count <= 0) {
-            Texture2D texture = load_texture(anim.texture_path);
-            if (texture.id != 0) {
-                anim.frame_count = static_cast<int>(texture.width / anim.frame_width);
+    auto &assets = AssetManager::instance();
+    auto &render = RenderManager::instance();
+    auto &anims = *anim_arr;
+
+    // Loading a texture needs the GL thread: stale refs and unknown frame
+    // counts are resolved here, the parallel pass below only reads them
+    uint32_t generation = assets.get_texture_generation();
+    for (auto &anim : anims) {
+        if (anim.resolved.generation == generation && anim.frame_count > 0) continue;
+        const texture_ref &tex = assets.resolve_texture(anim.texture_path, anim.resolved);
+        if (anim.frame_count <= 0 && tex.texture) {
+            anim.frame_count = static_cast<int>(tex.region.width / (anim.frame_width * tex.scale));
+        }
+    }
+
+    std::mutex killMutex;
+    std::vector<entity> entsToKill;
+    std::atomic<size_t> drawn{0};
+    std::atomic<size_t> culled{0};
+
+    // Each chunk owns its animations: frame timers advance and frames are
+    // recorded without touching another chunk's entities
+    render.get_queue().record(anims.size(), [&](size_t first, size_t last, RenderCommandList &out) {
+        std::vector<entity> chunkKills;
+        size_t chunkDrawn = 0;
+        size_t chunkCulled = 0;
+
+        for (size_t i = first; i < last; ++i) {
+            animation &anim = anims[i];
+            size_t ent = anims.entity_at(i);
+            if (anim.frame_count <= 0 || !pos_arr->has(ent)) continue;
+
+            if (shouldAdvance(anim, ent, vel_arr)) {
+                updateAnim(anim, dt, chunkKills, entity(ent));
+            }
+            if (renderAnim(anim, pos_arr->get(ent), out)) {
+                ++chunkDrawn;
             } else {
-                continue;
+                ++chunkCulled;
             }
         }
 
-        bool should_advance = shouldAdvance(anim, entity(ent), r);
-
-        if (should_advance) {
-            updateAnim(anim, dt, entsToKill, entity(ent));
+        drawn += chunkDrawn;
+        culled += chunkCulled;
+        if (!chunkKills.empty()) {
+            std::lock_guard<std::mutex> lock(killMutex);
+            entsToKill.insert(entsToKill.end(), chunkKills.begin(), chunkKills.end());
         }
-        renderAnim(anim, pos);
-    }
+    });
+
+    render.add_cull_stats(drawn, culled);
     killEnt(r, entsToKill);
 }
 
-bool AnimationSystem::shouldAdvance(animation &anim, entity ent, registry &r)
+bool AnimationSystem::shouldAdvance(const animation &anim, size_t ent, sparse_set<velocity> *vel_arr)
 {
     if (anim.play_on_movement) {
-        auto *vel_arr = r.get_if<velocity>();
-        if (!vel_arr || !vel_arr->has(static_cast<size_t>(ent))) {
+        if (!vel_arr || !vel_arr->has(ent)) {
             return false;
         } else {
-            auto &vel = vel_arr->get(static_cast<size_t>(ent));
+            auto &vel = vel_arr->get(ent);
             return (vel.vx != 0.0f || vel.vy != 0.0f);
         }
     }
@@ -101,34 +118,35 @@ void AnimationSystem::updateAnim(animation &anim, float dt, std::vector<entity>
     }
 }
 
-void AnimationSystem::renderAnim(animation &anim, position &pos)
+bool AnimationSystem::renderAnim(const animation &anim, const position &pos, RenderCommandList &out)
 {
-    Texture2D texture = load_texture(anim.texture_path);
-    if (texture.id != 0) {
-        Rectangle source = {
-            (float)(anim.current_frame * anim.frame_width),
-            0.0f,
-            anim.frame_width,
-            anim.frame_height
-        };
-
-        float scaled_width = anim.frame_width * anim.scale_x;
-        float scaled_height = anim.frame_height * anim.scale_y;
+    float scaled_width = anim.frame_width * anim.scale_x;
+    float scaled_height = anim.frame_height * anim.scale_y;
+
+    Rectangle dest = {
+        pos.x - scaled_width / 2.0f,
+        pos.y - scaled_height / 2.0f,
+        scaled_width, scaled_height
+    };
+    if (!RenderManager::instance().is_visible(dest)) {
+        return false;
+    }
 
-        Rectangle dest = {
-            pos.x - scaled_width / 2.0f,
-            pos.y - scaled_height / 2.0f,
-            scaled_width, scaled_height
+    if (anim.resolved.texture) {
+        // frame_width is in source image pixels, a baked texture is smaller
+        float scale = anim.resolved.scale;
+        Rectangle source = {
+            anim.resolved.region.x + anim.current_frame * anim.frame_width * scale,
+            anim.resolved.region.y,
+            anim.frame_width * scale,
+            anim.frame_height * scale
         };
 
         Vector2 origin = {0.0f, 0.0f};
 
-        RenderManager::instance().draw_sprite(&texture, source, dest, origin, 0.0f, WHITE, 0);
+        out.draw_sprite(*anim.resolved.texture, source, dest, origin, 0.0f, WHITE, 0);
     }
-}
-
-AnimationSystem::~AnimationSystem() {
-    texture_cache_.clear();
+    return true;
 }
 
 DLL_EXPORT ISystem* create_system() {
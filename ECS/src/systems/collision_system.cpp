@@ -8,12 +8,14 @@
 #include <iostream>
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <raylib.h>
 #include "ECS/Systems/Collision.hpp"
 #include "ECS/Registry.hpp"
 #include "ECS/Components.hpp"
 #include "ECS/Zipper.hpp"
 #include "ECS/Physics/PhysicsManager.hpp"
+#include "ECS/Physics/Collision/BatchCollisionDetector.hpp"
 
 using Rect = std::array<float,4>; // {minx, miny, maxx, maxy}
 
@@ -27,6 +29,22 @@ static inline Rect make_rect(const position &p, const collider &c)
     return { x, y, x + c.w, y + c.h };
 }
 
+// Bounds the broadphase and narrow phase see: the collider box, grown to
+// cover the move since last tick for continuous colliders
+static inline AABB collider_bounds(const position &p, const collider &c, const velocity *v, float dt)
+{
+    AABB box(p.x + c.offset_x, p.y + c.offset_y, c.w, c.h);
+    if (!c.continuous || !v) return box;
+
+    float dx = v->vx * dt;
+    float dy = v->vy * dt;
+    box.x -= std::max(dx, 0.0f);
+    box.y -= std::max(dy, 0.0f);
+    box.width += std::abs(dx);
+    box.height += std::abs(dy);
+    return box;
+}
+
 static inline bool rect_overlap(const Rect &a, const Rect &b)
 {
     return !(a[2] < b[0] || a[0] > b[2] || a[3] < b[1] || a[1] > b[3]);
@@ -47,22 +65,32 @@ static inline void resolve_penetration(position &pi, const Rect &a, position & /
 void CollisionSystem::update(registry& r, float dt) {
     auto *pos_arr = r.get_if<position>();
     auto *col_arr = r.get_if<collider>();
+    auto *vel_arr = r.get_if<velocity>();
     if (!pos_arr || !col_arr) return;
 
-    auto& physics = PhysicsManager::instance();
-    physics.clear();
+    auto vel_of = [vel_arr](size_t e) -> const velocity* {
+        return (vel_arr && vel_arr->has(e)) ? &vel_arr->get(e) : nullptr;
+    };
 
-    // Step 1: Insert all entities with colliders into spatial hash
+    auto& physics = r.get_physics();
+    physics.begin_frame();
+    physics.begin_contacts();
+
+    // Step 1: Refresh the broadphase; unmoved colliders are skipped and
+    // colliders gone since last tick are dropped by end_frame()
     for (auto [pi, ci, entity_i] : zipper(*pos_arr, *col_arr)) {
-        AABB bounds(pi.x + ci.offset_x, pi.y + ci.offset_y, ci.w, ci.h);
-        physics.update_entity(entity_i, bounds);
+        AABB bounds = collider_bounds(pi, ci, vel_of(entity_i), dt);
+        physics.update_entity(entity_i, bounds, CollisionFilter(ci.layer, ci.mask));
     }
+    physics.end_frame();
 
     // Step 2: Get only potential collision pairs (O(n) instead of O(n²))
-    auto collision_pairs = physics.get_collision_pairs();
+    physics.get_collision_pairs(collision_pairs_);
 
-    // Step 3: Check and resolve actual collisions
-    for (auto [entity_i, entity_j] : collision_pairs) {
+    // Step 3: Narrow phase over all candidates at once (SIMD batch)
+    narrow_batch_.clear();
+    candidates_.clear();
+    for (auto [entity_i, entity_j] : collision_pairs_) {
         // Check if both entities still exist before accessing them
         if (!pos_arr->has(static_cast<size_t>(entity_i)) || !col_arr->has(static_cast<size_t>(entity_i)) ||
             !pos_arr->has(static_cast<size_t>(entity_j)) || !col_arr->has(static_cast<size_t>(entity_j))) {
@@ -74,16 +102,31 @@ void CollisionSystem::update(registry& r, float dt) {
         auto& pj = pos_arr->get(static_cast<size_t>(entity_j));
         auto& cj = col_arr->get(static_cast<size_t>(entity_j));
 
+        narrow_batch_.push(collider_bounds(pi, ci, vel_of(entity_i), dt),
+                           collider_bounds(pj, cj, vel_of(entity_j), dt));
+        candidates_.push_back({entity_i, entity_j});
+    }
+    BatchCollisionDetector::test_aabb(narrow_batch_, hits_);
+
+    // Step 4: Report contacts and resolve actual collisions
+    for (uint32_t hit : hits_) {
+        auto [entity_i, entity_j] = candidates_[hit];
+
+        auto& pi = pos_arr->get(static_cast<size_t>(entity_i));
+        auto& ci = col_arr->get(static_cast<size_t>(entity_i));
+        auto& pj = pos_arr->get(static_cast<size_t>(entity_j));
+        auto& cj = col_arr->get(static_cast<size_t>(entity_j));
+
+        physics.add_contact(entity_i, ci.layer, entity_j, cj.layer);
+
+        // Triggers only report contacts, they are never pushed apart
+        if (ci.is_trigger || cj.is_trigger) continue;
+
+        // An earlier resolution this tick may already have separated them
         Rect a = make_rect(pi, ci);
         Rect b = make_rect(pj, cj);
-
         if (!rect_overlap(a, b)) continue;
 
-        if (ci.is_trigger || cj.is_trigger) {
-            std::cerr << "Trigger collision: " << entity_i << " <-> " << entity_j << "\n";
-            continue;
-        }
-
         resolve_penetration(pi, a, pj, b);
     }
 }
@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** parallax_system - Scrolls and queues cached background layers
+*/
+
+#include "ECS/Systems/Parallax.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/Components.hpp"
+#include "ECS/Renderer/RenderManager.hpp"
+
+ParallaxSystem::~ParallaxSystem() {
+    // Systems are destroyed with their state, while the window is still open
+    renderer_.unload();
+}
+
+void ParallaxSystem::update(registry& r, float dt) {
+    auto *layer_arr = r.get_if<parallax_layer>();
+    if (!layer_arr) {
+        renderer_.unload();
+        return;
+    }
+
+    auto& render = RenderManager::instance();
+    auto& layers = *layer_arr;
+    renderer_.prune([&layers](size_t entity) { return layers.has(entity); });
+
+    // Straight into the batch, which RenderManager keeps sorted by layer. The
+    // sort only orders what one flush() draws: these quads land under the
+    // sprites because logic systems update before any state renders, so they
+    // are queued when the sprite system flushes. Whatever a flush drew before
+    // they were queued would end up under them.
+    const Rectangle& view = render.get_view_rect();
+    for (size_t i = 0; i < layers.size(); ++i) {
+        parallax_layer& layer = layers[i];
+        ParallaxRenderer::scroll(layer, dt);
+        renderer_.draw(layers.entity_at(i), layer, view, render.get_batch());
+    }
+}
+
+DLL_EXPORT ISystem* create_system() {
+    try {
+        return new ParallaxSystem();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+DLL_EXPORT void destroy_system(ISystem* ptr) {
+    delete ptr;
+}
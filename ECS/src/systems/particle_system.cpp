@@ -0,0 +1,32 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** particle_system - Updates and draws the registry's effects pool
+*/
+
+#include "ECS/Systems/Particle.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/Renderer/RenderManager.hpp"
+
+void ParticleRenderSystem::update(registry& r, float dt) {
+    auto& render = RenderManager::instance();
+    auto& particles = r.get_effects();
+
+    particles.update(dt);
+    if (!particles.empty()) {
+        render.draw_particles(particles, BLEND_ADDITIVE);
+    }
+}
+
+DLL_EXPORT ISystem* create_system() {
+    try {
+        return new ParticleRenderSystem();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+DLL_EXPORT void destroy_system(ISystem* ptr) {
+    delete ptr;
+}
@@ -2,38 +2,18 @@
 ** EPITECH PROJECT, 2025
 ** R-Type
 ** File description:
-** sprite_system - Integrated with SpriteBatch for performance
+** sprite_system - Records sprites into the RenderQueue, in parallel chunks
 */
 
 #include <raylib.h>
-#include <iostream>
+#include <atomic>
+#include <cmath>
 #include "ECS/Systems/Sprite.hpp"
 #include "ECS/Registry.hpp"
 #include "ECS/Components.hpp"
 #include "ECS/Zipper.hpp"
 #include "ECS/Renderer/RenderManager.hpp"
-
-Texture2D SpriteRenderSystem::load_texture(const std::string& path) {
-    auto it = texture_cache_.find(path);
-    if (it != texture_cache_.end()) {
-        return it->second;
-    }
-
-    Texture2D texture = LoadTexture(path.c_str());
-    if (texture.id == 0) {
-        std::cerr << "Failed to load texture: " << path << std::endl;
-        // Create a default 1x1 white texture for missing textures
-        Image img = GenImageColor(1, 1, WHITE);
-        texture = LoadTextureFromImage(img);
-        UnloadImage(img);
-    } else {
-        std::cout << "Loaded texture: " << path << " (ID: " << texture.id << ")" << std::endl;
-        SetTextureFilter(texture, TEXTURE_FILTER_POINT);
-    }
-
-    texture_cache_[path] = texture;
-    return texture;
-}
+#include "ECS/AssetManager/AssetManager.hpp"
 
 void SpriteRenderSystem::update(registry& r, float dt) {
     auto *pos_arr = r.get_if<position>();
@@ -41,59 +21,87 @@ void SpriteRenderSystem::update(registry& r, float dt) {
     auto *collider_arr = r.get_if<collider>();
     if (!pos_arr || !sprite_arr) return;
 
-    auto& batch = RenderManager::instance().get_batch();
-    Vector2 origin = {0.0f, 0.0f};
-
-    for (auto [p, s, entity] : zipper(*pos_arr, *sprite_arr)) {
-        if (!s.visible) continue;
-
-        // Load texture and get pointer to cached texture (not a local copy!)
-        load_texture(s.texture_path);  // Ensure it's loaded into cache
-        auto it = texture_cache_.find(s.texture_path);
-        if (it == texture_cache_.end() || it->second.id == 0) continue; // Failed to load
-
-        Texture2D* texture = &it->second;  // Pointer to cached texture
-
-        // Use the exact dimensions specified in the sprite component
-        float display_width = s.width * s.scale_x;
-        float display_height = s.height * s.scale_y;
-
-        Rectangle source = {
-            (float)s.frame_x, (float)s.frame_y,
-            (s.frame_x == 0 && s.frame_y == 0) ? (float)texture->width : s.width,
-            (s.frame_x == 0 && s.frame_y == 0) ? (float)texture->height : s.height
-        };
-
-        Rectangle dest;
-        if (collider_arr && collider_arr->has(static_cast<size_t>(entity))) {
-            auto& collider_comp = collider_arr->get(static_cast<size_t>(entity));
-            float collider_center_x = p.x + collider_comp.offset_x + collider_comp.w / 2.0f;
-            float collider_center_y = p.y + collider_comp.offset_y + collider_comp.h / 2.0f;
-            dest = {
-                collider_center_x - display_width / 2.0f,
-                collider_center_y - display_height / 2.0f,
-                display_width, display_height
-            };
-        } else {
-            // No collider: treat position as center and draw centered
-            dest = {
-                p.x - display_width / 2.0f,
-                p.y - display_height / 2.0f,
-                display_width, display_height
-            };
-        }
+    auto& assets = AssetManager::instance();
+    auto& render = RenderManager::instance();
+    auto& sprites = *sprite_arr;
 
-        // Use SpriteBatch instead of direct DrawTexturePro
-        // layer = 0 by default (can be extended with a sprite.layer field later)
-        batch.draw(texture, source, dest, origin, s.rotation, WHITE, 0);
+    // Loading a texture needs the GL thread, so stale refs are resolved here
+    // and the recording below only reads them
+    uint32_t generation = assets.get_texture_generation();
+    for (auto& s : sprites) {
+        if (s.visible && s.resolved.generation != generation) {
+            assets.resolve_texture(s.texture_path, s.resolved);
+        }
     }
-    batch.flush();
-}
 
-SpriteRenderSystem::~SpriteRenderSystem() {
-    // Clear the texture cache without unloading textures
-    // Raylib will handle texture cleanup when the graphics context is destroyed
-    texture_cache_.clear();
+    std::atomic<size_t> drawn{0};
+    std::atomic<size_t> culled{0};
+    render.get_queue().record(sprites.size(), [&](size_t first, size_t last, RenderCommandList& out) {
+        Vector2 origin = {0.0f, 0.0f};
+        size_t chunk_drawn = 0;
+        size_t chunk_culled = 0;
+
+        for (size_t i = first; i < last; ++i) {
+            const sprite& s = sprites[i];
+            size_t entity = sprites.entity_at(i);
+            if (!s.visible || !s.resolved.texture || !pos_arr->has(entity)) continue;
+
+            const position& p = pos_arr->get(entity);
+            const Rectangle& region = s.resolved.region;
+
+            // Use the exact dimensions specified in the sprite component
+            float display_width = s.width * s.scale_x;
+            float display_height = s.height * s.scale_y;
+
+            // Frames are given in source image pixels; a baked texture is smaller
+            float scale = s.resolved.scale;
+            Rectangle source = {
+                region.x + s.frame_x * scale, region.y + s.frame_y * scale,
+                (s.frame_x == 0 && s.frame_y == 0) ? region.width : s.width * scale,
+                (s.frame_x == 0 && s.frame_y == 0) ? region.height : s.height * scale
+            };
+
+            Rectangle dest;
+            if (collider_arr && collider_arr->has(entity)) {
+                const auto& collider_comp = collider_arr->get(entity);
+                float collider_center_x = p.x + collider_comp.offset_x + collider_comp.w / 2.0f;
+                float collider_center_y = p.y + collider_comp.offset_y + collider_comp.h / 2.0f;
+                dest = {
+                    collider_center_x - display_width / 2.0f,
+                    collider_center_y - display_height / 2.0f,
+                    display_width, display_height
+                };
+            } else {
+                // No collider: treat position as center and draw centered
+                dest = {
+                    p.x - display_width / 2.0f,
+                    p.y - display_height / 2.0f,
+                    display_width, display_height
+                };
+            }
+
+            // Rotation pivots on the top-left corner, so a rotated sprite stays
+            // within its diagonal of that corner
+            Rectangle bounds = dest;
+            if (s.rotation != 0.0f) {
+                float reach = std::sqrt(dest.width * dest.width + dest.height * dest.height);
+                bounds = {dest.x - reach, dest.y - reach, reach * 2.0f, reach * 2.0f};
+            }
+            if (!render.is_visible(bounds)) {
+                ++chunk_culled;
+                continue;
+            }
+            ++chunk_drawn;
+
+            // layer = 0 by default (can be extended with a sprite.layer field later)
+            out.draw_sprite(*s.resolved.texture, source, dest, origin, s.rotation, WHITE, 0);
+        }
+        drawn += chunk_drawn;
+        culled += chunk_culled;
+    });
+
+    render.add_cull_stats(drawn, culled);
+    render.flush();
 }
 
 DLL_EXPORT ISystem* create_system() {
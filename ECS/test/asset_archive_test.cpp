@@ -0,0 +1,157 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetArchive Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/AssetManager/Archive/AssetArchive.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    // root/a.txt, root/sub/b.bin (every byte value), root/sub/deeper/c.txt
+    fs::path make_tree(const std::string& name) {
+        fs::path root = fs::temp_directory_path() / name;
+        fs::remove_all(root);
+        fs::create_directories(root / "sub" / "deeper");
+        std::ofstream(root / "a.txt") << "alpha";
+        std::ofstream bin(root / "sub" / "b.bin", std::ios::binary);
+        for (int i = 0; i < 256; ++i) bin.put(static_cast<char>(i));
+        bin.close();
+        std::ofstream(root / "sub" / "deeper" / "c.txt") << "c";
+        return root;
+    }
+}
+
+TEST_SUITE("AssetArchive Tests") {
+    TEST_CASE("Files read back from the mapping as written") {
+        fs::path root = make_tree("asset_archive_test_roundtrip");
+        fs::path pack = fs::temp_directory_path() / "asset_archive_test_roundtrip.rpak";
+
+        auto names = AssetArchive::collect(root.string());
+        REQUIRE(names == std::vector<std::string>{"a.txt", "sub/b.bin", "sub/deeper/c.txt"});
+        REQUIRE(AssetArchive::write(pack.string(), root.string(), names));
+        CHECK_FALSE(fs::exists(pack.string() + ".tmp"));
+
+        AssetArchive archive;
+        REQUIRE(archive.open(pack.string()));
+        CHECK(archive.size() == 3);
+
+        size_t size = 0;
+        const unsigned char* alpha = archive.find("a.txt", &size);
+        REQUIRE(alpha != nullptr);
+        CHECK(std::string(reinterpret_cast<const char*>(alpha), size) == "alpha");
+
+        const unsigned char* bin = archive.find("sub/b.bin", &size);
+        REQUIRE(bin != nullptr);
+        REQUIRE(size == 256);
+        for (int i = 0; i < 256; ++i) CHECK(bin[i] == i);
+        CHECK(reinterpret_cast<uintptr_t>(bin) % AssetArchive::ALIGNMENT == 0);
+
+        CHECK(archive.find("missing.txt") == nullptr);
+        archive.close();
+        CHECK_FALSE(archive.is_open());
+        CHECK(archive.find("a.txt") == nullptr);
+
+        fs::remove_all(root);
+        fs::remove(pack);
+    }
+
+    TEST_CASE("Listing a directory leaves out its subdirectories") {
+        fs::path root = make_tree("asset_archive_test_list");
+        fs::path pack = fs::temp_directory_path() / "asset_archive_test_list.rpak";
+        REQUIRE(AssetArchive::write(pack.string(), root.string(), AssetArchive::collect(root.string())));
+
+        AssetArchive archive;
+        REQUIRE(archive.open(pack.string()));
+        CHECK(archive.list("") == std::vector<std::string>{"a.txt"});
+        CHECK(archive.list("sub/") == std::vector<std::string>{"sub/b.bin"});
+        CHECK(archive.list("sub/deeper") == std::vector<std::string>{"sub/deeper/c.txt"});
+        CHECK(archive.list("none").empty());
+
+        fs::remove_all(root);
+        fs::remove(pack);
+    }
+
+    TEST_CASE("Anything but an archive fails to open") {
+        AssetArchive archive;
+        CHECK_FALSE(archive.open("/nonexistent/assets.rpak"));
+
+        fs::path junk = fs::temp_directory_path() / "asset_archive_test_junk.rpak";
+        std::ofstream(junk) << "definitely not an archive, but longer than a header";
+        CHECK_FALSE(archive.open(junk.string()));
+        CHECK_FALSE(archive.is_open());
+        fs::remove(junk);
+    }
+}
+
+TEST_SUITE("AssetManager archive Tests") {
+    TEST_CASE("Mounted files load from the archive, the rest from disk") {
+        fs::path root = make_tree("asset_archive_test_mount");
+        fs::path pack = fs::temp_directory_path() / "asset_archive_test_mount.rpak";
+        REQUIRE(AssetArchive::write(pack.string(), root.string(), AssetArchive::collect(root.string())));
+        // Only the archive has it now, and only the disk has the new one
+        fs::remove(root / "a.txt");
+        std::ofstream(root / "loose.txt") << "loose";
+
+        auto& assets = AssetManager::instance();
+        std::string base = root.string() + "/";
+        REQUIRE(assets.mount_archive(pack.string(), base));
+        CHECK(assets.in_archive(base + "a.txt"));
+        CHECK_FALSE(assets.in_archive(base + "loose.txt"));
+        CHECK_FALSE(assets.in_archive(root.string() + "_other/a.txt"));
+
+        int size = 0;
+        unsigned char* data = LoadFileData((base + "a.txt").c_str(), &size);
+        REQUIRE(data != nullptr);
+        CHECK(std::string(reinterpret_cast<char*>(data), size) == "alpha");
+        UnloadFileData(data);
+
+        data = LoadFileData((base + "loose.txt").c_str(), &size);
+        REQUIRE(data != nullptr);
+        CHECK(std::string(reinterpret_cast<char*>(data), size) == "loose");
+        UnloadFileData(data);
+
+        CHECK(assets.list_files(base + "sub/") == std::vector<std::string>{root.string() + "/sub/b.bin"});
+
+        assets.unmount_archive();
+        CHECK_FALSE(assets.in_archive(base + "a.txt"));
+        fs::remove_all(root);
+        fs::remove(pack);
+    }
+
+    TEST_CASE("Mounting trusts the archive over newer loose files") {
+        fs::path root = make_tree("asset_archive_test_stale");
+        fs::path pack = fs::temp_directory_path() / "asset_archive_test_stale.rpak";
+        REQUIRE(AssetArchive::write(pack.string(), root.string(), AssetArchive::collect(root.string())));
+        std::ofstream(root / "sub" / "deeper" / "c.txt") << "edited";
+
+        auto read = [](const std::string& path) {
+            int size = 0;
+            unsigned char* data = LoadFileData(path.c_str(), &size);
+            std::string text = data ? std::string(reinterpret_cast<char*>(data), size) : "";
+            UnloadFileData(data);
+            return text;
+        };
+
+        // No walk over the loose files: the packed copy wins until repacked
+        auto& assets = AssetManager::instance();
+        std::string base = root.string() + "/";
+        REQUIRE(assets.mount_archive(pack.string(), base));
+        CHECK(read(base + "sub/deeper/c.txt") == "c");
+
+        REQUIRE(AssetArchive::write(pack.string(), root.string(), AssetArchive::collect(root.string())));
+        REQUIRE(assets.mount_archive(pack.string(), base));
+        CHECK(read(base + "sub/deeper/c.txt") == "edited");
+        assets.unmount_archive();
+        fs::remove_all(root);
+        fs::remove(pack);
+    }
+}
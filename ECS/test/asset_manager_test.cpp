@@ -321,6 +321,55 @@ TEST_SUITE("AssetManager Tests") {
         CloseWindow();
     }
 
+    TEST_CASE("AssetManager resolve_texture caches the lookup in the ref") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+
+        create_test_texture("resolve.png");
+
+        auto& assets = AssetManager::instance();
+        assets.init();
+
+        texture_ref ref;
+        const texture_ref& first = assets.resolve_texture("resolve.png", ref);
+        REQUIRE(first.texture != nullptr);
+        CHECK(first.texture == assets.get_texture("resolve.png"));
+        CHECK(first.region.width == doctest::Approx(1.0f));
+        CHECK(ref.generation == assets.get_texture_generation());
+        CHECK(assets.texture_count() == 1);
+
+        // Same generation: the ref is returned as is
+        Texture2D* cached = ref.texture;
+        CHECK(assets.resolve_texture("resolve.png", ref).texture == cached);
+
+        // Unloading invalidates every ref handed out before it
+        uint32_t generation = assets.get_texture_generation();
+        assets.unload_texture("resolve.png");
+        CHECK(assets.get_texture_generation() != generation);
+        CHECK(ref.generation != assets.get_texture_generation());
+        CHECK(assets.resolve_texture("resolve.png", ref).texture != nullptr);
+
+        assets.shutdown();
+        std::filesystem::remove("resolve.png");
+        CloseWindow();
+    }
+
+    TEST_CASE("AssetManager resolve_texture does not retry a missing file") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+
+        auto& assets = AssetManager::instance();
+        assets.init();
+
+        texture_ref ref;
+        CHECK(assets.resolve_texture("missing_resolve.png", ref).texture == nullptr);
+        CHECK(ref.generation == assets.get_texture_generation());
+        CHECK(assets.texture_count() == 0);
+
+        assets.shutdown();
+        CloseWindow();
+    }
+
     TEST_CASE("AssetManager texture count accuracy with mixed operations") {
         SetTraceLogLevel(LOG_ERROR);
         InitWindow(1, 1, "Test");
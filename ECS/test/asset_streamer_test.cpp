@@ -0,0 +1,170 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** AssetStreamer Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/AssetManager/Streaming/AssetStreamer.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
+#include <raylib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST_SUITE("AssetStreamer Tests") {
+    TEST_CASE("Work runs on a worker, callbacks on the main thread") {
+        AssetStreamer streamer(2);
+        const std::thread::id main_thread = std::this_thread::get_id();
+        std::atomic<int> off_main{0};
+        int callbacks = 0;
+
+        for (int i = 0; i < 20; ++i) {
+            streamer.enqueue([&] {
+                if (std::this_thread::get_id() != main_thread) ++off_main;
+            }, [&] {
+                CHECK(std::this_thread::get_id() == main_thread);
+                ++callbacks;
+            });
+        }
+        CHECK(streamer.pending() == 20);
+        // Nothing is handed back before update()
+        CHECK(callbacks == 0);
+
+        streamer.finish();
+        CHECK(callbacks == 20);
+        CHECK(off_main == 20);
+        CHECK(streamer.pending() == 0);
+    }
+
+    TEST_CASE("update() runs at least one callback and stops at the budget") {
+        AssetStreamer streamer(0);
+        int callbacks = 0;
+        for (int i = 0; i < 5; ++i) {
+            streamer.enqueue([] {}, [&] { ++callbacks; });
+        }
+
+        CHECK(streamer.update(0.0) == 1);
+        CHECK(callbacks == 1);
+        CHECK(streamer.update(10.0) == 4);
+        CHECK(callbacks == 5);
+        CHECK(streamer.update() == 0);
+    }
+
+    TEST_CASE("update() does not wait for unfinished work") {
+        AssetStreamer streamer(1);
+        std::atomic<bool> release{false};
+        bool done = false;
+        streamer.enqueue([&] {
+            while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }, [&] { done = true; });
+
+        CHECK(streamer.update() == 0);
+        CHECK_FALSE(done);
+
+        release = true;
+        streamer.finish();
+        CHECK(done);
+    }
+
+    TEST_CASE("Callbacks can queue more work") {
+        AssetStreamer streamer(1);
+        int stage = 0;
+        streamer.enqueue([] {}, [&] {
+            stage = 1;
+            streamer.enqueue([] {}, [&] { stage = 2; });
+        });
+        streamer.finish();
+        CHECK(stage == 2);
+    }
+
+    TEST_CASE("A missing file resolves as failed") {
+        AssetStreamer streamer(1);
+        bool called = false;
+        streamer.load_image("missing_streamed.png", [&](Image image) {
+            called = true;
+            CHECK(image.data == nullptr);
+        });
+        streamer.finish();
+        CHECK(called);
+    }
+}
+
+TEST_SUITE("AssetManager streaming Tests") {
+    TEST_CASE("Texture requests share a handle and resolve in update()") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+        auto& assets = AssetManager::instance();
+
+        AssetHandle<Texture2D> first = assets.request_texture("missing_request.png");
+        AssetHandle<Texture2D> second = assets.request_texture("missing_request.png");
+        CHECK(first.valid());
+        CHECK(first.pending());
+        CHECK(second.pending());
+
+        // The render path never waits on a streaming texture
+        texture_ref ref;
+        CHECK(assets.resolve_texture("missing_request.png", ref).texture == nullptr);
+        CHECK(ref.generation != assets.get_texture_generation());
+
+        assets.get_streamer().finish();
+        CHECK(first.failed());
+        CHECK(second.failed());
+        CHECK(first.get() == nullptr);
+        CHECK(assets.texture_count() == 0);
+
+        assets.shutdown();
+        CloseWindow();
+    }
+
+    TEST_CASE("Unloading a texture while it streams fails its handle") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+        auto& assets = AssetManager::instance();
+
+        AssetHandle<Texture2D> handle = assets.request_texture("dropped.png");
+        assets.unload_texture("dropped.png");
+        CHECK(handle.failed());
+
+        assets.get_streamer().finish();
+        CHECK(handle.failed());
+        CHECK(assets.texture_count() == 0);
+
+        assets.shutdown();
+        CloseWindow();
+    }
+
+    TEST_CASE("Manifests keep an asset until the last one listing it is released") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+        auto& assets = AssetManager::instance();
+
+        AssetManifest menu{{"shared.png", "menu.png"}, {}};
+        AssetManifest game{{"shared.png"}, {"game.wav"}};
+        assets.acquire(menu);
+        assets.acquire(game);
+        CHECK_FALSE(assets.is_ready(menu));
+        CHECK_FALSE(assets.is_ready(game));
+
+        AssetHandle<Texture2D> shared = assets.request_texture("shared.png");
+        AssetHandle<Texture2D> menu_only = assets.request_texture("menu.png");
+        AssetHandle<Sound> sound = assets.request_sound("game.wav");
+        assets.release(menu);
+        CHECK(shared.pending());
+        CHECK(menu_only.failed());
+
+        assets.get_streamer().finish();
+        CHECK(assets.is_ready(game));
+        CHECK(sound.failed());
+
+        // Released twice: the extra release is ignored
+        assets.release(game);
+        assets.release(game);
+        CHECK(assets.is_ready(AssetManifest{}));
+
+        assets.shutdown();
+        CloseWindow();
+    }
+}
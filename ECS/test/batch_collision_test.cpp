@@ -0,0 +1,125 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "ECS/Physics/Collision/BatchCollisionDetector.hpp"
+#include <random>
+
+namespace {
+    std::vector<uint32_t> expected_aabb(const std::vector<AABB>& a, const std::vector<AABB>& b) {
+        std::vector<uint32_t> hits;
+        for (uint32_t i = 0; i < a.size(); ++i) {
+            if (CollisionDetector::check_aabb(a[i], b[i])) hits.push_back(i);
+        }
+        return hits;
+    }
+}
+
+TEST_SUITE("BatchCollisionDetector Tests") {
+    TEST_CASE("BatchCollisionDetector reports its backend") {
+        std::string backend = BatchCollisionDetector::get_backend();
+        CHECK((backend == "AVX" || backend == "SSE2" || backend == "scalar"));
+    }
+
+    TEST_CASE("BatchCollisionDetector handles empty batches") {
+        std::vector<uint32_t> hits{1, 2, 3};
+        CHECK(BatchCollisionDetector::test_aabb(AABBPairBatch{}, hits) == 0);
+        CHECK(hits.empty());
+        CHECK(BatchCollisionDetector::test_circle(CirclePairBatch{}, hits) == 0);
+        CHECK(BatchCollisionDetector::test_circle_aabb(CircleAABBPairBatch{}, hits) == 0);
+    }
+
+    TEST_CASE("BatchCollisionDetector AABB matches check_aabb") {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> pos(0.0f, 200.0f);
+        std::uniform_real_distribution<float> size(0.0f, 40.0f);
+
+        // 1003 pairs: not a multiple of the lane width, so the tail runs too
+        std::vector<AABB> a, b;
+        AABBPairBatch batch;
+        for (int i = 0; i < 1003; ++i) {
+            a.push_back(AABB{pos(rng), pos(rng), size(rng), size(rng)});
+            b.push_back(AABB{pos(rng), pos(rng), size(rng), size(rng)});
+            batch.push(a.back(), b.back());
+        }
+
+        std::vector<uint32_t> hits;
+        BatchCollisionDetector::test_aabb(batch, hits);
+        CHECK(hits == expected_aabb(a, b));
+        CHECK(!hits.empty());
+
+        std::vector<uint32_t> scalar_hits;
+        BatchCollisionDetector::test_aabb_scalar(batch, scalar_hits);
+        CHECK(hits == scalar_hits);
+    }
+
+    TEST_CASE("BatchCollisionDetector AABB counts touching edges as hits") {
+        AABBPairBatch batch;
+        for (int i = 0; i < 9; ++i) {
+            batch.push(AABB{0, 0, 10, 10}, AABB{10, 0, 10, 10});    // touching
+            batch.push(AABB{0, 0, 10, 10}, AABB{10.5f, 0, 10, 10}); // apart
+        }
+
+        std::vector<uint32_t> hits;
+        CHECK(BatchCollisionDetector::test_aabb(batch, hits) == 9);
+        for (size_t k = 0; k < hits.size(); ++k) {
+            CHECK(hits[k] == k * 2);
+        }
+    }
+
+    TEST_CASE("BatchCollisionDetector circles match check_circle") {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> pos(0.0f, 200.0f);
+        std::uniform_real_distribution<float> radius(0.0f, 30.0f);
+
+        CirclePairBatch batch;
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < 517; ++i) {
+            Vector2 ca{pos(rng), pos(rng)};
+            Vector2 cb{pos(rng), pos(rng)};
+            float ra = radius(rng);
+            float rb = radius(rng);
+            batch.push(ca, ra, cb, rb);
+            if (CollisionDetector::check_circle(ca, ra, cb, rb)) expected.push_back(i);
+        }
+
+        std::vector<uint32_t> hits;
+        BatchCollisionDetector::test_circle(batch, hits);
+        CHECK(hits == expected);
+    }
+
+    TEST_CASE("BatchCollisionDetector circle-AABB matches scalar closest-point test") {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> pos(0.0f, 200.0f);
+        std::uniform_real_distribution<float> size(1.0f, 60.0f);
+        std::uniform_real_distribution<float> radius(0.0f, 20.0f);
+
+        CircleAABBPairBatch batch;
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < 777; ++i) {
+            Vector2 c{pos(rng), pos(rng)};
+            float r = radius(rng);
+            AABB box{pos(rng), pos(rng), size(rng), size(rng)};
+            batch.push(c, r, box);
+            if (CollisionDetector::check_circle_aabb(c, r, box)) expected.push_back(i);
+        }
+
+        std::vector<uint32_t> hits;
+        BatchCollisionDetector::test_circle_aabb(batch, hits);
+        CHECK(hits == expected);
+
+        std::vector<uint32_t> scalar_hits;
+        BatchCollisionDetector::test_circle_aabb_scalar(batch, scalar_hits);
+        CHECK(hits == scalar_hits);
+    }
+
+    TEST_CASE("BatchCollisionDetector reuses the batch after clear") {
+        AABBPairBatch batch;
+        batch.push(AABB{0, 0, 10, 10}, AABB{5, 5, 10, 10});
+        batch.clear();
+        CHECK(batch.size() == 0);
+
+        batch.push(AABB{0, 0, 10, 10}, AABB{50, 50, 10, 10});
+        std::vector<uint32_t> hits;
+        CHECK(BatchCollisionDetector::test_aabb(batch, hits) == 0);
+    }
+}
@@ -0,0 +1,115 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "ECS/Messaging/CommandDispatcher.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace {
+    struct GetHealth {
+        using Reply = int;
+        size_t entity_id;
+    };
+
+    struct GetName {
+        using Reply = std::string;
+        size_t entity_id;
+    };
+
+    struct Unhandled {
+        using Reply = float;
+    };
+}
+
+TEST_SUITE("CommandDispatcher Tests") {
+    TEST_CASE("CommandDispatcher string command dispatch") {
+        CommandDispatcher dispatcher;
+
+        dispatcher.register_handler("get_health", [](Command& cmd) {
+            cmd.set_reply("health", static_cast<int>(cmd.get_param<size_t>("entity_id")) * 10);
+        });
+
+        Command cmd(CommandType::CUSTOM, "get_health");
+        cmd.set_param("entity_id", static_cast<size_t>(4));
+        CHECK(dispatcher.dispatch(cmd));
+        CHECK(cmd.get_reply<int>("health") == 40);
+    }
+
+    TEST_CASE("CommandDispatcher typed command ids are dense and stable") {
+        CommandId health = command_id<GetHealth>();
+        CommandId name = command_id<GetName>();
+
+        CHECK(health != name);
+        CHECK(command_id<GetHealth>() == health);
+        CHECK(command_id<GetName>() == name);
+    }
+
+    TEST_CASE("CommandDispatcher typed command returns reply by value") {
+        CommandDispatcher dispatcher;
+
+        dispatcher.register_handler<GetHealth>([](const GetHealth& cmd) {
+            return static_cast<int>(cmd.entity_id) * 10;
+        });
+        dispatcher.register_handler<GetName>([](const GetName& cmd) {
+            return "entity_" + std::to_string(cmd.entity_id);
+        });
+
+        auto health = dispatcher.dispatch(GetHealth{7});
+        auto name = dispatcher.dispatch(GetName{3});
+
+        REQUIRE(health.has_value());
+        REQUIRE(name.has_value());
+        CHECK(*health == 70);
+        CHECK(*name == "entity_3");
+    }
+
+    TEST_CASE("CommandDispatcher typed command without handler") {
+        CommandDispatcher dispatcher;
+
+        CHECK_FALSE(dispatcher.dispatch(Unhandled{}).has_value());
+        CHECK(dispatcher.get_handler_count<Unhandled>() == 0);
+    }
+
+    TEST_CASE("CommandDispatcher typed handler is replaced on re-register") {
+        CommandDispatcher dispatcher;
+
+        dispatcher.register_handler<GetHealth>([](const GetHealth&) { return 1; });
+        dispatcher.register_handler<GetHealth>([](const GetHealth&) { return 2; });
+
+        CHECK(dispatcher.get_handler_count<GetHealth>() == 1);
+        CHECK(dispatcher.dispatch(GetHealth{0}).value_or(0) == 2);
+    }
+
+    TEST_CASE("CommandDispatcher typed handler unregister") {
+        CommandDispatcher dispatcher;
+
+        auto id = dispatcher.register_handler<GetHealth>([](const GetHealth&) { return 5; });
+        CHECK(dispatcher.dispatch(GetHealth{0}).has_value());
+
+        dispatcher.unregister_handler(id);
+        CHECK_FALSE(dispatcher.dispatch(GetHealth{0}).has_value());
+        CHECK(dispatcher.get_handler_count<GetHealth>() == 0);
+    }
+
+    TEST_CASE("CommandDispatcher typed handler exception yields no reply") {
+        CommandDispatcher dispatcher;
+
+        dispatcher.register_handler<GetHealth>([](const GetHealth&) -> int {
+            throw std::runtime_error("boom");
+        });
+
+        CHECK_FALSE(dispatcher.dispatch(GetHealth{0}).has_value());
+    }
+
+    TEST_CASE("CommandDispatcher clear_all removes typed and string handlers") {
+        CommandDispatcher dispatcher;
+
+        dispatcher.register_handler("ping", [](Command& cmd) { cmd.set_reply("pong", true); });
+        dispatcher.register_handler<GetHealth>([](const GetHealth&) { return 1; });
+
+        dispatcher.clear_all();
+
+        CHECK(dispatcher.get_handler_count("ping") == 0);
+        CHECK(dispatcher.get_handler_count<GetHealth>() == 0);
+    }
+}
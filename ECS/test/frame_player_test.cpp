@@ -0,0 +1,192 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** FramePlayer Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/Renderer/Video/FramePlayer.hpp"
+#include "ECS/Renderer/Video/FramePack.hpp"
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    // Frame i is filled with the byte i
+    class CountingDecoder : public IFrameDecoder {
+        public:
+            CountingDecoder(size_t frames, std::atomic<size_t>& decoded)
+                : frames_(frames), decoded_(decoded) {}
+
+            int width() const override { return 2; }
+            int height() const override { return 2; }
+            float frame_rate() const override { return 10.0f; }
+            size_t frame_count() const override { return frames_; }
+            bool decode_next(unsigned char* rgba) override {
+                if (next_ >= frames_) return false;
+                for (int i = 0; i < 16; ++i) rgba[i] = static_cast<unsigned char>(next_);
+                ++next_;
+                ++decoded_;
+                return true;
+            }
+
+        private:
+            size_t frames_;
+            size_t next_{0};
+            std::atomic<size_t>& decoded_;
+    };
+}
+
+TEST_SUITE("FramePlayer Tests") {
+    TEST_CASE("Decodes no further ahead than the ring") {
+        AssetStreamer streamer(0);
+        std::atomic<size_t> decoded{0};
+        FramePlayer player(streamer, 3);
+
+        REQUIRE(player.open(std::make_unique<CountingDecoder>(20, decoded)));
+        CHECK(player.get_texture() == nullptr);
+        for (int i = 0; i < 10; ++i) streamer.update(10.0);
+        CHECK(decoded == 3);
+
+        player.update(0.0f);
+        CHECK(player.get_frame_index() == 1);
+        CHECK(player.get_texture() != nullptr);
+        streamer.update(10.0);
+        CHECK(decoded == 4);
+    }
+
+    TEST_CASE("Shows frames at the clip's rate and finishes") {
+        AssetStreamer streamer(0);
+        std::atomic<size_t> decoded{0};
+        FramePlayer player(streamer, 4);
+        REQUIRE(player.open(std::make_unique<CountingDecoder>(3, decoded)));
+
+        streamer.update(10.0);
+        player.update(0.0f);
+        CHECK(player.get_frame_index() == 1);
+
+        // 10 fps: nothing new before 0.1 s
+        player.update(0.05f);
+        CHECK(player.get_frame_index() == 1);
+        player.update(0.06f);
+        CHECK(player.get_frame_index() == 2);
+        CHECK_FALSE(player.is_finished());
+
+        streamer.update(10.0);
+        player.update(0.1f);
+        CHECK(player.get_frame_index() == 3);
+        streamer.update(10.0);
+        CHECK(player.is_finished());
+        CHECK(player.get_dropped_frames() == 0);
+    }
+
+    TEST_CASE("A long frame drops the frames it skipped over") {
+        AssetStreamer streamer(0);
+        std::atomic<size_t> decoded{0};
+        FramePlayer player(streamer, 4);
+        REQUIRE(player.open(std::make_unique<CountingDecoder>(10, decoded)));
+
+        streamer.update(10.0);
+        player.update(0.0f);
+        player.update(0.35f);
+        CHECK(player.get_frame_index() == 2);
+        CHECK(player.get_dropped_frames() == 2);
+    }
+
+    TEST_CASE("Holds the current frame while decoding is behind") {
+        AssetStreamer streamer(0);
+        std::atomic<size_t> decoded{0};
+        FramePlayer player(streamer, 2);
+        REQUIRE(player.open(std::make_unique<CountingDecoder>(10, decoded)));
+
+        streamer.update(10.0);
+        player.update(0.0f);
+        player.update(0.1f);
+        CHECK(player.get_frame_index() == 2);
+        // Ring empty: a late frame is shown when it arrives, not skipped
+        player.update(0.5f);
+        CHECK(player.get_frame_index() == 2);
+        streamer.update(10.0);
+        player.update(0.0f);
+        CHECK(player.get_frame_index() == 3);
+        CHECK(player.get_dropped_frames() == 0);
+    }
+
+    TEST_CASE("Closing while a frame decodes drops it") {
+        AssetStreamer streamer(1);
+        std::atomic<size_t> decoded{0};
+        {
+            FramePlayer player(streamer, 4);
+            REQUIRE(player.open(std::make_unique<CountingDecoder>(100, decoded)));
+        }
+        streamer.finish();
+        CHECK(decoded <= 1);
+        CHECK(streamer.pending() == 0);
+    }
+
+    TEST_CASE("Decoders are picked by extension") {
+        CHECK(FramePlayer::open_decoder("cutscene.unknown") == nullptr);
+        CHECK(FramePlayer::open_decoder("missing.frames") == nullptr);
+
+        std::atomic<size_t> decoded{0};
+        float asked_rate = 0.0f;
+        FramePlayer::register_decoder(".TEST", [&](const std::string&, float rate) -> std::unique_ptr<IFrameDecoder> {
+            asked_rate = rate;
+            return std::make_unique<CountingDecoder>(1, decoded);
+        });
+        auto decoder = FramePlayer::open_decoder("clip.test", 24.0f);
+        REQUIRE(decoder != nullptr);
+        CHECK(decoder->frame_count() == 1);
+        CHECK(asked_rate == 24.0f);
+    }
+
+    TEST_CASE("Image sequences are ordered by frame number") {
+        namespace fs = std::filesystem;
+        fs::path dir = fs::temp_directory_path() / "frame_player_test_sequence";
+        fs::create_directories(dir);
+        for (const char* name : {"clip10.png", "clip2.png", "clip1.png", "notes.txt"}) {
+            std::ofstream(dir / name) << "x";
+        }
+
+        auto frames = ImageSequenceDecoder::list_frames(dir.string());
+        REQUIRE(frames.size() == 3);
+        CHECK(fs::path(frames[0]).filename() == "clip1.png");
+        CHECK(fs::path(frames[1]).filename() == "clip2.png");
+        CHECK(fs::path(frames[2]).filename() == "clip10.png");
+
+        fs::remove_all(dir);
+    }
+
+    TEST_CASE("A frame pack is stale until written after its frames") {
+        namespace fs = std::filesystem;
+        fs::path pack = fs::temp_directory_path() / "frame_player_test.frames";
+        fs::remove(pack);
+        CHECK(FramePack::is_stale(pack.string(), {}));
+
+        std::ofstream(pack) << "x";
+        CHECK_FALSE(FramePack::is_stale(pack.string(), {}));
+        // Not a frame pack: opens as empty
+        CHECK_FALSE(FramePack(pack.string()).is_open());
+        fs::remove(pack);
+    }
+
+    TEST_CASE("A frame pack that fails to write leaves nothing behind") {
+        namespace fs = std::filesystem;
+        fs::path dir = fs::temp_directory_path() / "frame_player_test_partial";
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        Image image = GenImageColor(2, 2, RED);
+        ExportImage(image, (dir / "frame_0.png").string().c_str());
+        UnloadImage(image);
+
+        // The second frame is missing: the write stops halfway
+        fs::path pack = dir / "intro.frames";
+        CHECK_FALSE(FramePack::write(pack.string(), {(dir / "frame_0.png").string(), (dir / "frame_1.png").string()}, 10.0f));
+        CHECK_FALSE(fs::exists(pack));
+        CHECK_FALSE(fs::exists(pack.string() + ".tmp"));
+        fs::remove_all(dir);
+    }
+}
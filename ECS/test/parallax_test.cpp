@@ -0,0 +1,146 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** ParallaxRenderer Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/Renderer/Parallax/ParallaxRenderer.hpp"
+
+namespace {
+    parallax_layer counting_layer(int& paints, float depth = 0.0f) {
+        parallax_layer layer([&paints](int, int) { ++paints; }, depth, -100.0f);
+        layer.tile_width = 512;
+        layer.tile_height = 256;
+        return layer;
+    }
+}
+
+TEST_SUITE("ParallaxRenderer Tests") {
+    TEST_CASE("Unset tile sizes follow the screen") {
+        parallax_layer layer;
+        int width = 0, height = 0;
+        ParallaxRenderer::tile_size(layer, width, height);
+        CHECK(width == GetScreenWidth());
+        CHECK(height == GetScreenHeight());
+
+        layer.tile_width = 300;
+        ParallaxRenderer::tile_size(layer, width, height);
+        CHECK(width == 300);
+        CHECK(height == GetScreenHeight());
+    }
+
+    TEST_CASE("Drift stays within the tile") {
+        int paints = 0;
+        parallax_layer layer = counting_layer(paints);
+        ParallaxRenderer::scroll(layer, 1.0f);
+        CHECK(layer.offset_x == doctest::Approx(412.0f));   // -100 wrapped into [0, 512)
+        for (int i = 0; i < 100; ++i) ParallaxRenderer::scroll(layer, 1.0f);
+        CHECK(layer.offset_x >= 0.0f);
+        CHECK(layer.offset_x < 512.0f);
+        CHECK(layer.offset_x == doctest::Approx(-101.0f * 100.0f + 20.0f * 512.0f));
+        CHECK(layer.offset_y == 0.0f);
+    }
+
+    TEST_CASE("Source follows the camera scaled by depth") {
+        int paints = 0;
+        parallax_layer layer = counting_layer(paints, 0.5f);
+        Rectangle view = {300.0f, 0.0f, 1920.0f, 1080.0f};
+
+        Rectangle source = ParallaxRenderer::source_rect(layer, view);
+        CHECK(source.x == doctest::Approx(150.0f));
+        CHECK(source.y == doctest::Approx(0.0f));
+        CHECK(source.width == doctest::Approx(1920.0f));
+        CHECK(source.height == doctest::Approx(1080.0f));
+
+        // Content drifted 50px left: the tile is read 50px further right
+        layer.offset_x = -50.0f;
+        CHECK(ParallaxRenderer::source_rect(layer, view).x == doctest::Approx(200.0f));
+
+        // A screen-fixed layer ignores the camera
+        layer.depth = 0.0f;
+        layer.offset_x = 0.0f;
+        CHECK(ParallaxRenderer::source_rect(layer, view).x == doctest::Approx(0.0f));
+
+        // Far along the level, still within the tile
+        layer.depth = 1.0f;
+        view.x = 100000.0f;
+        source = ParallaxRenderer::source_rect(layer, view);
+        CHECK(source.x == doctest::Approx(100000.0f - 195.0f * 512.0f));
+    }
+
+    TEST_CASE("A layer is painted once and queued once per frame") {
+        int paints = 0;
+        parallax_layer layer = counting_layer(paints);
+        layer.layer = -50;
+        ParallaxRenderer renderer;
+        SpriteBatch batch;
+        Rectangle view = {0.0f, 0.0f, 1920.0f, 1080.0f};
+
+        for (int frame = 0; frame < 5; ++frame) {
+            batch.begin();
+            renderer.draw(7, layer, view, batch);
+            CHECK(batch.get_draw_call_count() == 1);
+            batch.end();
+        }
+        CHECK(paints == 1);
+        CHECK(renderer.get_paint_count() == 1);
+        CHECK(renderer.get_tile_count() == 1);
+
+        batch.begin();
+        layer.repaint = true;
+        renderer.draw(7, layer, view, batch);
+        CHECK(paints == 2);
+        CHECK_FALSE(layer.repaint);
+
+        // A new tile size paints a new tile
+        layer.tile_width = 1024;
+        renderer.draw(7, layer, view, batch);
+        CHECK(paints == 3);
+        CHECK(renderer.get_tile_count() == 1);
+        batch.end();
+        renderer.unload();
+        CHECK(renderer.get_tile_count() == 0);
+    }
+
+    TEST_CASE("Layers without a painter or a view draw nothing") {
+        ParallaxRenderer renderer;
+        SpriteBatch batch;
+        batch.begin();
+        parallax_layer empty;
+        renderer.draw(1, empty, {0.0f, 0.0f, 100.0f, 100.0f}, batch);
+
+        int paints = 0;
+        parallax_layer layer = counting_layer(paints);
+        renderer.draw(2, layer, {0.0f, 0.0f, 0.0f, 0.0f}, batch);
+        CHECK(batch.get_draw_call_count() == 0);
+        CHECK(paints == 0);
+        CHECK(renderer.get_tile_count() == 0);
+        batch.end();
+    }
+
+    TEST_CASE("Tiles of removed layers are freed") {
+        int paints = 0;
+        parallax_layer back = counting_layer(paints, 0.2f);
+        parallax_layer front = counting_layer(paints, 0.8f);
+        ParallaxRenderer renderer;
+        SpriteBatch batch;
+        Rectangle view = {0.0f, 0.0f, 1920.0f, 1080.0f};
+        batch.begin();
+        renderer.draw(1, back, view, batch);
+        renderer.draw(2, front, view, batch);
+        batch.end();
+        CHECK(renderer.get_tile_count() == 2);
+
+        renderer.prune([](size_t entity) { return entity == 2; });
+        CHECK(renderer.get_tile_count() == 1);
+
+        // The survivor keeps its tile
+        batch.begin();
+        renderer.draw(2, front, view, batch);
+        batch.end();
+        CHECK(paints == 2);
+    }
+}
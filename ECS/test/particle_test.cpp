@@ -0,0 +1,157 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/Renderer/Particles/ParticleRenderer.hpp"
+#include "ECS/Registry.hpp"
+#include <raylib.h>
+#include <cmath>
+
+static ParticleSpawn make_particle(float x, float y, float vx, float life) {
+    ParticleSpawn particle;
+    particle.position = {x, y};
+    particle.velocity = {vx, 0.0f};
+    particle.life = life;
+    return particle;
+}
+
+TEST_SUITE("ParticlePool Tests") {
+    TEST_CASE("Particles move by their velocity") {
+        ParticlePool pool(8);
+        REQUIRE(pool.spawn(make_particle(10.0f, 20.0f, 100.0f, 1.0f)));
+
+        pool.update(0.5f);
+        CHECK(pool.x()[0] == doctest::Approx(60.0f));
+        CHECK(pool.y()[0] == doctest::Approx(20.0f));
+        CHECK(pool.age()[0] == doctest::Approx(0.5f));
+    }
+
+    TEST_CASE("Dead particles are removed and the live ones stay packed") {
+        ParticlePool pool(8);
+        pool.spawn(make_particle(0.0f, 0.0f, 0.0f, 0.1f));
+        pool.spawn(make_particle(1.0f, 0.0f, 0.0f, 1.0f));
+        pool.spawn(make_particle(2.0f, 0.0f, 0.0f, 0.1f));
+        pool.spawn(make_particle(3.0f, 0.0f, 0.0f, PARTICLE_IMMORTAL));
+
+        pool.update(0.2f);
+        REQUIRE(pool.size() == 2);
+        float a = pool.x()[0];
+        float b = pool.x()[1];
+        CHECK(((a == 1.0f && b == 3.0f) || (a == 3.0f && b == 1.0f)));
+
+        pool.update(10.0f);
+        REQUIRE(pool.size() == 1);
+        CHECK(pool.x()[0] == 3.0f);
+    }
+
+    TEST_CASE("A full pool refuses new particles") {
+        ParticlePool pool(2);
+        CHECK(pool.spawn(make_particle(0, 0, 0, 1)));
+        CHECK(pool.spawn(make_particle(0, 0, 0, 1)));
+        CHECK_FALSE(pool.spawn(make_particle(0, 0, 0, 1)));
+        CHECK(pool.burst(10, 1.0f, 2.0f, make_particle(0, 0, 0, 1)) == 0);
+
+        pool.clear();
+        CHECK(pool.empty());
+    }
+
+    TEST_CASE("Bursts leave the origin within the speed range") {
+        ParticlePool pool(64);
+        CHECK(pool.burst(32, 50.0f, 100.0f, make_particle(100.0f, 100.0f, 0.0f, 1.0f)) == 32);
+
+        for (size_t i = 0; i < pool.size(); ++i) {
+            float speed = std::sqrt(pool.vx()[i] * pool.vx()[i] + pool.vy()[i] * pool.vy()[i]);
+            CHECK(speed > 49.9f);
+            CHECK(speed < 100.1f);
+            CHECK(pool.life()[i] <= 1.0f);
+            CHECK(pool.x()[i] == 100.0f);
+        }
+    }
+
+    TEST_CASE("Wrapped particles come back on the right edge") {
+        ParticlePool pool(4);
+        pool.set_wrap({-10.0f, 0.0f, 820.0f, 600.0f});
+        pool.spawn(make_particle(-5.0f, 50.0f, -100.0f, PARTICLE_IMMORTAL));
+
+        pool.update(0.1f);
+        REQUIRE(pool.size() == 1);
+        CHECK(pool.x()[0] == 810.0f);
+        CHECK(pool.y()[0] >= 0.0f);
+        CHECK(pool.y()[0] < 600.0f);
+    }
+
+    TEST_CASE("Same seed, same particles") {
+        ParticlePool a(16, 42);
+        ParticlePool b(16, 42);
+        a.burst(16, 10.0f, 20.0f, make_particle(0, 0, 0, 1));
+        b.burst(16, 10.0f, 20.0f, make_particle(0, 0, 0, 1));
+        for (size_t i = 0; i < 16; ++i) {
+            CHECK(a.vx()[i] == b.vx()[i]);
+            CHECK(a.vy()[i] == b.vy()[i]);
+        }
+    }
+
+    TEST_CASE("Each registry owns its own effects pool") {
+        registry a;
+        registry b;
+
+        // Nothing drew a yet: no pool to spawn effects into
+        CHECK(a.find_effects() == nullptr);
+        ParticlePool& effects = a.get_effects();
+        CHECK(a.find_effects() == &effects);
+        CHECK(&b.get_effects() != &effects);
+
+        effects.burst(8, 10.0f, 20.0f, make_particle(0, 0, 0, 1));
+        CHECK(effects.size() == 8);
+        CHECK(b.get_effects().empty());
+    }
+}
+
+TEST_SUITE("ParticleRenderer Tests") {
+    TEST_CASE("Each particle becomes one quad with faded alpha") {
+        ParticlePool pool(4);
+        ParticleSpawn particle = make_particle(50.0f, 40.0f, 0.0f, 2.0f);
+        particle.size = 3.0f;
+        particle.color = {200, 100, 50, 255};
+        pool.spawn(particle);
+        pool.update(1.0f);
+
+        ParticleRenderer renderer;
+        renderer.build(pool, 0.0f);
+        const auto& vertices = renderer.get_vertices();
+        REQUIRE(vertices.size() == 4);
+        CHECK(vertices[0].x == 47.0f);
+        CHECK(vertices[0].y == 37.0f);
+        CHECK(vertices[2].x == 53.0f);
+        CHECK(vertices[2].y == 43.0f);
+        CHECK(vertices[0].color.r == 200);
+        CHECK(vertices[0].color.a == 127);
+    }
+
+    TEST_CASE("Non-fading particles keep their alpha") {
+        ParticlePool pool(4);
+        ParticleSpawn particle = make_particle(0.0f, 0.0f, 0.0f, PARTICLE_IMMORTAL);
+        particle.fade = false;
+        pool.spawn(particle);
+        pool.update(100.0f);
+
+        ParticleRenderer renderer;
+        renderer.build(pool, 0.0f);
+        CHECK(renderer.get_vertices()[0].color.a == 255);
+    }
+
+    TEST_CASE("A pool is drawn in one call") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+
+        ParticlePool pool(1000);
+        pool.burst(1000, 10.0f, 20.0f, make_particle(0, 0, 0, 1));
+
+        ParticleRenderer renderer;
+        BeginDrawing();
+        renderer.draw(pool, 0.0f);
+        EndDrawing();
+        CHECK(renderer.get_last_draw_calls() == 1);
+
+        renderer.unload();
+        CloseWindow();
+    }
+}
@@ -8,7 +8,13 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 #include "ECS/Physics/PhysicsManager.hpp"
+#include "ECS/Components/Collider.hpp"
+#include "ECS/Registry.hpp"
 #include <raylib.h>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
 
 TEST_SUITE("PhysicsManager Tests") {
     TEST_CASE("PhysicsManager is a singleton") {
@@ -457,4 +463,215 @@ TEST_SUITE("PhysicsManager Tests") {
             CHECK_FALSE(physics.check_collision(a, b));
         }
     }
+
+    TEST_CASE("PhysicsManager sorts contacts into tracked layer pairs") {
+        auto& physics = PhysicsManager::instance();
+        physics.init(64.0f);
+        physics.track_contacts(CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY);
+        physics.track_contacts(CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY);
+        physics.begin_contacts();
+
+        // Either argument order lands as (bullet, enemy)
+        physics.add_contact(1, CollisionLayer::PLAYER_BULLET, 2, CollisionLayer::ENEMY);
+        physics.add_contact(4, CollisionLayer::ENEMY, 3, CollisionLayer::PLAYER_BULLET);
+        physics.add_contact(5, CollisionLayer::PLAYER, 6, CollisionLayer::ENEMY);
+
+        const auto& contacts = physics.get_contacts(CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY);
+        REQUIRE(contacts.size() == 2);
+        CHECK(contacts[0] == std::make_pair<size_t, size_t>(1, 2));
+        CHECK(contacts[1] == std::make_pair<size_t, size_t>(3, 4));
+        CHECK(physics.get_contacts(CollisionLayer::PLAYER, CollisionLayer::ENEMY).empty());
+
+        physics.begin_contacts();
+        CHECK(physics.get_contacts(CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY).empty());
+    }
+
+    TEST_CASE("PhysicsManager collider masks keep bullets from pairing") {
+        auto& physics = PhysicsManager::instance();
+        physics.init(64.0f);
+
+        collider enemy(20, 20, 0, 0, false, CollisionLayer::ENEMY);
+        collider bullet(8, 8, 0, 0, true, CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY);
+        physics.update_entity(1, AABB{0, 0, 20, 20}, CollisionFilter(enemy.layer, enemy.mask));
+        physics.update_entity(2, AABB{5, 5, 8, 8}, CollisionFilter(bullet.layer, bullet.mask));
+        physics.update_entity(3, AABB{6, 6, 8, 8}, CollisionFilter(bullet.layer, bullet.mask));
+
+        auto pairs = physics.get_collision_pairs();
+        CHECK(pairs.size() == 2);
+        for (auto [a, b] : pairs) {
+            CHECK(a == 1);
+        }
+    }
+
+    TEST_CASE("sweep_circle_aabb catches a bullet tunneling through a thin box") {
+        // 700 px/s over a 33ms tick moves ~23px, past a 6px wide enemy
+        AABB thin(100, 0, 6, 40);
+        Vector2 from{90, 20};
+        Vector2 to{113, 20};
+        float toi = -1.0f;
+
+        CHECK_FALSE(CollisionDetector::check_circle_aabb(from, 2.0f, thin));
+        CHECK_FALSE(CollisionDetector::check_circle_aabb(to, 2.0f, thin));
+        REQUIRE(CollisionDetector::sweep_circle_aabb(from, to, 2.0f, thin, toi));
+        CHECK(toi == doctest::Approx(8.0f / 23.0f));
+    }
+
+    TEST_CASE("sweep_circle_aabb reports zero time of impact when already overlapping") {
+        float toi = -1.0f;
+        REQUIRE(CollisionDetector::sweep_circle_aabb({5, 5}, {50, 5}, 1.0f, AABB(0, 0, 10, 10), toi));
+        CHECK(toi == 0.0f);
+    }
+
+    TEST_CASE("sweep_circle_aabb misses paths that pass by the box") {
+        AABB box(0, 0, 10, 10);
+        float toi = -1.0f;
+
+        CHECK_FALSE(CollisionDetector::sweep_circle_aabb({-10, 20}, {20, 20}, 2.0f, box, toi));
+        CHECK_FALSE(CollisionDetector::sweep_circle_aabb({-10, 5}, {-5, 5}, 2.0f, box, toi));
+        CHECK_FALSE(CollisionDetector::sweep_circle_aabb({-20, 5}, {-30, 5}, 2.0f, box, toi));
+        CHECK(toi == -1.0f);
+    }
+
+    TEST_CASE("sweep_circle_aabb uses rounded corners") {
+        AABB box(0, 0, 10, 10);
+        float toi = -1.0f;
+
+        // Cuts through the corner of the box grown by the radius, but stays
+        // more than the radius away from the actual corner
+        CHECK_FALSE(CollisionDetector::sweep_circle_aabb({-8, 1}, {1, -8}, 4.0f, box, toi));
+        // Corner path toward (0, 0): touches when 4 units from the corner
+        REQUIRE(CollisionDetector::sweep_circle_aabb({-10, -10}, {0, 0}, 4.0f, box, toi));
+        float travelled = (10.0f * std::sqrt(2.0f) - 4.0f) / (10.0f * std::sqrt(2.0f));
+        CHECK(toi == doctest::Approx(travelled));
+    }
+
+    TEST_CASE("PhysicsManager only re-buckets entities whose cells changed") {
+        auto& physics = PhysicsManager::instance();
+        const BroadphaseType types[] = {BroadphaseType::SPATIAL_HASH, BroadphaseType::UNIFORM_GRID};
+
+        for (auto type : types) {
+            physics.init(type, 64.0f, AABB(0, 0, 1024, 1024));
+
+            physics.begin_frame();
+            physics.update_entity(1, AABB(10, 10, 20, 20));
+            physics.update_entity(2, AABB(200, 200, 20, 20));
+            physics.end_frame();
+            CHECK(physics.get_update_stats().rebucketed == 2);
+
+            // Turret stays put, ship moves within its cell
+            physics.begin_frame();
+            physics.update_entity(1, AABB(10, 10, 20, 20));
+            physics.update_entity(2, AABB(205, 200, 20, 20));
+            physics.end_frame();
+            CHECK(physics.get_update_stats().unchanged == 1);
+            CHECK(physics.get_update_stats().moved_in_place == 1);
+            CHECK(physics.get_update_stats().rebucketed == 0);
+
+            // Ship crosses into the turret's cell and now pairs with it
+            physics.begin_frame();
+            physics.update_entity(1, AABB(10, 10, 20, 20));
+            physics.update_entity(2, AABB(20, 20, 20, 20));
+            physics.end_frame();
+            CHECK(physics.get_update_stats().rebucketed == 1);
+            auto pairs = physics.get_collision_pairs();
+            REQUIRE(pairs.size() == 1);
+            CHECK(pairs[0] == std::make_pair<size_t, size_t>(1, 2));
+        }
+    }
+
+    TEST_CASE("PhysicsManager end_frame drops entities that were not updated") {
+        auto& physics = PhysicsManager::instance();
+        physics.init(64.0f);
+
+        physics.begin_frame();
+        physics.update_entity(1, AABB(0, 0, 10, 10));
+        physics.update_entity(2, AABB(5, 5, 10, 10));
+        physics.end_frame();
+        CHECK(physics.get_collision_pairs().size() == 1);
+
+        physics.begin_frame();
+        physics.update_entity(1, AABB(0, 0, 10, 10));
+        physics.end_frame();
+        CHECK(physics.get_update_stats().removed == 1);
+        CHECK(physics.get_broadphase().get_entity_count() == 1);
+        CHECK(physics.get_collision_pairs().empty());
+
+        // Coming back later is a fresh insert
+        physics.begin_frame();
+        physics.update_entity(1, AABB(0, 0, 10, 10));
+        physics.update_entity(2, AABB(5, 5, 10, 10));
+        physics.end_frame();
+        CHECK(physics.get_update_stats().rebucketed == 1);
+        CHECK(physics.get_collision_pairs().size() == 1);
+    }
+
+    TEST_CASE("PhysicsManager re-buckets when only the filter changes") {
+        auto& physics = PhysicsManager::instance();
+        physics.init(64.0f);
+
+        physics.begin_frame();
+        physics.update_entity(1, AABB(0, 0, 10, 10), CollisionFilter(1, 2));
+        physics.update_entity(2, AABB(5, 5, 10, 10), CollisionFilter(2, 1));
+        physics.end_frame();
+        CHECK(physics.get_collision_pairs().size() == 1);
+
+        physics.begin_frame();
+        physics.update_entity(1, AABB(0, 0, 10, 10), CollisionFilter(1, 0));
+        physics.update_entity(2, AABB(5, 5, 10, 10), CollisionFilter(2, 1));
+        physics.end_frame();
+        CHECK(physics.get_update_stats().rebucketed == 1);
+        CHECK(physics.get_collision_pairs().empty());
+    }
+
+    TEST_CASE("Each registry owns its own physics world") {
+        registry a;
+        registry b;
+
+        CHECK(&a.get_physics() == &a.get_physics());
+        CHECK(&a.get_physics() != &b.get_physics());
+        CHECK(&a.get_physics() != &PhysicsManager::instance());
+
+        a.get_physics().update_entity(1, AABB(0, 0, 10, 10));
+        a.get_physics().update_entity(2, AABB(5, 5, 10, 10));
+        CHECK(a.get_physics().get_collision_pairs().size() == 1);
+        CHECK(b.get_physics().get_collision_pairs().empty());
+
+        b.get_physics().clear();
+        CHECK(a.get_physics().get_collision_pairs().size() == 1);
+    }
+
+    TEST_CASE("Registries run their physics on separate threads") {
+        const int worlds = 4;
+        std::vector<std::unique_ptr<registry>> regs;
+        for (int w = 0; w < worlds; ++w) {
+            regs.push_back(std::make_unique<registry>());
+        }
+
+        std::vector<size_t> pair_counts(worlds, 0);
+        std::vector<std::thread> threads;
+        for (int w = 0; w < worlds; ++w) {
+            threads.emplace_back([&regs, &pair_counts, w]() {
+                auto& physics = regs[w]->get_physics();
+                physics.init(BroadphaseType::UNIFORM_GRID, 64.0f, AABB(0, 0, 2048, 2048));
+                for (int tick = 0; tick < 200; ++tick) {
+                    physics.begin_frame();
+                    // World w has w + 1 overlapping couples, far apart
+                    for (int k = 0; k <= w; ++k) {
+                        float x = 200.0f * k + static_cast<float>(tick % 3);
+                        physics.update_entity(2 * k, AABB(x, 100, 20, 20));
+                        physics.update_entity(2 * k + 1, AABB(x + 10, 100, 20, 20));
+                    }
+                    physics.end_frame();
+                    pair_counts[w] = physics.get_collision_pairs().size();
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        for (int w = 0; w < worlds; ++w) {
+            CHECK(pair_counts[w] == static_cast<size_t>(w + 1));
+        }
+    }
 }
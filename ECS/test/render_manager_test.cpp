@@ -505,5 +505,73 @@ TEST_SUITE("RenderManager Tests") {
         
         render.shutdown();
     }
-}
 
+    TEST_CASE("Camera view rect follows target and zoom") {
+        Camera2D_ECS camera;
+        Rectangle view = camera.get_view_rect(800.0f, 600.0f);
+        CHECK(view.x == doctest::Approx(0.0f));
+        CHECK(view.y == doctest::Approx(0.0f));
+        CHECK(view.width == doctest::Approx(800.0f));
+        CHECK(view.height == doctest::Approx(600.0f));
+
+        camera.set_position(100.0f, 50.0f);
+        camera.set_zoom(2.0f);
+        view = camera.get_view_rect(800.0f, 600.0f);
+        CHECK(view.x == doctest::Approx(100.0f));
+        CHECK(view.y == doctest::Approx(50.0f));
+        CHECK(view.width == doctest::Approx(400.0f));
+        CHECK(view.height == doctest::Approx(300.0f));
+    }
+
+    TEST_CASE("RenderManager culls against the view rect and reports counts") {
+        SetTraceLogLevel(LOG_ERROR);
+
+        auto& render = RenderManager::instance();
+        render.init("RenderManager Test");
+        render.begin_frame();
+
+        const Rectangle& view = render.get_view_rect();
+        CHECK(render.is_visible({view.x + 10.0f, view.y + 10.0f, 20.0f, 20.0f}));
+        // Straddling the right edge is still drawn
+        CHECK(render.is_visible({view.x + view.width - 5.0f, view.y, 20.0f, 20.0f}));
+        // Spawned past the right edge, or fully above the top
+        CHECK_FALSE(render.is_visible({view.x + view.width + 50.0f, view.y, 20.0f, 20.0f}));
+        CHECK_FALSE(render.is_visible({view.x, view.y - 30.0f, 20.0f, 20.0f}));
+
+        render.add_cull_stats(3, 2);
+        render.add_cull_stats(1, 4);
+        render.end_frame();
+        CHECK(render.get_cull_stats().drawn == 4);
+        CHECK(render.get_cull_stats().culled == 6);
+
+        // Counts restart with each frame
+        render.begin_frame();
+        render.end_frame();
+        CHECK(render.get_cull_stats().drawn == 0);
+        CHECK(render.get_cull_stats().culled == 0);
+
+        render.shutdown();
+    }
+
+    TEST_CASE("RenderManager sorts what was queued before a flush by layer") {
+        SetTraceLogLevel(LOG_ERROR);
+
+        auto& render = RenderManager::instance();
+        render.init("RenderManager Test");
+        render.begin_frame();
+
+        // A background quad queued early, sprites, then another background quad:
+        // one flush draws both backgrounds first, in a single run
+        Texture2D background{1, 64, 64, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        Texture2D sprite{2, 16, 16, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        auto& batch = render.get_batch();
+        batch.draw(&background, {0, 0, 64, 64}, {0, 0, 64, 64}, {0, 0}, 0.0f, WHITE, -100);
+        batch.draw(&sprite, {0, 0, 16, 16}, {10, 10, 16, 16}, {0, 0}, 0.0f, WHITE, 0);
+        batch.draw(&background, {0, 0, 64, 64}, {64, 0, 64, 64}, {0, 0}, 0.0f, WHITE, -100);
+        render.flush();
+        CHECK(batch.get_gpu_draw_call_count() == 2);
+
+        render.end_frame();
+        render.shutdown();
+    }
+}
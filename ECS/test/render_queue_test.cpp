@@ -0,0 +1,182 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/Renderer/Commands/RenderQueue.hpp"
+#include <raylib.h>
+#include <atomic>
+#include <stdexcept>
+
+static Texture2D fake_texture(unsigned int id) {
+    Texture2D tex{};
+    tex.id = id;
+    tex.width = 32;
+    tex.height = 32;
+    return tex;
+}
+
+TEST_SUITE("RenderCommandList Tests") {
+    TEST_CASE("Commands are recorded with their parameters") {
+        RenderCommandList list;
+        list.draw_sprite(fake_texture(3), {0, 0, 8, 8}, {10, 20, 16, 16}, {1, 2}, 45.0f, RED, 2, BLEND_ADDITIVE);
+        list.draw_rectangle({1, 2, 3, 4}, BLUE, -1);
+        list.draw_rectangle_lines({5, 6, 7, 8}, 2.0f, GREEN);
+        list.draw_circle({50, 60}, 9.0f, WHITE, 1);
+        REQUIRE(list.size() == 4);
+
+        const auto& commands = list.commands();
+        CHECK(commands[0].type == RenderCommandType::SPRITE);
+        CHECK(commands[0].texture.id == 3);
+        CHECK(commands[0].dest.x == 10.0f);
+        CHECK(commands[0].param == 45.0f);
+        CHECK(commands[0].layer == 2);
+        CHECK(commands[0].blend == BLEND_ADDITIVE);
+        CHECK(commands[1].type == RenderCommandType::RECTANGLE);
+        CHECK(commands[1].layer == -1);
+        CHECK(commands[2].param == 2.0f);
+        CHECK(commands[3].dest.x == 50.0f);
+        CHECK(commands[3].param == 9.0f);
+    }
+
+    TEST_CASE("Sprites without a texture are dropped") {
+        RenderCommandList list;
+        list.draw_sprite(fake_texture(0), {0, 0, 8, 8}, {0, 0, 8, 8}, {0, 0}, 0.0f, WHITE);
+        CHECK(list.empty());
+    }
+
+    TEST_CASE("Text is copied into the list") {
+        RenderCommandList list;
+        Font font{};
+        font.baseSize = 10;
+        {
+            std::string temporary = "Score: 42";
+            list.draw_text(font, temporary, {5, 5}, 20.0f, 1.0f, WHITE);
+        }
+        list.draw_text(font, "Lives: 3", {5, 30}, 20.0f, 1.0f, WHITE);
+
+        REQUIRE(list.size() == 2);
+        CHECK(std::string(list.text_of(list.commands()[0])) == "Score: 42");
+        CHECK(std::string(list.text_of(list.commands()[1])) == "Lives: 3");
+        CHECK(list.font_of(list.commands()[1]).baseSize == 10);
+
+        list.clear();
+        CHECK(list.empty());
+    }
+}
+
+TEST_SUITE("RenderQueue Tests") {
+    TEST_CASE("record visits every index exactly once") {
+        RenderQueue queue(4);
+        const size_t count = 10000;
+        std::vector<std::atomic<int>> visits(count);
+
+        queue.record(count, [&](size_t first, size_t last, RenderCommandList& out) {
+            for (size_t i = first; i < last; ++i) {
+                ++visits[i];
+                out.draw_rectangle({static_cast<float>(i), 0, 1, 1}, WHITE);
+            }
+        }, 64);
+
+        for (size_t i = 0; i < count; ++i) {
+            CHECK(visits[i] == 1);
+        }
+        CHECK(queue.get_command_count() == count);
+    }
+
+    TEST_CASE("Merged order is recording order, whatever the threads did") {
+        RenderQueue queue(4);
+        const size_t count = 5000;
+
+        for (int frame = 0; frame < 3; ++frame) {
+            queue.record(count, [&](size_t first, size_t last, RenderCommandList& out) {
+                for (size_t i = first; i < last; ++i) {
+                    out.draw_rectangle({static_cast<float>(i), 0, 1, 1}, WHITE);
+                }
+            }, 32);
+
+            std::vector<std::pair<const RenderCommandList*, const RenderCommand*>> merged;
+            queue.merge(merged);
+            REQUIRE(merged.size() == count);
+            for (size_t i = 0; i < count; ++i) {
+                CHECK(merged[i].second->dest.x == static_cast<float>(i));
+            }
+            queue.clear();
+        }
+    }
+
+    TEST_CASE("Merge sorts by layer and keeps serial and parallel lists in order") {
+        RenderQueue queue(2);
+        queue.list().draw_rectangle({0, 0, 1, 1}, WHITE, 1);
+        queue.record(4, [](size_t first, size_t last, RenderCommandList& out) {
+            for (size_t i = first; i < last; ++i) {
+                out.draw_rectangle({static_cast<float>(10 + i), 0, 1, 1}, WHITE, i % 2 == 0 ? 0 : 1);
+            }
+        }, 1);
+        queue.list().draw_rectangle({20, 0, 1, 1}, WHITE, 0);
+
+        std::vector<std::pair<const RenderCommandList*, const RenderCommand*>> merged;
+        queue.merge(merged);
+        REQUIRE(merged.size() == 6);
+
+        std::vector<float> order;
+        for (const auto& entry : merged) {
+            order.push_back(entry.second->dest.x);
+        }
+        CHECK(order == std::vector<float>{10, 12, 20, 0, 11, 13});
+    }
+
+    TEST_CASE("Without workers recording runs on the caller") {
+        RenderQueue queue(0);
+        std::thread::id caller = std::this_thread::get_id();
+        bool same_thread = true;
+
+        queue.record(1000, [&](size_t, size_t, RenderCommandList&) {
+            if (std::this_thread::get_id() != caller) same_thread = false;
+        }, 1);
+        CHECK(same_thread);
+        CHECK(queue.get_worker_count() == 0);
+    }
+
+    TEST_CASE("An exception in a chunk reaches the caller") {
+        RenderQueue queue(3);
+        CHECK_THROWS_AS(queue.record(100, [](size_t first, size_t, RenderCommandList&) {
+            if (first == 0) throw std::runtime_error("bad chunk");
+        }, 10), std::runtime_error);
+
+        // The queue still works afterwards
+        std::atomic<size_t> total{0};
+        queue.record(100, [&](size_t first, size_t last, RenderCommandList&) {
+            total += last - first;
+        }, 10);
+        CHECK(total == 100);
+    }
+
+    TEST_CASE("submit draws everything and empties the queue") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(1, 1, "Test");
+
+        Image img = GenImageColor(4, 4, WHITE);
+        Texture2D tex = LoadTextureFromImage(img);
+        UnloadImage(img);
+
+        RenderQueue queue(2);
+        SpriteBatch batch;
+        queue.record(600, [&](size_t first, size_t last, RenderCommandList& out) {
+            for (size_t i = first; i < last; ++i) {
+                out.draw_sprite(tex, {0, 0, 4, 4}, {static_cast<float>(i % 100), 0, 4, 4}, {0, 0}, 0.0f, WHITE);
+            }
+        }, 100);
+        queue.list().draw_rectangle({0, 0, 10, 10}, RED, 1);
+
+        BeginDrawing();
+        batch.begin();
+        queue.submit(batch);
+        batch.end();
+        batch.flush();
+        EndDrawing();
+
+        CHECK(queue.get_last_submit_count() == 601);
+        CHECK(queue.get_command_count() == 0);
+
+        UnloadTexture(tex);
+        CloseWindow();
+    }
+}
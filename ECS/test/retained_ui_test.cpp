@@ -0,0 +1,174 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** Retained UI layer Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/UI/RetainedUI.hpp"
+#include "ECS/UI/Components/Button.hpp"
+#include "ECS/UI/Components/Panel.hpp"
+#include <raylib.h>
+
+static void init_raylib_for_tests() {
+    SetTraceLogLevel(LOG_ERROR);
+    InitWindow(1, 1, "Test");
+}
+
+static std::shared_ptr<UI::UIButton> add_button(sparse_set<UI::UIComponent>& set, size_t entity,
+                                                float x, float y, float w, float h) {
+    auto button = std::make_shared<UI::UIButton>(x, y, w, h, "");
+    set.insert_at(entity, UI::UIComponent(button));
+    return button;
+}
+
+// One frame as UISystem runs it
+static void frame(UI::RetainedUI& ui, sparse_set<UI::UIComponent>& set) {
+    ui.sync(set);
+    ui.render();
+}
+
+TEST_SUITE("RetainedUI Tests") {
+    TEST_CASE("Hit-testing returns the topmost enabled widget") {
+        init_raylib_for_tests();
+        sparse_set<UI::UIComponent> set;
+        auto panel = std::make_shared<UI::UIPanel>(0, 0, 400, 400);
+        set.insert_at(3, UI::UIComponent(panel));
+        add_button(set, 7, 50, 50, 100, 40);
+        auto disabled = add_button(set, 9, 60, 60, 20, 20);
+        disabled->setEnabled(false);
+
+        UI::RetainedUI ui;
+        ui.sync(set);
+        CHECK(ui.hit_test(65, 65) == 7);
+        CHECK(ui.hit_test(300, 300) == 3);
+        CHECK(ui.hit_test(900, 900) == UI::RetainedUI::NO_ENTITY);
+
+        disabled->setEnabled(true);
+        ui.sync(set);
+        CHECK(ui.hit_test(65, 65) == 9);
+
+        disabled->setPosition(500, 500);
+        ui.sync(set);
+        CHECK(ui.hit_test(65, 65) == 7);
+        CHECK(ui.hit_test(510, 510) == 9);
+        CloseWindow();
+    }
+
+    TEST_CASE("Static widgets are drawn into the cache once") {
+        init_raylib_for_tests();
+        sparse_set<UI::UIComponent> set;
+        add_button(set, 0, 0, 0, 100, 40);
+        add_button(set, 1, 0, 100, 100, 40);
+        add_button(set, 2, 0, 200, 100, 40);
+
+        UI::RetainedUI ui;
+        frame(ui, set);
+        CHECK(ui.get_last_redraw_count() == 3);
+        CHECK(ui.get_live_count() == 0);
+
+        frame(ui, set);
+        CHECK(ui.get_last_redraw_count() == 0);
+        ui.release();
+        CloseWindow();
+    }
+
+    TEST_CASE("A change redraws only the region around the widget") {
+        init_raylib_for_tests();
+        sparse_set<UI::UIComponent> set;
+        add_button(set, 0, 0, 0, 100, 40);
+        auto changed = add_button(set, 1, 0, 100, 100, 40);
+        add_button(set, 2, 0, 200, 100, 40);
+
+        UI::RetainedUI ui;
+        frame(ui, set);
+
+        changed->setText("Ready");
+        frame(ui, set);
+        CHECK(ui.get_last_redraw_count() == 1);
+        const Rectangle& dirty = ui.get_last_dirty_region();
+        CHECK(dirty.y <= 100.0f);
+        CHECK(dirty.y + dirty.height >= 140.0f);
+        CHECK(dirty.y > 40.0f);
+
+        // Moving redraws the old and the new place
+        changed->setPosition(0, 300);
+        frame(ui, set);
+        CHECK(ui.get_last_dirty_region().y <= 100.0f);
+        CHECK(ui.get_last_dirty_region().y + ui.get_last_dirty_region().height >= 340.0f);
+        ui.release();
+        CloseWindow();
+    }
+
+    TEST_CASE("Hovered and animated widgets are drawn live") {
+        init_raylib_for_tests();
+        sparse_set<UI::UIComponent> set;
+        auto below = add_button(set, 0, 0, 0, 100, 40);
+        auto hovered = add_button(set, 1, 50, 10, 100, 40);
+        auto above = add_button(set, 2, 120, 20, 100, 40);
+        auto apart = add_button(set, 3, 600, 600, 100, 40);
+
+        UI::RetainedUI ui;
+        frame(ui, set);
+        CHECK(ui.get_live_count() == 0);
+
+        hovered->setState(UI::UIState::Hovered);
+        frame(ui, set);
+        // The widget above it must be drawn after it, so it is live too
+        CHECK(ui.get_live_count() == 2);
+        CHECK(ui.get_last_redraw_count() >= 1);
+
+        hovered->setState(UI::UIState::Normal);
+        frame(ui, set);
+        CHECK(ui.get_live_count() == 0);
+
+        apart->setCustomRender([](const UI::UIButton&) {});
+        frame(ui, set);
+        CHECK(ui.get_live_count() == 1);
+        (void)below;
+        (void)above;
+        ui.release();
+        CloseWindow();
+    }
+
+    TEST_CASE("A widget changing every frame stops being cached") {
+        init_raylib_for_tests();
+        sparse_set<UI::UIComponent> set;
+        auto counter = add_button(set, 0, 0, 0, 100, 40);
+
+        UI::RetainedUI ui;
+        frame(ui, set);
+        for (int i = 0; i < 5; ++i) {
+            counter->setText(std::to_string(i));
+            frame(ui, set);
+        }
+        CHECK(ui.get_live_count() == 1);
+
+        for (int i = 0; i < 40; ++i) {
+            frame(ui, set);
+        }
+        CHECK(ui.get_live_count() == 0);
+        ui.release();
+        CloseWindow();
+    }
+
+    TEST_CASE("Adding a widget redraws everything") {
+        init_raylib_for_tests();
+        sparse_set<UI::UIComponent> set;
+        add_button(set, 0, 0, 0, 100, 40);
+
+        UI::RetainedUI ui;
+        frame(ui, set);
+        frame(ui, set);
+        CHECK(ui.get_last_redraw_count() == 0);
+
+        add_button(set, 1, 0, 100, 100, 40);
+        frame(ui, set);
+        CHECK(ui.get_widget_count() == 2);
+        CHECK(ui.get_last_redraw_count() == 2);
+        ui.release();
+        CloseWindow();
+    }
+}
@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** SFXMixer Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/Audio/SFX/SFXMixer.hpp"
+
+namespace {
+    // A decoded sound of the given length; never handed to the audio device
+    Sound fake_sound(float seconds) {
+        Sound sound{};
+        sound.stream.sampleRate = 1000;
+        sound.frameCount = static_cast<unsigned int>(seconds * 1000.0f);
+        return sound;
+    }
+}
+
+TEST_SUITE("SFXMixer Tests") {
+    TEST_CASE("Plays of one sound overlap up to its instance count") {
+        SFXMixer mixer(8, 2);
+        int laser = mixer.add(fake_sound(1.0f));
+
+        int first = mixer.play(laser);
+        int second = mixer.play(laser);
+        CHECK(first != SFXMixer::NO_VOICE);
+        CHECK(second != SFXMixer::NO_VOICE);
+        CHECK(first != second);
+        CHECK(mixer.get_active_voices() == 2);
+
+        // Third play restarts the oldest instance
+        CHECK(mixer.play(laser) == first);
+        CHECK(mixer.get_active_voices() == 2);
+        CHECK(mixer.get_stolen_count() == 1);
+    }
+
+    TEST_CASE("Voices free up once their sound has played") {
+        SFXMixer mixer(4, 4);
+        int shot = mixer.add(fake_sound(0.5f));
+        mixer.play(shot);
+        mixer.play(shot);
+
+        mixer.update(0.4f);
+        CHECK(mixer.get_active_voices() == 2);
+        mixer.update(0.2f);
+        CHECK(mixer.get_active_voices() == 0);
+    }
+
+    TEST_CASE("A full pool steals the lowest priority, oldest voice") {
+        SFXMixer mixer(2, 4);
+        int laser = mixer.add(fake_sound(1.0f), SFXBus::WEAPONS, 0);
+        int death = mixer.add(fake_sound(1.0f), SFXBus::IMPACTS, 1);
+
+        int old_laser = mixer.play(laser);
+        mixer.play(laser);
+        CHECK(mixer.play(death) == old_laser);
+        CHECK(mixer.get_stolen_count() == 1);
+
+        // Equal priority steals too: the remaining laser is the oldest low one
+        int remaining = mixer.play(laser);
+        CHECK(remaining != SFXMixer::NO_VOICE);
+        CHECK(mixer.get_stolen_count() == 2);
+
+        // Both voices now hold a death or a newer laser; fill with deaths
+        mixer.play(death);
+        CHECK(mixer.play(laser) == SFXMixer::NO_VOICE);
+        CHECK(mixer.get_dropped_count() == 1);
+    }
+
+    TEST_CASE("Bus and master volumes are clamped") {
+        SFXMixer mixer;
+        mixer.set_bus_volume(SFXBus::WEAPONS, 0.5f);
+        mixer.set_bus_volume(SFXBus::IMPACTS, 2.0f);
+        mixer.set_master_volume(-1.0f);
+        CHECK(mixer.get_bus_volume(SFXBus::WEAPONS) == doctest::Approx(0.5f));
+        CHECK(mixer.get_bus_volume(SFXBus::IMPACTS) == doctest::Approx(1.0f));
+        CHECK(mixer.get_bus_volume(SFXBus::EFFECTS) == doctest::Approx(1.0f));
+        CHECK(mixer.get_master_volume() == doctest::Approx(0.0f));
+    }
+
+    TEST_CASE("Removed sounds stop and their id is reused") {
+        SFXMixer mixer(4, 2);
+        int first = mixer.add(fake_sound(1.0f));
+        mixer.play(first);
+        mixer.remove(first);
+        CHECK_FALSE(mixer.has(first));
+        CHECK(mixer.get_active_voices() == 0);
+        CHECK(mixer.play(first) == SFXMixer::NO_VOICE);
+
+        int second = mixer.add(fake_sound(1.0f));
+        CHECK(second == first);
+        CHECK(mixer.has(second));
+    }
+}
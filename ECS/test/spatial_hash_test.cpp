@@ -2,6 +2,7 @@
 #include <doctest/doctest.h>
 
 #include "ECS/Physics/SpatialHash/SpatialHash.hpp"
+#include <set>
 
 TEST_SUITE("SpatialHash Tests") {
     TEST_CASE("SpatialHash initializes with default cell size") {
@@ -319,4 +320,62 @@ TEST_SUITE("SpatialHash Tests") {
         // Should find multiple pairs (1,2), (1,3), (1,4), (2,3), (2,4), (3,4) = 6 pairs
         CHECK(collisions.size() >= 6);
     }
+
+    TEST_CASE("SpatialHash reports a pair spanning several cells once") {
+        SpatialHash hash(64.0f);
+        hash.insert(1, AABB{0, 0, 200, 200});
+        hash.insert(2, AABB{50, 50, 200, 200});
+
+        auto collisions = hash.get_potential_collisions();
+        REQUIRE(collisions.size() == 1);
+        CHECK(collisions[0].first == 1);
+        CHECK(collisions[0].second == 2);
+    }
+
+    TEST_CASE("SpatialHash pairs stay distinct past 100000 ids") {
+        SpatialHash hash(64.0f);
+        // 1 * 100000 + 100001 == 2 * 100000 + 1 under the old pair key
+        hash.insert(1, AABB{0, 0, 10, 10});
+        hash.insert(100001, AABB{0, 0, 10, 10});
+        hash.insert(2, AABB{0, 0, 10, 10});
+
+        auto collisions = hash.get_potential_collisions();
+        std::set<std::pair<size_t, size_t>> unique(collisions.begin(), collisions.end());
+        CHECK(collisions.size() == 3);
+        CHECK(unique.size() == 3);
+        CHECK(unique.count({1, 100001}) == 1);
+        CHECK(unique.count({2, 100001}) == 1);
+    }
+
+    TEST_CASE("SpatialHash layer masks filter pairs") {
+        const uint32_t SHIP = 1u << 0;
+        const uint32_t BULLET = 1u << 1;
+        SpatialHash hash(64.0f);
+
+        hash.insert(1, AABB{0, 0, 10, 10}, CollisionFilter(SHIP, CollisionFilter::ALL));
+        hash.insert(2, AABB{2, 2, 4, 4}, CollisionFilter(BULLET, ~BULLET));
+        hash.insert(3, AABB{4, 4, 4, 4}, CollisionFilter(BULLET, ~BULLET));
+
+        auto collisions = hash.get_potential_collisions();
+        std::set<std::pair<size_t, size_t>> unique(collisions.begin(), collisions.end());
+        CHECK(unique.size() == 2);
+        CHECK(unique.count({1, 2}) == 1);
+        CHECK(unique.count({1, 3}) == 1);
+        CHECK(unique.count({2, 3}) == 0);
+    }
+
+    TEST_CASE("SpatialHash writes pairs into a reused buffer") {
+        SpatialHash hash(64.0f);
+        hash.insert(1, AABB{0, 0, 10, 10});
+        hash.insert(2, AABB{5, 5, 10, 10});
+
+        std::vector<std::pair<size_t, size_t>> pairs{{7, 8}, {9, 10}};
+        hash.get_potential_collisions(pairs);
+        REQUIRE(pairs.size() == 1);
+        CHECK(pairs[0] == std::make_pair<size_t, size_t>(1, 2));
+
+        hash.remove(2);
+        hash.get_potential_collisions(pairs);
+        CHECK(pairs.empty());
+    }
 }
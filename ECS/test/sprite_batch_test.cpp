@@ -446,4 +446,108 @@ TEST_SUITE("SpriteBatch Tests") {
         UnloadTexture(tex);
         CloseWindow();
     }
+
+    TEST_CASE("SpriteBatch submits one GPU draw per texture when sorted") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(64, 64, "Test");
+
+        SpriteBatch batch;
+        batch.set_sort_by_layer(true);
+        Texture2D textures[3] = {create_test_texture(), create_test_texture(), create_test_texture()};
+
+        batch.begin();
+        for (int i = 0; i < 30; i++) {
+            batch.draw(&textures[i % 3], {(float)i, 0}, WHITE, 0);
+        }
+        batch.end();
+
+        BeginDrawing();
+        batch.flush();
+        EndDrawing();
+
+        CHECK(batch.get_gpu_draw_call_count() == 3);
+
+        for (auto& tex : textures) UnloadTexture(tex);
+        CloseWindow();
+    }
+
+    TEST_CASE("SpriteBatch splits runs on layer and blend mode") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(64, 64, "Test");
+
+        SpriteBatch batch;
+        batch.set_sort_by_layer(true);
+        Texture2D tex = create_test_texture();
+        Rectangle src = {0, 0, 32, 32};
+
+        batch.begin();
+        batch.draw(&tex, src, {0, 0, 32, 32}, {0, 0}, 0.0f, WHITE, 1);
+        batch.draw(&tex, src, {0, 0, 32, 32}, {0, 0}, 0.0f, WHITE, 0, BLEND_ADDITIVE);
+        batch.draw(&tex, src, {0, 0, 32, 32}, {0, 0}, 0.0f, WHITE, 0);
+        batch.draw(&tex, src, {0, 0, 32, 32}, {0, 0}, 0.0f, WHITE, 1);
+        batch.draw(&tex, src, {0, 0, 32, 32}, {0, 0}, 0.0f, WHITE, 0);
+        batch.end();
+
+        BeginDrawing();
+        batch.flush();
+        EndDrawing();
+
+        // layer 0 alpha, layer 0 additive, layer 1 alpha
+        CHECK(batch.get_gpu_draw_call_count() == 3);
+
+        UnloadTexture(tex);
+        CloseWindow();
+    }
+
+    TEST_CASE("SpriteBatch without sorting only merges adjacent sprites") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(64, 64, "Test");
+
+        SpriteBatch batch;
+        batch.set_sort_by_layer(false);
+        Texture2D a = create_test_texture();
+        Texture2D b = create_test_texture();
+
+        batch.begin();
+        batch.draw(&a, {0, 0}, WHITE, 0);
+        batch.draw(&a, {1, 0}, WHITE, 0);
+        batch.draw(&b, {2, 0}, WHITE, 0);
+        batch.draw(&a, {3, 0}, WHITE, 0);
+        batch.end();
+
+        BeginDrawing();
+        batch.flush();
+        EndDrawing();
+
+        CHECK(batch.get_gpu_draw_call_count() == 3);
+
+        UnloadTexture(a);
+        UnloadTexture(b);
+        CloseWindow();
+    }
+
+    TEST_CASE("SpriteBatch GPU draw counter covers the whole frame") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(64, 64, "Test");
+
+        SpriteBatch batch;
+        Texture2D tex = create_test_texture();
+
+        batch.begin();
+        batch.draw(&tex, {0, 0}, WHITE, 0);
+        BeginDrawing();
+        batch.flush();  // mid-frame flush, as the sprite system does
+        batch.draw(&tex, {1, 0}, WHITE, 0);
+        batch.end();
+        batch.flush();
+        EndDrawing();
+        CHECK(batch.get_gpu_draw_call_count() == 2);
+
+        batch.begin();
+        CHECK(batch.get_gpu_draw_call_count() == 0);
+        batch.end();
+
+        UnloadTexture(tex);
+        CloseWindow();
+    }
 }
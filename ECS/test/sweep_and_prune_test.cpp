@@ -0,0 +1,157 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "ECS/Physics/SweepAndPrune/SweepAndPrune.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
+#include <algorithm>
+#include <set>
+
+namespace {
+    // Minimal backend to check PhysicsManager routes through set_broadphase
+    class CountingBroadphase : public IBroadphase {
+        public:
+            void clear() override { inserted = 0; }
+            void insert(size_t, const AABB&, CollisionFilter) override { inserted++; }
+            void remove(size_t) override {}
+            std::vector<size_t> query(const AABB&) const override { return {}; }
+            void get_potential_collisions(std::vector<std::pair<size_t, size_t>>& out) const override {
+                out.assign(1, {0, 1});
+            }
+            size_t get_entity_count() const override { return inserted; }
+            const char* get_name() const override { return "CountingBroadphase"; }
+
+            size_t inserted{0};
+    };
+}
+
+TEST_SUITE("SweepAndPrune Tests") {
+    TEST_CASE("SweepAndPrune starts empty") {
+        SweepAndPrune sap;
+        CHECK(sap.get_entity_count() == 0);
+        CHECK(sap.get_potential_collisions().empty());
+    }
+
+    TEST_CASE("SweepAndPrune pairs only boxes overlapping on both axes") {
+        SweepAndPrune sap;
+        sap.insert(1, AABB{0, 0, 10, 10});
+        sap.insert(2, AABB{5, 5, 10, 10});
+        sap.insert(3, AABB{5, 100, 10, 10});  // x overlaps, y does not
+        sap.insert(4, AABB{50, 0, 10, 10});
+
+        auto pairs = sap.get_potential_collisions();
+        REQUIRE(pairs.size() == 1);
+        CHECK(pairs[0].first == 1);
+        CHECK(pairs[0].second == 2);
+    }
+
+    TEST_CASE("SweepAndPrune matches brute force") {
+        SweepAndPrune sap;
+        std::vector<AABB> boxes;
+        for (size_t i = 0; i < 300; ++i) {
+            float x = static_cast<float>((i * 97) % 800);
+            float y = static_cast<float>((i * 61) % 600);
+            float s = static_cast<float>(4 + (i * 13) % 40);
+            boxes.push_back(AABB{x, y, s, s});
+            sap.insert(i, boxes.back());
+        }
+
+        std::set<std::pair<size_t, size_t>> expected;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].intersects(boxes[j])) expected.insert({i, j});
+            }
+        }
+
+        auto pairs = sap.get_potential_collisions();
+        std::set<std::pair<size_t, size_t>> reported(pairs.begin(), pairs.end());
+        CHECK(pairs.size() == reported.size());
+        CHECK(reported == expected);
+    }
+
+    TEST_CASE("SweepAndPrune keeps its order across clear and reinsert") {
+        SweepAndPrune sap;
+        for (size_t i = 0; i < 100; ++i) {
+            sap.insert(i, AABB{static_cast<float>(1000 - i * 10), 0, 5, 5});
+        }
+        sap.get_potential_collisions();
+        CHECK(sap.get_last_sort_swaps() > 0);
+
+        // Everyone drifts left by the same amount: the order still holds
+        sap.clear();
+        for (size_t i = 0; i < 100; ++i) {
+            sap.insert(i, AABB{static_cast<float>(990 - i * 10), 0, 5, 5});
+        }
+        sap.get_potential_collisions();
+        CHECK(sap.get_last_sort_swaps() == 0);
+    }
+
+    TEST_CASE("SweepAndPrune handles removal and reinsertion") {
+        SweepAndPrune sap;
+        sap.insert(1, AABB{0, 0, 10, 10});
+        sap.insert(2, AABB{5, 5, 10, 10});
+        sap.insert(3, AABB{8, 8, 10, 10});
+        sap.remove(2);
+        sap.remove(99);
+        CHECK(sap.get_entity_count() == 2);
+        CHECK(sap.get_potential_collisions().size() == 1);
+
+        sap.insert(1, AABB{500, 500, 10, 10});
+        CHECK(sap.get_potential_collisions().empty());
+    }
+
+    TEST_CASE("SweepAndPrune query returns overlapping entities") {
+        SweepAndPrune sap;
+        sap.insert(1, AABB{0, 0, 10, 10});
+        sap.insert(2, AABB{100, 0, 10, 10});
+        sap.insert(3, AABB{0, 100, 10, 10});
+
+        auto result = sap.query(AABB{-5, -5, 20, 20});
+        REQUIRE(result.size() == 1);
+        CHECK(result[0] == 1);
+        CHECK(sap.query(AABB{-5, -5, 200, 200}).size() == 3);
+    }
+
+    TEST_CASE("SweepAndPrune layer masks filter pairs") {
+        const uint32_t BULLET = 1u << 1;
+        SweepAndPrune sap;
+        sap.insert(1, AABB{0, 0, 10, 10});
+        sap.insert(2, AABB{2, 2, 4, 4}, CollisionFilter(BULLET, ~BULLET));
+        sap.insert(3, AABB{4, 4, 4, 4}, CollisionFilter(BULLET, ~BULLET));
+
+        auto pairs = sap.get_potential_collisions();
+        std::set<std::pair<size_t, size_t>> unique(pairs.begin(), pairs.end());
+        CHECK(unique.size() == 2);
+        CHECK(unique.count({2, 3}) == 0);
+    }
+
+    TEST_CASE("PhysicsManager selects the broadphase at init") {
+        auto& physics = PhysicsManager::instance();
+
+        physics.init(BroadphaseType::SWEEP_AND_PRUNE);
+        CHECK(physics.get_broadphase_type() == BroadphaseType::SWEEP_AND_PRUNE);
+        CHECK(std::string(physics.get_broadphase().get_name()) == "SweepAndPrune");
+
+        physics.update_entity(1, AABB{0, 0, 10, 10});
+        physics.update_entity(2, AABB{5, 5, 10, 10});
+        CHECK(physics.get_sweep_and_prune().get_entity_count() == 2);
+        CHECK(physics.get_collision_pairs().size() == 1);
+
+        physics.init(64.0f);
+        CHECK(physics.get_broadphase_type() == BroadphaseType::SPATIAL_HASH);
+        CHECK(physics.get_sweep_and_prune().get_entity_count() == 0);
+    }
+
+    TEST_CASE("PhysicsManager accepts a custom broadphase") {
+        auto& physics = PhysicsManager::instance();
+
+        physics.set_broadphase(std::make_unique<CountingBroadphase>());
+        CHECK(physics.get_broadphase_type() == BroadphaseType::CUSTOM);
+
+        physics.update_entity(1, AABB{0, 0, 10, 10});
+        CHECK(physics.get_broadphase().get_entity_count() == 1);
+        CHECK(physics.get_collision_pairs().size() == 1);
+
+        physics.init(64.0f);
+        CHECK(physics.get_broadphase_type() == BroadphaseType::SPATIAL_HASH);
+    }
+}
@@ -0,0 +1,194 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextLayoutCache Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/Renderer/Text/TextLayoutCache.hpp"
+#include "ECS/Renderer/Commands/RenderQueue.hpp"
+#include <raylib.h>
+#include <cmath>
+
+namespace {
+    // 10px font in a 64x16 atlas: '?', 'A', 'B', ' ' and 'é'
+    GlyphInfo glyphs[] = {
+        {'?', 0, 0, 0, {}},
+        {'A', 0, 0, 0, {}},
+        {'B', 1, 2, 7, {}},
+        {' ', 0, 0, 4, {}},
+        {0xe9, 0, 0, 0, {}},
+    };
+    Rectangle recs[] = {
+        {0, 0, 5, 10},
+        {5, 0, 6, 10},
+        {11, 0, 5, 8},
+        {16, 0, 1, 1},
+        {17, 0, 6, 10},
+    };
+
+    Font test_font() {
+        Font font{};
+        font.baseSize = 10;
+        font.glyphCount = 5;
+        font.glyphPadding = 0;
+        font.texture.id = 900;
+        font.texture.width = 64;
+        font.texture.height = 16;
+        font.recs = recs;
+        font.glyphs = glyphs;
+        return font;
+    }
+
+    bool near(float a, float b) {
+        return std::fabs(a - b) < 0.001f;
+    }
+}
+
+TEST_SUITE("TextLayoutCache Tests") {
+    TEST_CASE("Glyphs are placed like DrawTextEx places them") {
+        TextLayoutCache cache;
+        const TextLayout& layout = cache.layout(test_font(), "AB", 20.0f, 1.0f);
+        REQUIRE(layout.glyphs.size() == 2);
+
+        // Scale 2: 'A' has no advance, so it moves by its width plus spacing
+        CHECK(near(layout.glyphs[0].dest.x, 0.0f));
+        CHECK(near(layout.glyphs[0].dest.width, 12.0f));
+        CHECK(near(layout.glyphs[0].dest.height, 20.0f));
+        CHECK(near(layout.glyphs[0].source.x, 5.0f));
+
+        CHECK(near(layout.glyphs[1].dest.x, 13.0f + 2.0f));
+        CHECK(near(layout.glyphs[1].dest.y, 4.0f));
+        CHECK(near(layout.glyphs[1].dest.width, 10.0f));
+        CHECK(near(layout.glyphs[1].source.x, 11.0f));
+    }
+
+    TEST_CASE("Size matches MeasureTextEx") {
+        TextLayoutCache cache;
+        // (6 + 7) * 2 + one spacing between two glyphs
+        Vector2 size = cache.measure(test_font(), "AB", 20.0f, 1.0f);
+        CHECK(near(size.x, 27.0f));
+        CHECK(near(size.y, 20.0f));
+
+        // Longest line wins; each new line adds the size plus the line spacing
+        size = cache.measure(test_font(), "A\nAB", 10.0f, 0.0f);
+        CHECK(near(size.x, 13.0f));
+        CHECK(near(size.y, 22.0f));
+
+        CHECK(near(cache.measure(test_font(), "", 10.0f, 0.0f).x, 0.0f));
+    }
+
+    TEST_CASE("Spaces advance without a quad and unknown codepoints use '?'") {
+        TextLayoutCache cache;
+        const TextLayout& spaced = cache.layout(test_font(), "A A", 10.0f, 0.0f);
+        REQUIRE(spaced.glyphs.size() == 2);
+        CHECK(near(spaced.glyphs[1].dest.x, 10.0f));
+
+        const TextLayout& unknown = cache.layout(test_font(), "Z\xc3\xa9", 10.0f, 0.0f);
+        REQUIRE(unknown.glyphs.size() == 2);
+        CHECK(near(unknown.glyphs[0].source.x, 0.0f));
+        CHECK(near(unknown.glyphs[1].source.x, 17.0f));
+    }
+
+    TEST_CASE("New lines start under the first one") {
+        TextLayoutCache cache;
+        const TextLayout& layout = cache.layout(test_font(), "A\nA", 10.0f, 0.0f);
+        REQUIRE(layout.glyphs.size() == 2);
+        CHECK(near(layout.glyphs[1].dest.x, 0.0f));
+        CHECK(near(layout.glyphs[1].dest.y, 12.0f));
+    }
+
+    TEST_CASE("The same string is laid out once") {
+        TextLayoutCache cache;
+        const TextLayout& first = cache.layout(test_font(), "Score: 42", 20.0f, 1.0f);
+        const TextLayout& second = cache.layout(test_font(), std::string("Score: 42").c_str(), 20.0f, 1.0f);
+        CHECK(&first == &second);
+        CHECK(cache.get_misses() == 1);
+        CHECK(cache.get_hits() == 1);
+
+        cache.layout(test_font(), "Score: 42", 30.0f, 1.0f);
+        cache.layout(test_font(), "Score: 42", 20.0f, 2.0f);
+        CHECK(cache.get_misses() == 3);
+        CHECK(cache.get_entry_count() == 3);
+    }
+
+    TEST_CASE("Strings not drawn during a frame are evicted past the capacity") {
+        TextLayoutCache cache;
+        cache.set_capacity(2);
+        cache.layout(test_font(), "A", 10.0f, 0.0f);
+        cache.layout(test_font(), "B", 10.0f, 0.0f);
+        cache.layout(test_font(), "AB", 10.0f, 0.0f);
+        cache.end_frame();
+        // All three were used this frame
+        CHECK(cache.get_entry_count() == 3);
+
+        cache.layout(test_font(), "AB", 10.0f, 0.0f);
+        cache.end_frame();
+        CHECK(cache.get_entry_count() == 1);
+
+        cache.clear();
+        CHECK(cache.get_entry_count() == 0);
+    }
+
+    TEST_CASE("An unloaded font measures nothing") {
+        TextLayoutCache cache;
+        Font font = test_font();
+        font.texture.id = 0;
+        Vector2 size = cache.measure(font, "AB", 20.0f, 1.0f);
+        CHECK(near(size.x, 0.0f));
+        CHECK(near(size.y, 0.0f));
+    }
+
+    TEST_CASE("Queued text joins one batch run") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(64, 64, "Test");
+
+        TextLayoutCache cache;
+        SpriteBatch batch;
+        batch.set_sort_by_layer(true);
+        Image img = GenImageColor(4, 4, WHITE);
+        Texture2D sprite = LoadTextureFromImage(img);
+        UnloadImage(img);
+
+        batch.begin();
+        for (int i = 0; i < 50; ++i) {
+            cache.queue(batch, test_font(), "AB", {0, static_cast<float>(i) * 12}, 10.0f, 1.0f, WHITE, 1);
+            batch.draw(&sprite, {0, 0}, WHITE, 0);
+        }
+        CHECK(batch.get_draw_call_count() == 150);
+        batch.end();
+
+        BeginDrawing();
+        batch.flush();
+        EndDrawing();
+        // The sprites, then every label in one draw
+        CHECK(batch.get_gpu_draw_call_count() == 2);
+
+        UnloadTexture(sprite);
+        CloseWindow();
+    }
+
+    TEST_CASE("RenderQueue text goes through the batch when given a cache") {
+        SetTraceLogLevel(LOG_ERROR);
+        InitWindow(64, 64, "Test");
+
+        TextLayoutCache cache;
+        RenderQueue queue(0);
+        SpriteBatch batch;
+        queue.list().draw_text(test_font(), "AB", {5, 5}, 10.0f, 1.0f, WHITE);
+        queue.list().draw_text(test_font(), "A A", {5, 20}, 10.0f, 1.0f, WHITE);
+
+        BeginDrawing();
+        batch.begin();
+        queue.submit(batch, &cache);
+        CHECK(batch.get_draw_call_count() == 4);
+        batch.end();
+        batch.flush();
+        EndDrawing();
+
+        CHECK(batch.get_gpu_draw_call_count() == 1);
+        CloseWindow();
+    }
+}
@@ -0,0 +1,138 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/AssetManager/Atlas/AtlasPacker.hpp"
+#include "ECS/AssetManager/Atlas/TextureAtlas.hpp"
+#include <cstdlib>
+
+static bool overlaps(const AtlasPlacement& a, const AtlasPacker::Size& sa,
+                     const AtlasPlacement& b, const AtlasPacker::Size& sb) {
+    if (a.page != b.page) return false;
+    return a.x < b.x + sb.width && b.x < a.x + sa.width &&
+           a.y < b.y + sb.height && b.y < a.y + sa.height;
+}
+
+TEST_SUITE("AtlasPacker Tests") {
+    TEST_CASE("Placements stay inside the page and never overlap") {
+        std::vector<AtlasPacker::Size> sizes;
+        for (int i = 0; i < 200; ++i) {
+            sizes.push_back({16 + (i * 37) % 120, 16 + (i * 53) % 90});
+        }
+
+        AtlasPacker packer(512, 2);
+        std::vector<AtlasPlacement> out;
+        CHECK(packer.pack(sizes, out) == sizes.size());
+        REQUIRE(out.size() == sizes.size());
+
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            CHECK(out[i].page >= 0);
+            CHECK(out[i].page < packer.get_page_count());
+            CHECK(out[i].x >= 0);
+            CHECK(out[i].y >= 0);
+            CHECK(out[i].x + sizes[i].width <= 512);
+            CHECK(out[i].y + sizes[i].height <= 512);
+            for (size_t j = i + 1; j < sizes.size(); ++j) {
+                CHECK_FALSE(overlaps(out[i], sizes[i], out[j], sizes[j]));
+            }
+        }
+    }
+
+    TEST_CASE("Padding separates neighbours") {
+        std::vector<AtlasPacker::Size> sizes = {{10, 10}, {10, 10}};
+        AtlasPacker packer(64, 4);
+        std::vector<AtlasPlacement> out;
+        packer.pack(sizes, out);
+
+        // Same row: the second starts after the first plus its padding
+        CHECK(out[0].y == out[1].y);
+        CHECK(std::abs(out[1].x - out[0].x) >= 14);
+    }
+
+    TEST_CASE("Rectangles larger than a page are left out") {
+        std::vector<AtlasPacker::Size> sizes = {{4096, 16}, {32, 32}, {0, 10}};
+        AtlasPacker packer(2048, 2);
+        std::vector<AtlasPlacement> out;
+        CHECK(packer.pack(sizes, out) == 1);
+        CHECK(out[0].page == -1);
+        CHECK(out[1].page == 0);
+        CHECK(out[2].page == -1);
+    }
+
+    TEST_CASE("A rectangle that only fits with its padding trimmed is left out") {
+        std::vector<AtlasPacker::Size> sizes = {{2048, 2048}};
+        AtlasPacker packer(2048, 2);
+        std::vector<AtlasPlacement> out;
+        CHECK(packer.pack(sizes, out) == 0);
+        CHECK(out[0].page == -1);
+        CHECK(packer.get_page_count() == 0);
+    }
+
+    TEST_CASE("A full page opens the next one") {
+        std::vector<AtlasPacker::Size> sizes(5, {62, 62});
+        AtlasPacker packer(128, 2);
+        std::vector<AtlasPlacement> out;
+        CHECK(packer.pack(sizes, out) == 5);
+        CHECK(packer.get_page_count() == 2);
+
+        int on_first = 0;
+        for (const auto& p : out) {
+            if (p.page == 0) ++on_first;
+        }
+        CHECK(on_first == 4);
+    }
+
+    TEST_CASE("Same-sized rectangles fill a page completely") {
+        std::vector<AtlasPacker::Size> sizes(16, {30, 30});
+        AtlasPacker packer(128, 2);
+        std::vector<AtlasPlacement> out;
+        packer.pack(sizes, out);
+
+        CHECK(packer.get_page_count() == 1);
+        CHECK(packer.get_occupancy() == doctest::Approx(16.0f * 32 * 32 / (128 * 128)));
+    }
+
+    TEST_CASE("Packing is deterministic") {
+        std::vector<AtlasPacker::Size> sizes;
+        for (int i = 0; i < 64; ++i) {
+            sizes.push_back({8 + (i * 29) % 70, 8 + (i * 17) % 70});
+        }
+
+        AtlasPacker a(256, 2);
+        AtlasPacker b(256, 2);
+        std::vector<AtlasPlacement> out_a;
+        std::vector<AtlasPlacement> out_b;
+        a.pack(sizes, out_a);
+        b.pack(sizes, out_b);
+
+        REQUIRE(out_a.size() == out_b.size());
+        for (size_t i = 0; i < out_a.size(); ++i) {
+            CHECK(out_a[i].page == out_b[i].page);
+            CHECK(out_a[i].x == out_b[i].x);
+            CHECK(out_a[i].y == out_b[i].y);
+        }
+    }
+}
+
+TEST_SUITE("TextureAtlas Tests") {
+    TEST_CASE("Empty atlas finds nothing") {
+        TextureAtlas atlas;
+        CHECK(atlas.find("missing.png") == nullptr);
+        CHECK(atlas.get_page(0) == nullptr);
+        CHECK(atlas.get_page(-1) == nullptr);
+        CHECK(atlas.page_count() == 0);
+    }
+
+    TEST_CASE("Loading a missing table fails and keeps the atlas empty") {
+        TextureAtlas atlas;
+        uint32_t generation = atlas.get_generation();
+        CHECK_FALSE(atlas.load("/nonexistent/dir/atlas"));
+        CHECK(atlas.region_count() == 0);
+        CHECK(atlas.get_generation() == generation);
+    }
+
+    TEST_CASE("Unload bumps the generation") {
+        TextureAtlas atlas;
+        uint32_t generation = atlas.get_generation();
+        atlas.unload();
+        CHECK(atlas.get_generation() != generation);
+    }
+}
@@ -0,0 +1,152 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** TextureBundle Unit Tests
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include "ECS/AssetManager/Texture/BlockCompressor.hpp"
+#include "ECS/AssetManager/Texture/TextureBundle.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    std::vector<unsigned char> solid(int width, int height, unsigned char r, unsigned char g,
+                                     unsigned char b, unsigned char a) {
+        std::vector<unsigned char> rgba;
+        for (int i = 0; i < width * height; ++i) rgba.insert(rgba.end(), {r, g, b, a});
+        return rgba;
+    }
+
+    uint32_t read32(const std::vector<unsigned char>& bytes, size_t offset) {
+        return bytes[offset] | bytes[offset + 1] << 8 | bytes[offset + 2] << 16 |
+               static_cast<uint32_t>(bytes[offset + 3]) << 24;
+    }
+}
+
+TEST_SUITE("BlockCompressor Tests") {
+    TEST_CASE("Only partial alpha needs DXT5") {
+        auto opaque = solid(4, 4, 10, 20, 30, 255);
+        CHECK(BlockCompressor::pick_format(opaque.data(), 16) == BlockCompressor::Format::DXT1);
+        opaque[3] = 0;
+        CHECK(BlockCompressor::pick_format(opaque.data(), 16) == BlockCompressor::Format::DXT1);
+        opaque[7] = 128;
+        CHECK(BlockCompressor::pick_format(opaque.data(), 16) == BlockCompressor::Format::DXT5);
+    }
+
+    TEST_CASE("A solid block keeps its colour") {
+        auto red = solid(4, 4, 255, 0, 0, 255);
+        std::vector<unsigned char> out;
+        BlockCompressor::compress(red.data(), 4, 4, BlockCompressor::Format::DXT1, out);
+        REQUIRE(out.size() == 8);
+        CHECK((out[0] | out[1] << 8) == 0xF800);
+        CHECK((out[2] | out[3] << 8) == 0xF800);
+        // Every index picks c0 (or its equal, c1)
+        for (int i = 4; i < 8; ++i) CHECK((out[i] & 0xAA) == 0);
+    }
+
+    TEST_CASE("Cut-out texels use the transparent index") {
+        auto sprite = solid(4, 4, 0, 255, 0, 255);
+        sprite[3] = 0;
+        std::vector<unsigned char> out;
+        BlockCompressor::compress(sprite.data(), 4, 4, BlockCompressor::Format::DXT1, out);
+        REQUIRE(out.size() == 8);
+        // c0 <= c1 selects the palette with a transparent entry
+        CHECK((out[0] | out[1] << 8) <= (out[2] | out[3] << 8));
+        CHECK((out[4] & 0x3) == 3);
+        CHECK(((out[4] >> 2) & 0x3) != 3);
+    }
+
+    TEST_CASE("DXT5 alpha spans the block's alpha range") {
+        auto rgba = solid(4, 4, 255, 255, 255, 200);
+        rgba[3] = 10;
+        std::vector<unsigned char> out;
+        BlockCompressor::compress(rgba.data(), 4, 4, BlockCompressor::Format::DXT5, out);
+        REQUIRE(out.size() == 16);
+        CHECK(out[0] == 200);
+        CHECK(out[1] == 10);
+        // Texel 0 is a1 (index 1), the rest a0 (index 0)
+        CHECK((out[2] & 0x7) == 1);
+        CHECK(((out[2] >> 3) & 0x7) == 0);
+    }
+
+    TEST_CASE("Edge blocks are padded, not dropped") {
+        auto rgba = solid(5, 3, 1, 2, 3, 255);
+        std::vector<unsigned char> out;
+        BlockCompressor::compress(rgba.data(), 5, 3, BlockCompressor::Format::DXT1, out);
+        CHECK(out.size() == 2 * 8);
+        CHECK(BlockCompressor::level_size(5, 3, BlockCompressor::Format::DXT5) == 2 * 16);
+    }
+
+    TEST_CASE("Mips stop before a side drops under a block") {
+        auto rgba = solid(16, 8, 0, 0, 0, 255);
+        CHECK(BlockCompressor::build_mips(rgba.data(), 16, 8).size() == 1);
+        auto square = solid(64, 64, 0, 0, 0, 255);
+        CHECK(BlockCompressor::build_mips(square.data(), 64, 64).size() == 4);
+        CHECK(BlockCompressor::build_mips(square.data(), 64, 64, 2).size() == 1);
+    }
+
+    TEST_CASE("Transparent texels do not darken a mip") {
+        auto rgba = solid(8, 8, 0, 0, 0, 0);
+        rgba[0] = rgba[1] = rgba[2] = rgba[3] = 255;
+        auto mips = BlockCompressor::build_mips(rgba.data(), 8, 8);
+        REQUIRE(mips.size() == 1);
+        CHECK(mips[0][0] == 255);
+        CHECK(mips[0][3] == 64);
+    }
+
+    TEST_CASE("DDS files carry their mip chain, padded for raylib's reader") {
+        fs::path path = fs::temp_directory_path() / "texture_bundle_test.dds";
+        auto rgba = solid(64, 64, 90, 60, 30, 255);
+        CHECK(BlockCompressor::write_dds(path.string(), rgba.data(), 64, 64) == 5);
+
+        std::ifstream file(path, std::ios::binary);
+        std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        REQUIRE(bytes.size() == 128 + 2 * 2048);
+        CHECK(std::string(bytes.begin(), bytes.begin() + 4) == "DDS ");
+        CHECK(read32(bytes, 12) == 64);
+        CHECK(read32(bytes, 16) == 64);
+        CHECK(read32(bytes, 20) == 2048);
+        CHECK(read32(bytes, 28) == 5);
+        CHECK(std::string(bytes.begin() + 84, bytes.begin() + 88) == "DXT1");
+        fs::remove(path);
+    }
+}
+
+TEST_SUITE("TextureBundle Tests") {
+    TEST_CASE("A missing source is left unbaked") {
+        fs::path dir = fs::temp_directory_path() / "texture_bundle_test_missing";
+        fs::remove_all(dir);
+        TextureBundle bundle;
+        CHECK_FALSE(bundle.load_or_build(dir.string(), {{"missing.png", 0.5f}}));
+        CHECK(bundle.find("missing.png") == nullptr);
+        CHECK(bundle.size() == 0);
+    }
+
+    TEST_CASE("Fresh entries load from the index without baking") {
+        fs::path dir = fs::temp_directory_path() / "texture_bundle_test_index";
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        std::string source = (dir / "sprite.png").string();
+        std::ofstream(source) << "x";
+        std::ofstream(dir / "sprite.dds") << "x";
+        std::ofstream(dir / "bundle.index") << "bundle 1\ntexture 0.5 0.5 sprite.dds " << source << "\n";
+
+        TextureBundle bundle;
+        CHECK(bundle.load_or_build(dir.string(), {{source, 0.5f}}));
+        const BundleEntry* entry = bundle.find(source);
+        REQUIRE(entry != nullptr);
+        CHECK(entry->scale == 0.5f);
+        CHECK(fs::path(entry->file).filename() == "sprite.dds");
+
+        // Asked at another scale: rebaked, which fails on this placeholder
+        CHECK_FALSE(bundle.load_or_build(dir.string(), {{source, 0.25f}}));
+        CHECK(bundle.find(source) == nullptr);
+        fs::remove_all(dir);
+    }
+}
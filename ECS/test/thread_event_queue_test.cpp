@@ -0,0 +1,190 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "ECS/Messaging/ThreadEventQueue.hpp"
+#include "ECS/Messaging/MessagingManager.hpp"
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct PositionPayload {
+        uint32_t entity;
+        float x;
+        float y;
+    };
+}
+
+TEST_SUITE("ThreadEventQueue Tests") {
+    TEST_CASE("ThreadEventQueue delivers posted payload on dispatch") {
+        ThreadEventQueue queue;
+
+        PositionPayload received{};
+        queue.subscribe(1, [&](const char* data, size_t size) {
+            REQUIRE(size == sizeof(PositionPayload));
+            std::memcpy(&received, data, size);
+        });
+
+        CHECK(queue.post(1, PositionPayload{7, 1.5f, 2.5f}));
+        CHECK(received.entity == 0);
+
+        CHECK(queue.dispatch() == 1);
+        CHECK(received.entity == 7);
+        CHECK(received.x == doctest::Approx(1.5f));
+        CHECK(received.y == doctest::Approx(2.5f));
+    }
+
+    TEST_CASE("ThreadEventQueue routes by channel") {
+        ThreadEventQueue queue;
+
+        int a = 0, b = 0;
+        queue.subscribe(1, [&](const char*, size_t) { a++; });
+        queue.subscribe(2, [&](const char*, size_t) { b++; });
+
+        queue.post(1, nullptr, 0);
+        queue.post(2, nullptr, 0);
+        queue.post(2, nullptr, 0);
+        queue.post(3, nullptr, 0);
+        queue.dispatch();
+
+        CHECK(a == 1);
+        CHECK(b == 2);
+    }
+
+    TEST_CASE("ThreadEventQueue preserves order for a single producer") {
+        ThreadEventQueue queue;
+
+        std::vector<int> order;
+        queue.subscribe(1, [&](const char* data, size_t) {
+            int v;
+            std::memcpy(&v, data, sizeof(v));
+            order.push_back(v);
+        });
+
+        for (int i = 0; i < 10; i++) {
+            queue.post(1, i);
+        }
+        queue.dispatch();
+
+        REQUIRE(order.size() == 10);
+        for (int i = 0; i < 10; i++) {
+            CHECK(order[i] == i);
+        }
+    }
+
+    TEST_CASE("ThreadEventQueue rejects oversized payloads") {
+        ThreadEventQueue queue;
+
+        std::vector<char> big(ThreadEvent::PAYLOAD_CAPACITY + 1, 'x');
+        CHECK_FALSE(queue.post(1, big.data(), big.size()));
+        CHECK(queue.get_dropped_count() == 1);
+    }
+
+    TEST_CASE("ThreadEventQueue drops when a producer ring is full") {
+        ThreadEventQueue queue;
+
+        for (size_t i = 0; i < ThreadEventRing::CAPACITY; i++) {
+            CHECK(queue.post(1, nullptr, 0));
+        }
+        CHECK_FALSE(queue.post(1, nullptr, 0));
+        CHECK(queue.get_dropped_count() == 1);
+
+        queue.discard_pending();
+        CHECK(queue.post(1, nullptr, 0));
+    }
+
+    TEST_CASE("ThreadEventQueue delivers events from multiple producer threads") {
+        ThreadEventQueue queue;
+
+        const int producers = 4;
+        const int per_producer = 2000;
+        long long sum = 0;
+        int received = 0;
+        queue.subscribe(1, [&](const char* data, size_t) {
+            int v;
+            std::memcpy(&v, data, sizeof(v));
+            sum += v;
+            received++;
+        });
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&queue]() {
+                for (int i = 0; i < per_producer; i++) {
+                    while (!queue.post(1, i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        while (received < producers * per_producer) {
+            queue.dispatch();
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        // A thread that finished early may have handed its ring to a later one
+        CHECK(queue.get_producer_count() <= producers);
+        CHECK(sum == static_cast<long long>(producers) * per_producer * (per_producer - 1) / 2);
+    }
+
+    TEST_CASE("ThreadEventQueue reuses the rings of exited producer threads") {
+        ThreadEventQueue queue;
+        int received = 0;
+        queue.subscribe(1, [&](const char*, size_t) { received++; });
+
+        // One thread per connection, many more than MAX_PRODUCERS over time
+        const int connections = static_cast<int>(ThreadEventQueue::MAX_PRODUCERS) * 3;
+        for (int c = 0; c < connections; c++) {
+            bool posted = false;
+            std::thread([&]() { posted = queue.post(1, c); }).join();
+            CHECK(posted);
+            queue.dispatch();
+        }
+
+        CHECK(received == connections);
+        CHECK(queue.get_producer_count() == 1);
+        CHECK(queue.get_dropped_count() == 0);
+    }
+
+    TEST_CASE("ThreadEventQueue delivers what an exited thread posted before reusing its ring") {
+        ThreadEventQueue queue;
+        std::vector<int> values;
+        queue.subscribe(1, [&](const char* data, size_t) {
+            int v;
+            std::memcpy(&v, data, sizeof(v));
+            values.push_back(v);
+        });
+
+        std::thread([&]() { queue.post(1, 1); queue.post(1, 2); }).join();
+        std::thread([&]() { queue.post(1, 3); }).join();
+        queue.dispatch();
+        queue.dispatch();
+
+        CHECK(values == std::vector<int>{1, 2, 3});
+        CHECK(queue.get_producer_count() == 2);
+    }
+
+    TEST_CASE("MessagingManager update delivers thread events") {
+        auto& messaging = MessagingManager::instance();
+        messaging.init();
+
+        int value = 0;
+        messaging.get_thread_events().subscribe(42, [&](const char* data, size_t) {
+            std::memcpy(&value, data, sizeof(value));
+        });
+
+        std::thread producer([&messaging]() {
+            messaging.get_thread_events().post(42, 1234);
+        });
+        producer.join();
+
+        messaging.update();
+        CHECK(value == 1234);
+
+        messaging.shutdown();
+        CHECK(messaging.get_thread_events().get_subscriber_count(42) == 0);
+    }
+}
@@ -0,0 +1,142 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "ECS/Physics/UniformGrid/UniformGrid.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
+#include <algorithm>
+#include <set>
+
+TEST_SUITE("UniformGrid Tests") {
+    TEST_CASE("UniformGrid sizes its cells from the world bounds") {
+        UniformGrid grid(64.0f, AABB(0, 0, 1920, 1080));
+        CHECK(grid.get_cell_size() == 64.0f);
+        CHECK(grid.get_columns() == 30);
+        CHECK(grid.get_rows() == 17);
+        CHECK(grid.get_entity_count() == 0);
+    }
+
+    TEST_CASE("UniformGrid reinserting an entity replaces its bounds") {
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{0, 0, 10, 10});
+        grid.insert(1, AABB{300, 300, 10, 10});
+        CHECK(grid.get_entity_count() == 1);
+
+        CHECK(grid.query(AABB{0, 0, 20, 20}).empty());
+        CHECK(grid.query(AABB{290, 290, 20, 20}).size() == 1);
+    }
+
+    TEST_CASE("UniformGrid removes entities") {
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{0, 0, 10, 10});
+        grid.insert(2, AABB{5, 5, 10, 10});
+        grid.insert(3, AABB{8, 8, 10, 10});
+
+        grid.remove(1);
+        grid.remove(42);
+        CHECK(grid.get_entity_count() == 2);
+
+        auto result = grid.query(AABB{0, 0, 20, 20});
+        std::sort(result.begin(), result.end());
+        REQUIRE(result.size() == 2);
+        CHECK(result[0] == 2);
+        CHECK(result[1] == 3);
+    }
+
+    TEST_CASE("UniformGrid query reports an entity spanning cells once") {
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{10, 10, 200, 200});
+
+        auto result = grid.query(AABB{0, 0, 640, 640});
+        CHECK(result.size() == 1);
+    }
+
+    TEST_CASE("UniformGrid reports each pair once across shared cells") {
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{0, 0, 200, 200});
+        grid.insert(2, AABB{50, 50, 200, 200});
+        grid.insert(3, AABB{500, 500, 10, 10});
+
+        auto pairs = grid.get_potential_collisions();
+        REQUIRE(pairs.size() == 1);
+        CHECK(pairs[0].first == 1);
+        CHECK(pairs[0].second == 2);
+    }
+
+    TEST_CASE("UniformGrid clamps out-of-bounds entities into border cells") {
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{-500, 10, 10, 10});
+        grid.insert(2, AABB{2000, 10, 10, 10});
+
+        CHECK(grid.query(AABB{-600, 0, 20, 20}).size() == 1);
+        CHECK(grid.query(AABB{2000, 0, 20, 20}).size() == 1);
+    }
+
+    TEST_CASE("UniformGrid finds the same overlapping pairs as brute force") {
+        UniformGrid grid(32.0f, AABB(0, 0, 512, 512));
+        std::vector<AABB> boxes;
+        for (size_t i = 0; i < 200; ++i) {
+            float x = static_cast<float>((i * 97) % 480);
+            float y = static_cast<float>((i * 61) % 480);
+            float s = static_cast<float>(4 + (i * 13) % 40);
+            boxes.push_back(AABB{x, y, s, s});
+            grid.insert(i, boxes.back());
+        }
+
+        std::set<std::pair<size_t, size_t>> reported;
+        for (auto& p : grid.get_potential_collisions()) {
+            CHECK(reported.insert(p).second);
+        }
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].intersects(boxes[j])) {
+                    CHECK(reported.count({i, j}) == 1);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("UniformGrid layer masks filter pairs") {
+        const uint32_t BULLET = 1u << 1;
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{0, 0, 10, 10});
+        grid.insert(2, AABB{2, 2, 4, 4}, CollisionFilter(BULLET, ~BULLET));
+        grid.insert(3, AABB{4, 4, 4, 4}, CollisionFilter(BULLET, ~BULLET));
+
+        auto pairs = grid.get_potential_collisions();
+        std::set<std::pair<size_t, size_t>> unique(pairs.begin(), pairs.end());
+        CHECK(unique.size() == 2);
+        CHECK(unique.count({2, 3}) == 0);
+    }
+
+    TEST_CASE("UniformGrid clear keeps it reusable") {
+        UniformGrid grid(64.0f, AABB(0, 0, 640, 640));
+        grid.insert(1, AABB{0, 0, 10, 10});
+        grid.insert(2, AABB{5, 5, 10, 10});
+        CHECK(grid.get_potential_collisions().size() == 1);
+
+        grid.clear();
+        CHECK(grid.get_entity_count() == 0);
+        CHECK(grid.get_potential_collisions().empty());
+
+        grid.insert(2, AABB{5, 5, 10, 10});
+        CHECK(grid.get_entity_count() == 1);
+    }
+
+    TEST_CASE("PhysicsManager routes through the grid when given world bounds") {
+        auto& physics = PhysicsManager::instance();
+        physics.init(64.0f, AABB(0, 0, 1920, 1080));
+        CHECK(physics.get_broadphase_type() == BroadphaseType::UNIFORM_GRID);
+
+        physics.update_entity(1, AABB{100, 100, 20, 20});
+        physics.update_entity(2, AABB{110, 110, 20, 20});
+        CHECK(physics.get_uniform_grid().get_entity_count() == 2);
+        CHECK(physics.get_spatial_hash().get_entity_count() == 0);
+
+        std::vector<std::pair<size_t, size_t>> pairs;
+        physics.get_collision_pairs(pairs);
+        CHECK(pairs.size() == 1);
+
+        physics.init(64.0f);
+        CHECK(physics.get_broadphase_type() == BroadphaseType::SPATIAL_HASH);
+    }
+}
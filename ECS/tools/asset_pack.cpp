@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type ECS
+** File description:
+** asset_pack - Packs a directory into an AssetArchive
+*/
+
+#include "ECS/AssetManager/Archive/AssetArchive.hpp"
+#include <iostream>
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <directory> <archive>" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> names = AssetArchive::collect(argv[1]);
+    if (names.empty()) {
+        std::cerr << "asset_pack: nothing to pack in " << argv[1] << std::endl;
+        return 1;
+    }
+    if (!AssetArchive::write(argv[2], argv[1], names)) return 1;
+
+    // Read it back the way the game will
+    AssetArchive archive;
+    return archive.open(argv[2]) && archive.size() == names.size() ? 0 : 1;
+}
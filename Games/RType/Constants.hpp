@@ -33,6 +33,9 @@
 // ===================================COLLISION=================================
 #define COLLISION_WIDTH     75.f
 #define COLLISION_HEIGHT    75.f
+// Broadphase grid covers the screen plus this margin (enemy/boss spawn lanes)
+#define PHYSICS_CELL_SIZE       64.f
+#define PHYSICS_WORLD_MARGIN    512.f
 // =============================================================================
 
 // ====================================PLAYER===================================
@@ -43,6 +46,10 @@
 // ================================DEATH ANIMATION==============================
 #define DEATH_ANIM_FRAME_W  105.0f
 #define DEATH_ANIM_FRAME_H  107.0f
+#define DEATH_SPARK_COUNT   48
+#define DEATH_SPARK_LIFE    0.7f
+#define DEATH_SPARK_SPEED_MIN   60.f
+#define DEATH_SPARK_SPEED_MAX   280.f
 // ====================================SCALE====================================
 #define GET_SCALE_X(ratio, width)    (ratio * (width / SCREEN_WIDTH))
 #define GET_SCALE_Y(ratio, height)   (ratio * (height / SCREEN_HEIGHT))
@@ -62,6 +69,12 @@
 
 // ====================================Assets===================================
 #define RTYPE_PATH_ASSETS   (std::string(RTYPE_REPO_ROOT) + "/Games/RType/Assets/")
+#define RTYPE_PATH_ATLAS    (std::string(RTYPE_REPO_ROOT) + "/build/atlas/gameplay")
+#define RTYPE_ATLAS_PAGE_SIZE   2048
+#define RTYPE_PATH_TEXTURES (std::string(RTYPE_REPO_ROOT) + "/build/textures")
+#define RTYPE_PATH_ARCHIVE  (std::string(RTYPE_REPO_ROOT) + "/build/assets.rpak")
+#define RTYPE_PATH_INTRO_PACK   (std::string(RTYPE_REPO_ROOT) + "/build/video/joinus.frames")
+#define RTYPE_INTRO_FPS         30.0f
 // =============================================================================
 
 // ====================================Assets===================================
@@ -17,6 +17,7 @@
 #include "ECS/Renderer/RenderManager.hpp"
 #include "ECS/Messaging/MessagingManager.hpp"
 #include "ECS/Audio/AudioManager.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
 #include "Core/Config/Config.hpp"
 #include "Core/KeyBindingManager/KeyBindingManager.hpp"
 
@@ -47,6 +48,7 @@
 #include <thread>
 #include <chrono>
 #include <string>
+#include <vector>
 
 
 auto &renderManager = RenderManager::instance();
@@ -68,6 +70,62 @@ void GameClient::set_bindings()
     }
 }
 
+// Small in-game sprites and sheets, drawn many times per frame. Boss sheets
+// and the other long strips are wider than a page and keep their own texture.
+static std::vector<std::string> gameplayAtlasImages()
+{
+    const std::string assets = RTYPE_PATH_ASSETS;
+    return {
+        assets + "enemy.gif",
+        assets + "EnemyDeath.png",
+        assets + "enemyBullet-Sheet.png",
+        assets + "rocker-Sheet.png",
+        assets + "pUpArrow.gif",
+        assets + "PowerUps/cooldown.png",
+        assets + "PowerUps/damage.png",
+        assets + "PowerUps/firerate.png",
+        assets + "PowerUps/gun.png",
+        assets + "PowerUps/health.png",
+        assets + "PowerUps/speed.png",
+        assets + "Shoots/Binary_bullet-Sheet.png",
+        assets + "Shoots/enemyBullet.png",
+        assets + "Shoots/followingShoot.gif",
+        assets + "Shoots/pbShoot.gif",
+        assets + "Shoots/rocket.png",
+    };
+}
+
+// How much of each image the game draws, at the reference resolution:
+// power-ups are 3% of the screen wide, the player a quarter of its 400px
+// frames. The boss is drawn larger than it is, so it is only compressed.
+static TextureScales gameplayTextureScales()
+{
+    const std::string assets = RTYPE_PATH_ASSETS;
+    return {
+        {assets + "PowerUps/cooldown.png", 0.2f},
+        {assets + "PowerUps/damage.png", 0.0625f},
+        {assets + "PowerUps/firerate.png", 0.125f},
+        {assets + "PowerUps/gun.png", 0.25f},
+        {assets + "PowerUps/health.png", 0.25f},
+        {assets + "PowerUps/speed.png", 0.125f},
+        {assets + "Shoots/rocket.png", 0.5f},
+        {assets + "rocker-Sheet.png", 0.5f},
+        {assets + "dedsec_eyeball-Sheet.png", 0.25f},
+        {assets + "bossSheet.png", 1.0f},
+    };
+}
+
+// Everything a match draws: the packed sprites cost nothing to acquire, the
+// player and boss sheets stream in while the menu is up
+static AssetManifest inGameManifest()
+{
+    const std::string assets = RTYPE_PATH_ASSETS;
+    AssetManifest manifest{gameplayAtlasImages(), {}};
+    manifest.textures.push_back(assets + "dedsec_eyeball-Sheet.png");
+    manifest.textures.push_back(assets + "bossSheet.png");
+    return manifest;
+}
+
 void GameClient::register_states() {
     std::cout << "[GameClient] Registering game states..." << std::endl;
 
@@ -78,12 +136,12 @@ void GameClient::register_states() {
     // Register InGame state with shared registry for multiplayer
     _stateManager.register_state_with_factory("InGame", [this]() -> std::shared_ptr<IGameState> {
         return std::make_shared<InGameState>(nullptr, nullptr);
-    });
+    }, inGameManifest());
 
     // Register InGame for MULTIPLAYER mode (with shared registry)
     _stateManager.register_state_with_factory("InGameMultiplayer", [this]() -> std::shared_ptr<IGameState> {
         return std::make_shared<InGameState>(&this->ecs_registry_, &this->ecs_loader_);
-    });
+    }, inGameManifest());
 
     _stateManager.register_state<InGameHudState>("InGameHud");
     _stateManager.register_state<InGameBackground>("InGameBackground");
@@ -106,6 +164,10 @@ bool GameClient::init()
 {
     std::cout << "GameClient::init" << std::endl;
 
+    // Built by `make pack`; without it every asset is read as a loose file
+    if (!AssetManager::instance().mount_archive(RTYPE_PATH_ARCHIVE, RTYPE_PATH_ASSETS))
+        std::cout << "[GameClient] No asset archive, loading loose files" << std::endl;
+
     renderManager.init("R-Type", _scale, !_windowed);
 
     std::string fontPath = std::string(RTYPE_PATH_ASSETS) + "HACKED.ttf";
@@ -122,6 +184,20 @@ bool GameClient::init()
     messageManager.init();
     audioManager.init();
 
+    // Packed and baked once, reloaded from build/atlas and build/textures on
+    // later runs. The bundle only bakes what the atlas left standalone.
+    auto& assets = AssetManager::instance();
+    auto assetsStart = std::chrono::steady_clock::now();
+    TextureScales scales = gameplayTextureScales();
+    assets.get_atlas().load_or_build(RTYPE_PATH_ATLAS, gameplayAtlasImages(), RTYPE_ATLAS_PAGE_SIZE, scales);
+    for (auto it = scales.begin(); it != scales.end();) {
+        it = assets.get_atlas().find(it->first) ? scales.erase(it) : std::next(it);
+    }
+    assets.get_bundle().load_or_build(RTYPE_PATH_TEXTURES, scales);
+    std::chrono::duration<double, std::milli> assetsTime = std::chrono::steady_clock::now() - assetsStart;
+    std::cout << "[GameClient] Textures ready in " << assetsTime.count() << " ms, "
+              << assets.texture_memory() / (1024 * 1024) << " MB resident" << std::endl;
+
     // Register states
     register_states();
 
@@ -176,6 +252,7 @@ void GameClient::run()
         keyBindingManager.checkAndEmitKeyEvents();
         keyBindingManager.checkAndEmitMouseEvents();
         messageManager.update();
+        AssetManager::instance().update();
         AudioManager::instance().update();
 
         // Render via RenderManager (centralized begin/end, camera and SpriteBatch)
@@ -212,6 +289,7 @@ void GameClient::shutdown()
     }
     // Close Raylib window
     if (renderManager.is_window_ready()) {
+        AssetManager::instance().get_atlas().unload();
         renderManager.shutdown();
     }
 
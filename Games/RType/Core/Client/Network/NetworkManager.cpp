@@ -1,4 +1,5 @@
 #include "NetworkManager.hpp"
+#include "ECS/Messaging/MessagingManager.hpp"
 #include <iostream>
 
 NetworkManager::NetworkManager(std::shared_ptr<UdpClient> client, registry& registry, ILoader& loader)
@@ -8,6 +9,10 @@ NetworkManager::NetworkManager(std::shared_ptr<UdpClient> client, registry& regi
 
 NetworkManager::~NetworkManager() {
     stop();
+    auto& events = MessagingManager::instance().get_thread_events();
+    for (auto id : main_subscriptions_) {
+        events.unsubscribe(id);
+    }
 }
 
 void NetworkManager::start() {
@@ -30,190 +35,159 @@ void NetworkManager::register_handler(uint8_t msg_type, NetworkDispatcher::Handl
 void NetworkManager::register_default_handlers() {
     // player join
     using RType::Protocol::GameMessage;
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::PLAYER_JOIN),
+    forward_to_main(static_cast<uint8_t>(GameMessage::PLAYER_JOIN),
         [this](const char* payload, size_t size) {
-            // copy payload for main-thread job
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_player_join(data.data(), data.size());
-            });
+            player_handler_.on_player_join(payload, size);
         }
     );
 
     // client list (system message forwarded to main thread)
     using RType::Protocol::SystemMessage;
-    dispatcher_.register_handler(static_cast<uint8_t>(SystemMessage::CLIENT_LIST),
+    forward_to_main(static_cast<uint8_t>(SystemMessage::CLIENT_LIST),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_client_list(data.data(), data.size());
-            });
+            player_handler_.on_client_list(payload, size);
         }
     );
 
     // player spawn (own player) - created by server for the owning client
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::PLAYER_SPAWN),
+    forward_to_main(static_cast<uint8_t>(GameMessage::PLAYER_SPAWN),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_player_spawn(data.data(), data.size());
-            });
+            player_handler_.on_player_spawn(payload, size);
         }
     );
 
     // remote player spawn (other clients' players)
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::PLAYER_SPAWN_REMOTE),
+    forward_to_main(static_cast<uint8_t>(GameMessage::PLAYER_SPAWN_REMOTE),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_player_remote_spawn(data.data(), data.size());
-            });
+            player_handler_.on_player_remote_spawn(payload, size);
         }
     );
 
     // position update (server broadcasting player positions)
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::POSITION_UPDATE),
+    forward_to_main(static_cast<uint8_t>(GameMessage::POSITION_UPDATE),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_position_update(data.data(), data.size());
-            });
+            player_handler_.on_position_update(payload, size);
         }
     );
 
     // other player's shooting visuals
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::PLAYER_SHOOT),
+    forward_to_main(static_cast<uint8_t>(GameMessage::PLAYER_SHOOT),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
             std::cout << "[NetworkManager] Received PLAYER_SHOOT message" << std::endl;
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_player_shoot(data.data(), data.size());
-            });
+            player_handler_.on_player_shoot(payload, size);
         }
     );
 
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::PLAYER_UNSHOOT),
+    forward_to_main(static_cast<uint8_t>(GameMessage::PLAYER_UNSHOOT),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
             std::cout << "[NetworkManager] Received PLAYER_UNSHOOT message" << std::endl;
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_player_unshoot(data.data(), data.size());
-            });
+            player_handler_.on_player_unshoot(payload, size);
         }
     );
 
+    subscribe_main(static_cast<uint8_t>(GameMessage::ENTITY_CREATE),
+        [this](const char* payload, size_t size) {
+            player_handler_.on_entity_create(payload, size);
+        }
+    );
     dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::ENTITY_CREATE),
         [this](const char* payload, size_t size) {
             if (!payload || size < sizeof(RType::Protocol::EntityCreate)) return;
-            RType::Protocol::EntityCreate ec;
-            memcpy(&ec, payload, sizeof(ec));
 
-            std::vector<char> data(payload, payload + size);
             // If we don't yet have a session token, queue entity creates until handshake completes
             if (client_ && client_->get_session_token() == 0) {
                 std::lock_guard lk(pending_entity_mutex_);
-                pending_entity_creates_.push_back(std::move(data));
+                pending_entity_creates_.emplace_back(payload, payload + size);
                 return;
             }
 
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_entity_create(data.data(), data.size());
-            });
+            post_main(static_cast<uint8_t>(GameMessage::ENTITY_CREATE), payload, size);
         }
     );
 
     // entity destroy
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::ENTITY_DESTROY),
+    forward_to_main(static_cast<uint8_t>(GameMessage::ENTITY_DESTROY),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_entity_destroy(data.data(), data.size());
-            });
+            player_handler_.on_entity_destroy(payload, size);
         }
     );
 
     // player leave
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::PLAYER_LEAVE),
+    forward_to_main(static_cast<uint8_t>(GameMessage::PLAYER_LEAVE),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_player_quit(data.data(), data.size());
-            });
+            player_handler_.on_player_quit(payload, size);
         }
     );
 
     // start game
-    dispatcher_.register_handler(static_cast<uint8_t>(SystemMessage::START_GAME),
+    forward_to_main(static_cast<uint8_t>(SystemMessage::START_GAME),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_game_start(data.data(), data.size());
-            });
+            player_handler_.on_game_start(payload, size);
         }
     );
 
     // Instance created (server informs client about instance port to reconnect to)
-    dispatcher_.register_handler(static_cast<uint8_t>(SystemMessage::INSTANCE_CREATED),
+    forward_to_main(static_cast<uint8_t>(SystemMessage::INSTANCE_CREATED),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_instance_created(data.data(), data.size());
-            });
+            player_handler_.on_instance_created(payload, size);
         }
     );
 
     // Instance list (server broadcasts available instances)
-    dispatcher_.register_handler(static_cast<uint8_t>(SystemMessage::INSTANCE_LIST),
+    forward_to_main(static_cast<uint8_t>(SystemMessage::INSTANCE_LIST),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                player_handler_.on_instance_list(data.data(), data.size());
-            });
+            player_handler_.on_instance_list(payload, size);
         }
     );
 
     // game seed (for deterministic gameplay)
-    dispatcher_.register_handler(static_cast<uint8_t>(GameMessage::GAME_SEED),
+    forward_to_main(static_cast<uint8_t>(GameMessage::GAME_SEED),
         [this](const char* payload, size_t size) {
             if (!payload || size < sizeof(RType::Protocol::GameSeed)) return;
 
             RType::Protocol::GameSeed seed_msg;
             memcpy(&seed_msg, payload, sizeof(seed_msg));
-
-            // Set the seed in the registry on the main thread
-            this->post_to_main([this, seed = seed_msg.seed]() {
-                registry_.set_random_seed(seed);
-                std::cout << "[Client] Received game seed from server: " << seed << std::endl;
-            });
+            registry_.set_random_seed(seed_msg.seed);
+            std::cout << "[Client] Received game seed from server: " << seed_msg.seed << std::endl;
         }
     );
 
     // Server chat message
-    dispatcher_.register_handler(static_cast<uint8_t>(SystemMessage::SERVER_CHAT),
+    forward_to_main(static_cast<uint8_t>(SystemMessage::SERVER_CHAT),
         [this](const char* payload, size_t size) {
-            std::vector<char> data(payload, payload + size);
-            this->post_to_main([this, data = std::move(data)]() mutable {
-                chat_handler_.on_server_chat(data.data(), data.size());
-            });
+            chat_handler_.on_server_chat(payload, size);
         }
     );
 }
 
-void NetworkManager::post_to_main(std::function<void()> job) {
-    std::lock_guard lk(pending_mutex_);
-    pending_jobs_.push_back(std::move(job));
+uint32_t NetworkManager::main_channel(uint8_t msg_type) {
+    return NETWORK_CHANNEL_BASE + msg_type;
 }
 
-void NetworkManager::process_pending() {
-    std::deque<std::function<void()>> local;
-    {
-        std::lock_guard lk(pending_mutex_);
-        local.swap(pending_jobs_);
-    }
-    for (auto &j : local) {
-        try { j(); } catch (...) {}
+void NetworkManager::subscribe_main(uint8_t msg_type, ThreadEventQueue::ChannelCallback on_main) {
+    auto& events = MessagingManager::instance().get_thread_events();
+    main_subscriptions_.push_back(events.subscribe(main_channel(msg_type),
+        [on_main = std::move(on_main)](const char* payload, size_t size) {
+            try { on_main(payload, size); } catch (...) {}
+        }));
+}
+
+void NetworkManager::post_main(uint8_t msg_type, const char* payload, size_t size) {
+    // payload is copied inline into the receive thread's ring, no allocation
+    if (!MessagingManager::instance().get_thread_events().post(main_channel(msg_type), payload, size)) {
+        std::cerr << "[NetworkManager] Dropped message type " << static_cast<int>(msg_type)
+                  << " (" << size << " bytes)" << std::endl;
     }
+}
 
+void NetworkManager::forward_to_main(uint8_t msg_type, ThreadEventQueue::ChannelCallback on_main) {
+    subscribe_main(msg_type, std::move(on_main));
+    dispatcher_.register_handler(msg_type, [this, msg_type](const char* payload, size_t size) {
+        post_main(msg_type, payload, size);
+    });
+}
+
+void NetworkManager::process_pending() {
     // If we have acquired a session token during this tick, process any queued ENTITY_CREATE messages
     if (client_ && client_->get_session_token() != 0) {
         std::vector<std::vector<char>> pending;
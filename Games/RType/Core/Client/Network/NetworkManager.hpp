@@ -6,12 +6,12 @@
 #include "Core/Server/Protocol/Protocol.hpp"
 #include "ECS/Registry.hpp"
 #include "ECS/ILoader.hpp"
+#include "ECS/Messaging/ThreadEventQueue.hpp"
 #include "Handlers/PlayerHandler.hpp"
 #include "Handlers/EnemyHandler.hpp"
 #include "Handlers/ChatHandler.hpp"
 
 #include <mutex>
-#include <deque>
 #include <functional>
 
 class NetworkManager {
@@ -28,9 +28,8 @@ class NetworkManager {
 
         // Convenience: register domain handlers (player/enemy)
         void register_default_handlers();
-        // Post a job from network thread to be executed on main thread
-        void post_to_main(std::function<void()> job);
-        // Process pending jobs (call from GameClient::update or run)
+        // Main-thread work that isn't a forwarded message (call from GameClient::run
+        // after MessagingManager::update has delivered this frame's messages)
         void process_pending();
 
         // Access to handlers for state-specific callbacks
@@ -38,6 +37,14 @@ class NetworkManager {
         ChatHandler& get_chat_handler() { return chat_handler_; }
 
     private:
+        // Network messages are marshalled through MessagingManager thread events
+        static constexpr uint32_t NETWORK_CHANNEL_BASE = 0x4E00;
+        static uint32_t main_channel(uint8_t msg_type);
+
+        void subscribe_main(uint8_t msg_type, ThreadEventQueue::ChannelCallback on_main);
+        void post_main(uint8_t msg_type, const char* payload, size_t size);
+        void forward_to_main(uint8_t msg_type, ThreadEventQueue::ChannelCallback on_main);
+
         std::shared_ptr<UdpClient> client_;
         NetworkDispatcher dispatcher_;
         registry& registry_;
@@ -48,7 +55,5 @@ class NetworkManager {
         // pending ENTITY_CREATE messages received before we know our session token
         std::mutex pending_entity_mutex_;
         std::vector<std::vector<char>> pending_entity_creates_;
-        // pending jobs to be executed on main thread
-        std::mutex pending_mutex_;
-        std::deque<std::function<void()>> pending_jobs_;
+        std::vector<ThreadEventQueue::CallbackId> main_subscriptions_;
 };
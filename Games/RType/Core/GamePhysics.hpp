@@ -0,0 +1,19 @@
+// Physics world setup shared by every host that runs a match (solo client, server)
+#pragma once
+
+#include "Constants.hpp"
+#include "ECS/Components/Collider.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
+
+// Sizes the broadphase grid to the playfield and tracks the layer pairs the
+// game systems read: Shoot (bullets against ships) and PowerUpSys (pick-ups).
+// Call before the first tick; an untracked pair just reports no contacts.
+inline void setup_game_physics(PhysicsManager &physics)
+{
+    physics.init(PHYSICS_CELL_SIZE,
+        AABB(-PHYSICS_WORLD_MARGIN, -PHYSICS_WORLD_MARGIN,
+             SCREEN_WIDTH + 2 * PHYSICS_WORLD_MARGIN, SCREEN_HEIGHT + 2 * PHYSICS_WORLD_MARGIN));
+    physics.track_contacts(CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY);
+    physics.track_contacts(CollisionLayer::ENEMY_BULLET, CollisionLayer::PLAYER);
+    physics.track_contacts(CollisionLayer::POWER_UP, CollisionLayer::PLAYER);
+}
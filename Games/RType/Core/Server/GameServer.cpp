@@ -5,6 +5,8 @@
 #include "ServerECS/ServerECS.hpp"
 #include "ServerECS/Communication/Multiplayer.hpp"
 #include "ECS/Renderer/RenderManager.hpp"
+#include "Constants.hpp"
+#include "Core/GamePhysics.hpp"
 #include "Core/Server/States/ServerLobby.hpp"
 #include "Entity/Systems/EnemySpawnSystem/EnemySpawnSystem.hpp"
 #include "Entity/Systems/Health/Health.hpp"
@@ -287,8 +289,11 @@ void GameServer::start_game()
             loader.load_system("build/lib/systems/libsprite_system" + ext, ILoader::RenderSystem);
             loader.load_system("build/lib/systems/libanimation_system" + ext, ILoader::RenderSystem);
             loader.load_system("build/lib/systems/libgame_Draw" + ext, ILoader::RenderSystem);
+            loader.load_system("build/lib/systems/libparticle_system" + ext, ILoader::RenderSystem);
         }
 
+        setup_game_physics(server_ecs_->GetRegistry().get_physics());
+
         systems_loaded_ = true;
         std::cout << "[GameServer] ECS systems loaded for InGame phase." << std::endl;
 
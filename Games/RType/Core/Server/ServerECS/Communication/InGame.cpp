@@ -267,7 +267,9 @@ void InGame::spawn_all_players() {
                 COLLISION_WIDTH,
                 COLLISION_HEIGHT,
                 -COLLISION_WIDTH / 2.0f,
-                -COLLISION_HEIGHT / 2.0f);
+                -COLLISION_HEIGHT / 2.0f,
+                false,
+                CollisionLayer::PLAYER);
             ecs_.get_factory()->create_component<controllable>(registry, player_ent, 300.0f);
             ecs_.get_factory()->create_component<Weapon>(registry, player_ent);
             ecs_.get_factory()->create_component<Health>(registry, player_ent);
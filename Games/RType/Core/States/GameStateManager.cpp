@@ -6,6 +6,7 @@
 */
 
 #include "GameStateManager.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
 #include <algorithm>
 #include <memory>
 
@@ -26,10 +27,13 @@ void GameStateManager::push_state(const std::string& state_name, bool pause_curr
     // Modify stack under lock, but call lifecycle methods outside the lock to avoid deadlocks
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        begin_transition(state_name);
         if (!state_stack_.empty() && pause_current) {
             state_stack_.top()->pause();
         }
         state_stack_.push(new_state);
+        state_names_[new_state.get()] = state_name;
+        entered_.push_back(state_name);
     }
 
     new_state->enter();
@@ -50,7 +54,9 @@ void GameStateManager::pop_state() {
             std::cerr << "Cannot pop state: stack is empty" << std::endl;
             return;
         }
+        begin_transition("");
         to_exit = state_stack_.top();
+        record_exit(to_exit);
         state_stack_.pop();
         if (!state_stack_.empty()) {
             to_resume = state_stack_.top();
@@ -73,8 +79,10 @@ void GameStateManager::change_state(const std::string& state_name) {
     std::vector<std::shared_ptr<IGameState>> to_exit;
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        if (!state_stack_.empty()) begin_transition("");
         while (!state_stack_.empty()) {
             to_exit.push_back(state_stack_.top());
+            record_exit(state_stack_.top());
             state_stack_.pop();
         }
     }
@@ -96,8 +104,10 @@ void GameStateManager::clear_states() {
     std::vector<std::shared_ptr<IGameState>> to_exit;
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        if (!state_stack_.empty()) begin_transition("");
         while (!state_stack_.empty()) {
             to_exit.push_back(state_stack_.top());
+            record_exit(state_stack_.top());
             state_stack_.pop();
         }
     }
@@ -108,6 +118,7 @@ void GameStateManager::clear_states() {
 
 void GameStateManager::update(float delta_time) {
     process_pending_operations();
+    update_assets();
 
     // Snapshot stack under lock to avoid races with other threads
     std::stack<std::shared_ptr<IGameState>> temp_stack;
@@ -168,6 +179,8 @@ void GameStateManager::render() {
     for (auto& state : states_to_render) {
         state->render();
     }
+
+    check_transition();
 }
 
 void GameStateManager::handle_input() {
@@ -237,4 +250,107 @@ std::shared_ptr<IGameState> GameStateManager::create_state(const std::string& st
         state->set_state_manager(this);
     }
     return state;
-}
\ No newline at end of file
+}
+
+void GameStateManager::set_manifest(const std::string& name, AssetManifest manifest) {
+    if (manifest.empty()) {
+        manifests_.erase(name);
+        return;
+    }
+    manifests_[name] = std::move(manifest);
+}
+
+const AssetManifest& GameStateManager::get_manifest(const std::string& name) const {
+    static const AssetManifest none;
+    auto it = manifests_.find(name);
+    return it != manifests_.end() ? it->second : none;
+}
+
+std::string GameStateManager::name_of(const std::shared_ptr<IGameState>& state) const {
+    auto it = state_names_.find(state.get());
+    return it != state_names_.end() ? it->second : state->get_name();
+}
+
+void GameStateManager::begin_transition(const std::string& entered) {
+    if (!in_transition_) {
+        in_transition_ = true;
+        transition_start_ = std::chrono::steady_clock::now();
+        transition_from_ = state_stack_.empty() ? "None" : name_of(state_stack_.top());
+        transition_to_.clear();
+    }
+    if (!entered.empty()) {
+        transition_to_ += (transition_to_.empty() ? "" : "+") + entered;
+    }
+}
+
+void GameStateManager::record_exit(const std::shared_ptr<IGameState>& state) {
+    auto it = state_names_.find(state.get());
+    if (it == state_names_.end()) return;
+    exited_.push_back(it->second);
+    state_names_.erase(it);
+}
+
+void GameStateManager::update_assets() {
+    std::vector<std::string> entered;
+    std::vector<std::string> exited;
+    std::vector<std::string> hints;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entered_.empty() && exited_.empty()) return;
+        entered.swap(entered_);
+        exited.swap(exited_);
+
+        // Prefetch whatever any state on the stack may lead to, not just the
+        // top one, so pushing an overlay does not drop the prefetch below it
+        std::stack<std::shared_ptr<IGameState>> temp_stack = state_stack_;
+        while (!temp_stack.empty()) {
+            for (auto& next : temp_stack.top()->get_next_states()) {
+                hints.push_back(next);
+            }
+            temp_stack.pop();
+        }
+    }
+    std::sort(hints.begin(), hints.end());
+    hints.erase(std::unique(hints.begin(), hints.end()), hints.end());
+
+    // Acquire before releasing: an asset shared by the old and new states stays loaded
+    auto& assets = AssetManager::instance();
+    for (const auto& name : entered) {
+        assets.acquire(get_manifest(name));
+    }
+    for (const auto& name : hints) {
+        if (!std::binary_search(prefetched_.begin(), prefetched_.end(), name)) {
+            assets.acquire(get_manifest(name));
+        }
+    }
+    for (const auto& name : prefetched_) {
+        if (!std::binary_search(hints.begin(), hints.end(), name)) {
+            assets.release(get_manifest(name));
+        }
+    }
+    prefetched_ = std::move(hints);
+    for (const auto& name : exited) {
+        assets.release(get_manifest(name));
+    }
+}
+
+void GameStateManager::check_transition() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A stack change whose assets have not been requested yet is not done
+    if (!in_transition_ || !entered_.empty() || !exited_.empty()) return;
+
+    auto& assets = AssetManager::instance();
+    for (const auto& [state, name] : state_names_) {
+        if (!assets.is_ready(get_manifest(name))) return;
+    }
+
+    in_transition_ = false;
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - transition_start_;
+    last_transition_ms_ = elapsed.count();
+    if (transition_to_.empty()) {
+        transition_to_ = state_stack_.empty() ? "None" : name_of(state_stack_.top());
+    }
+    std::cout << "[GameStateManager] " << transition_from_ << " -> " << transition_to_
+              << ": first interactive frame after " << last_transition_ms_ << " ms, "
+              << assets.texture_memory() / (1024 * 1024) << " MB of textures resident" << std::endl;
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "IGameState.hpp"
+#include "ECS/AssetManager/Streaming/AssetManifest.hpp"
 #include <stack>
 #include <memory>
 #include <unordered_map>
@@ -16,6 +17,7 @@
 #include <vector>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 
 class GameStateManager {
     private:
@@ -42,21 +44,41 @@ class GameStateManager {
     // When true, states are being processed (update/render/handle_input)
     std::atomic_bool processing_states_{false};
 
+    // Assets each registered state needs, acquired while it is on the stack
+    // and prefetched while a state that hints it is
+    std::unordered_map<std::string, AssetManifest> manifests_;
+    // Registered name of each state on the stack, and the names pushed and
+    // popped since the last update() (protected by mutex_)
+    std::unordered_map<const IGameState*, std::string> state_names_;
+    std::vector<std::string> entered_;
+    std::vector<std::string> exited_;
+    std::vector<std::string> prefetched_;
+
+    // Time from a stack change to the first frame rendered with every asset in
+    std::chrono::steady_clock::time_point transition_start_;
+    std::string transition_from_;
+    std::string transition_to_;
+    bool in_transition_{false};
+    double last_transition_ms_{0.0};
+
     public:
         GameStateManager() = default;
         ~GameStateManager() = default;
 
         // State factory registration
         template<typename T>
-        void register_state(const std::string& name) {
+        void register_state(const std::string& name, AssetManifest manifest = {}) {
             state_factories_[name] = []() -> std::shared_ptr<IGameState> {
                 return std::make_shared<T>();
             };
+            set_manifest(name, std::move(manifest));
         }
 
         // Register state with custom factory function
-        void register_state_with_factory(const std::string& name, std::function<std::shared_ptr<IGameState>()> factory) {
+        void register_state_with_factory(const std::string& name, std::function<std::shared_ptr<IGameState>()> factory,
+                                         AssetManifest manifest = {}) {
             state_factories_[name] = factory;
+            set_manifest(name, std::move(manifest));
         }
 
         // State stack operations
@@ -80,7 +102,19 @@ class GameStateManager {
         bool has_state(const std::string& state_name) const;
         void print_state_stack() const;
 
+        // Time to first interactive frame of the last stack change, in ms
+        double get_last_transition_ms() const { return last_transition_ms_; }
+
     private:
         void process_pending_operations();
         std::shared_ptr<IGameState> create_state(const std::string& state_name);
+
+        void set_manifest(const std::string& name, AssetManifest manifest);
+        const AssetManifest& get_manifest(const std::string& name) const;
+        // Called with mutex_ held
+        void begin_transition(const std::string& entered);
+        void record_exit(const std::shared_ptr<IGameState>& state);
+        std::string name_of(const std::shared_ptr<IGameState>& state) const;
+        void update_assets();
+        void check_transition();
 };
\ No newline at end of file
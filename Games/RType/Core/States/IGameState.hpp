@@ -9,6 +9,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 #include <ECS/Registry.hpp>
 #include "ECS/Messaging/MessagingManager.hpp"
 #include <iostream>
@@ -69,6 +70,8 @@ public:
     virtual std::string get_name() const = 0;
     virtual bool blocks_update() const = 0;    // Does this state block states below it from updating?
     virtual bool blocks_render() const = 0;    // Does this state block states below it from rendering?
+    // States this one usually leads to; their assets are prefetched while it runs
+    virtual std::vector<std::string> get_next_states() const { return {}; }
 protected:
     virtual void set_state_manager(GameStateManager* manager) = 0;
 
@@ -13,6 +13,7 @@
 #include "ECS/Audio/AudioManager.hpp"
 #include "UI/ThemeManager.hpp"
 #include "Constants.hpp"
+#include "Core/GamePhysics.hpp"
 
 #include <string>
 #include <random>
@@ -58,6 +59,7 @@ void InGameState::enter()
     loader.load_system("build/lib/systems/libgame_Draw" + ext, ILoader::RenderSystem);
     loader.load_system("build/lib/systems/libsprite_system" + ext, ILoader::RenderSystem);
     loader.load_system("build/lib/systems/libgame_PUpAnimationSys" + ext, ILoader::RenderSystem);
+    loader.load_system("build/lib/systems/libparticle_system" + ext, ILoader::RenderSystem);
     loader.load_system("build/lib/systems/librender_UISystem" + ext, ILoader::RenderSystem);
     loader.load_system("build/lib/systems/libposition_system" + ext, ILoader::LogicSystem);
     loader.load_system("build/lib/systems/libcollision_system" + ext, ILoader::LogicSystem);
@@ -77,6 +79,8 @@ void InGameState::enter()
     loader.load_system("build/lib/systems/libgame_FollowingSys" + ext, ILoader::LogicSystem);
     loader.load_system("build/lib/systems/libgame_WaveSys" + ext, ILoader::LogicSystem);
     loader.load_system("build/lib/systems/libgame_PowerUpSys" + ext, ILoader::LogicSystem);
+
+    setup_game_physics(reg.get_physics());
     // Debug: Check how many entities exist in the registry
     std::cout << "[InGame] Registry has entities at startup" << std::endl;
 
@@ -302,7 +306,9 @@ void InGameState::createPlayer()
             GET_SCALE_X(COLLISION_WIDTH, winInfos.getWidth()),
             GET_SCALE_Y(COLLISION_HEIGHT, winInfos.getHeight()),
             -GET_SCALE_X(COLLISION_WIDTH / 2, winInfos.getWidth()),
-            -GET_SCALE_Y(COLLISION_HEIGHT / 2, winInfos.getHeight())
+            -GET_SCALE_Y(COLLISION_HEIGHT / 2, winInfos.getHeight()),
+            false,
+            CollisionLayer::PLAYER
         );
         componentFactory->create_component<Score>(reg, _playerEntity);
         componentFactory->create_component<Health>(reg, _playerEntity);
@@ -320,7 +326,7 @@ void InGameState::startMusic()
     if (audioManager.is_initialized()) {
         try {
             std::string gameMusicPath = std::string(RTYPE_PATH_ASSETS) + "Audio/Game.mp3";
-            audioManager.get_music().load("game_theme", gameMusicPath);
+            audioManager.get_music().load_async("game_theme", gameMusicPath);
             audioManager.get_music().play("game_theme", audioManager.get_music_volume() * 1.5f);
             std::cout << "[InGame] Playing game music" << std::endl;
         } catch (const std::exception& ex) {
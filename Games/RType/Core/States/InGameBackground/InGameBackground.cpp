@@ -13,6 +13,8 @@ void InGameBackground::enter()
     _systemLoader->load_components("build/lib/libECS" + ext, _registry);
     _systemLoader->load_system("build/lib/systems/librender_UISystem" + ext, ILoader::RenderSystem);
     _systemLoader->load_system("build/lib/systems/libgame_StarBg" + ext, ILoader::LogicSystem);
+    // After StarBg, which spawns the layers it scrolls; a logic system for the frame's dt
+    _systemLoader->load_system("build/lib/systems/libparallax_system" + ext, ILoader::LogicSystem);
 
     setup_ui();
     _initialized = true;
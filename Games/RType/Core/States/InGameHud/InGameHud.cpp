@@ -144,7 +144,10 @@ void InGameHudState::update(float delta_time)
 
     auto fps_text = get_fps_text();
     if (fps_text) {
-        fps_text->setText("FPS: " + std::to_string(GetFPS()));
+        const CullStats &cull = RenderManager::instance().get_cull_stats();
+        fps_text->setText("FPS: " + std::to_string(GetFPS()) +
+                          " | Drawn: " + std::to_string(cull.drawn) +
+                          " | Culled: " + std::to_string(cull.culled));
     }
 
     _systemLoader->update_all_systems(_registry, delta_time, ILoader::LogicSystem);
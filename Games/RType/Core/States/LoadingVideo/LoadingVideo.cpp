@@ -1,10 +1,8 @@
 // filepath: Games/RType/Core/States/LoadingVideo/LoadingVideo.cpp
 #include "LoadingVideo.hpp"
 #include <iostream>
-#include <filesystem>
 #include <vector>
 #include <string>
-#include <map>
 #include "Constants.hpp"
 #include "ECS/Renderer/RenderManager.hpp"
 #include "ECS/Messaging/MessagingManager.hpp"
@@ -12,6 +10,13 @@
 #include "UI/ThemeManager.hpp"
 #include "ECS/UI/UIBuilder.hpp"
 #include "ECS/Audio/AudioManager.hpp"
+#include "ECS/Renderer/Video/FramePack.hpp"
+
+LoadingVideoState::~LoadingVideoState()
+{
+    if (_packer.joinable())
+        _packer.join();
+}
 
 void LoadingVideoState::enter()
 {
@@ -20,17 +25,15 @@ void LoadingVideoState::enter()
     #ifdef _WIN32
         const std::string ecsLib = "build/lib/libECS.dll";
         const std::string uiSys = "build/lib/systems/librender_UISystem.dll";
-        const std::string spriteLib = "build/lib/systems/libsprite_system.dll";
     #else
         const std::string ecsLib = "build/lib/libECS.so";
         const std::string uiSys = "build/lib/systems/librender_UISystem.so";
-        const std::string spriteLib = "build/lib/systems/libsprite_system.so";
     #endif
 
     _systemLoader->load_components(ecsLib, _registry);
     _systemLoader->load_system(uiSys, ILoader::RenderSystem);
-    _systemLoader->load_system(spriteLib, ILoader::RenderSystem);
 
+    open_intro();
     setup_ui();
 
     _skipEventCallbackId = MessagingManager::instance().get_event_bus().subscribe(EventTypes::KEY_PRESSED, [this](const Event& event) {
@@ -48,7 +51,7 @@ void LoadingVideoState::enter()
             auto& musicCache = audioManager.get_music().getMusicCache();
             if (musicCache.find("loading_theme") == musicCache.end()) {
                 std::string menuMusicPath = std::string(RTYPE_PATH_ASSETS) + "Audio/Loading.mp3";
-                audioManager.get_music().load("loading_theme", menuMusicPath);
+                audioManager.get_music().load_async("loading_theme", menuMusicPath);
                 audioManager.get_music().play("loading_theme", audioManager.get_music_volume());
             } else {
                 audioManager.get_music().play("loading_theme", audioManager.get_music_volume());
@@ -64,7 +67,7 @@ void LoadingVideoState::enter()
 void LoadingVideoState::exit()
 {
     std::cout << "[LoadingVideoState] Exiting state" << std::endl;
-    _imagesPaths.clear();
+    _player.close();
     MessagingManager::instance().get_event_bus().unsubscribe_deferred(_skipEventCallbackId);
     _initialized = false;
 
@@ -100,56 +103,59 @@ void LoadingVideoState::switch_to_main_menu()
 
 void LoadingVideoState::update(float delta_time)
 {
-    (void)delta_time;
-    if (!_initialized || _imagesPaths.empty()) {
+    if (!_initialized || !_player.is_open() || _player.is_finished()) {
         switch_to_main_menu();
         return;
     }
 
-    if (_currentImageIndex >= static_cast<int>(_imagesPaths.size())) {
-        switch_to_main_menu();
-        return;
-    }
+    _player.update(delta_time);
+}
 
-    _timeAccumulator += delta_time;
+void LoadingVideoState::render()
+{
+    if (!_initialized)
+        return;
 
-    if (_timeAccumulator >= delta_time * 2) {
-        auto& spr = _registry.get_component<sprite>(_imgEntity);
-        spr.texture_path = _imagesPaths[_currentImageIndex];
-        _timeAccumulator = 0.0f;
-        _currentImageIndex++;
+    if (Texture2D* frame = _player.get_texture()) {
+        auto &renderManager = RenderManager::instance();
+        auto winInfos = renderManager.get_screen_infos();
+        Rectangle source = {0.0f, 0.0f, static_cast<float>(frame->width), static_cast<float>(frame->height)};
+        Rectangle dest = {0.0f, 0.0f, static_cast<float>(winInfos.getWidth()), static_cast<float>(winInfos.getHeight())};
+        renderManager.draw_sprite(frame, source, dest, {0.0f, 0.0f}, 0.0f, WHITE);
+        // Drawn now so the skip hint ends up on top
+        renderManager.flush();
     }
+    AGameState::render();
 }
 
-void LoadingVideoState::setup_image_sequence(const std::string& directoryPath)
+void LoadingVideoState::open_intro()
 {
-    auto winInfos = RenderManager::instance().get_screen_infos();
-    std::map<int, std::string> imageMap;
-
-    for (const auto& entry : std::filesystem::directory_iterator(directoryPath)) {
-        if (entry.is_regular_file() && entry.path().extension() == ".png") {
-            std::string filename = entry.path().stem().string();
-            if (filename.starts_with("dedsecjoinus")) {
-                std::string numStr = filename.substr(12);
-                try {
-                    int num = std::stoi(numStr);
-                    imageMap[num] = entry.path().string();
-                } catch (const std::exception&) {
-                    std::cerr << "[LoadingVideoState] Invalid number in filename: " << filename << std::endl;
-                }
-            }
-        }
-    }
+    std::string animPath = std::string(RTYPE_PATH_ASSETS) + "joinusAnim/";
+    std::string packPath = RTYPE_PATH_INTRO_PACK;
 
-    for (const auto& pair : imageMap) {
-        _imagesPaths.push_back(pair.second);
+    auto& assets = AssetManager::instance();
+    std::vector<std::string> frames = ImageSequenceDecoder::order_frames(assets.list_files(animPath));
+    if (frames.empty()) {
+        std::cerr << "[LoadingVideoState] No intro frames in " << animPath << std::endl;
+        return;
     }
-
-    if (!_imagesPaths.empty()) {
-        _imgEntity = _registry.spawn_entity();
-        _registry.emplace_component<sprite>(_imgEntity, _imagesPaths[0], winInfos.getWidth(), winInfos.getHeight(), 1.0f, 1.0f);
-        _registry.emplace_component<position>(_imgEntity, winInfos.getWidth() / 2, winInfos.getHeight() / 2);
+    // Packed in the asset archive: every frame is already in one mapped file
+    if (assets.in_archive(frames.front())) {
+        _player.open(std::make_unique<ImageSequenceDecoder>(frames, RTYPE_INTRO_FPS));
+        return;
     }
+    if (!FramePack::is_stale(packPath, frames) && _player.open(packPath, RTYPE_INTRO_FPS))
+        return;
+
+    // First run, or the frames changed: play the loose images and pack them
+    // in the background for the next run. The packer outlives the intro if it
+    // has to; the state joins it when destroyed
+    _player.open(std::make_unique<ImageSequenceDecoder>(frames, RTYPE_INTRO_FPS));
+    if (_packer.joinable())
+        _packer.join();
+    _packer = std::thread([packPath, frames]() {
+        FramePack::write(packPath, frames, RTYPE_INTRO_FPS);
+    });
 }
 
 void LoadingVideoState::setup_ui()
@@ -158,13 +164,6 @@ void LoadingVideoState::setup_ui()
     auto winInfos = renderManager.get_screen_infos();
     auto theme = ThemeManager::instance().getTheme();
 
-    std::filesystem::path animPath = std::string(RTYPE_PATH_ASSETS) + "joinusAnim/";
-    if (!std::filesystem::exists(animPath) || !std::filesystem::is_directory(animPath)) {
-        switch_to_main_menu();
-        return;
-    }
-    setup_image_sequence(animPath.string());
-
     auto text = TextBuilder()
         .at(renderManager.scalePosX(5), renderManager.scalePosY(90))
         .text("Press SPACE to skip")
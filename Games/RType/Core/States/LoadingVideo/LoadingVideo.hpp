@@ -3,11 +3,15 @@
 #include "Core/States/AGameState.hpp"
 #include "ECS/Entity.hpp"
 #include "ECS/Components.hpp"
+#include "ECS/AssetManager/AssetManager.hpp"
+#include "ECS/Renderer/Video/FramePlayer.hpp"
+
+#include <thread>
 
 class LoadingVideoState : public AGameState {
     public:
         LoadingVideoState() = default;
-        ~LoadingVideoState() override = default;
+        ~LoadingVideoState() override;
 
         void enter() override;
         void exit() override;
@@ -16,16 +20,17 @@ class LoadingVideoState : public AGameState {
 
         void setup_ui() override;
         void update(float delta_time) override;
+        void render() override;
 
         std::string get_name() const override { return "LoadingVideo"; }
+        std::vector<std::string> get_next_states() const override { return {"MenusBackground", "MainMenu"}; }
     private:
-        void setup_image_sequence(const std::string& directoryPath);
+        void open_intro();
         void switch_to_main_menu();
 
-        std::vector<std::string> _imagesPaths;
-        int _currentImageIndex{0};
-        entity _imgEntity;
-
-        float _timeAccumulator = 0.0f;
+        FramePlayer _player{AssetManager::instance().get_streamer()};
+        // Packs the intro frames for the next run. Not on the streamer: with a
+        // single worker, frame decodes would wait behind the whole repack
+        std::thread _packer;
         EventBus::CallbackId _skipEventCallbackId;
 };
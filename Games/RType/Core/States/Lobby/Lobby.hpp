@@ -32,6 +32,7 @@ class Lobby : public AGameState {
         void setup_ui() override;
 
         std::string get_name() const override { return "Lobby"; }
+        std::vector<std::string> get_next_states() const override { return {"InGameMultiplayer"}; }
 
         virtual bool blocks_update() const override { return false; }
         virtual bool blocks_render() const override { return false; }
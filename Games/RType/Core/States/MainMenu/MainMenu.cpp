@@ -37,7 +37,7 @@ void MainMenuState::enter()
             auto& musicCache = audioManager.get_music().getMusicCache();
             if (musicCache.find("menu_theme") == musicCache.end()) {
                 std::string menuMusicPath = std::string(RTYPE_PATH_ASSETS) + "Audio/Menu.mp3";
-                audioManager.get_music().load("menu_theme", menuMusicPath);
+                audioManager.get_music().load_async("menu_theme", menuMusicPath);
                 audioManager.get_music().play("menu_theme", audioManager.get_music_volume());
                 std::cout << "[MainMenu] Playing menu music" << std::endl;
             } else {
@@ -28,6 +28,7 @@ class MainMenuState : public AGameState {
         bool blocks_render() const override { return false; }
 
         std::string get_name() const override { return "MainMenu"; }
+        std::vector<std::string> get_next_states() const override { return {"InGame"}; }
     private:
         void play_solo();
         void play_coop();
@@ -35,6 +35,7 @@ void MenusBackgroundState::exit()
     std::cout << "[Menus Background] Exiting state" << std::endl;
     auto &eventBus = MessagingManager::instance().get_event_bus();
     eventBus.unsubscribe(_uiEventCallbackId);
+    this->_asciiText.reset();
     this->_initialized = false;
 }
 
@@ -69,6 +70,9 @@ void MenusBackgroundState::update(float delta_time)
             int c = col_dist(rng);
             this->_asciiGrid[r][c] = this->_asciiCharset[char_dist(rng)];
         }
+        // The grid is cached by the UI system between changes
+        if (this->_asciiText)
+            this->_asciiText->markDirty();
     }
     this->_systemLoader->update_all_systems(this->_registry, delta_time, ILoader::LogicSystem);
 }
@@ -129,6 +133,11 @@ void MenusBackgroundState::setup_ui()
         }
     });
 
+    // Only changes on the timer: let the UI system cache it over the whole screen
+    asciiText->setSize(static_cast<float>(sw), static_cast<float>(sh));
+    asciiText->setAnimated(false);
+    this->_asciiText = asciiText;
+
     auto asciiTextEntity = this->_registry.spawn_entity();
     this->_registry.add_component(asciiTextEntity, UI::UIComponent(asciiText));
     this->_asciiTextEntity = asciiTextEntity;
@@ -2,6 +2,9 @@
 
 #include "Core/States/AGameState.hpp"
 #include "ECS/Entity.hpp"
+#include "ECS/UI/Components/Text.hpp"
+
+#include <memory>
 
 class MenusBackgroundState : public AGameState {
     public:
@@ -27,4 +30,5 @@ class MenusBackgroundState : public AGameState {
         std::string _asciiCharset = " .,:;i!lI|/\\()1{}[]?-_+~<>^*abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
         std::vector<std::string> _asciiGrid;
         entity _asciiTextEntity;
+        std::shared_ptr<UI::UIText> _asciiText;
 };
\ No newline at end of file
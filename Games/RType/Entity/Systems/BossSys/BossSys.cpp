@@ -87,7 +87,7 @@ void BossSys::spawn(registry &r)
         r.emplace_component<Health>(entity(bossEnt), 1000.f * static_cast<float>(wave));
         r.emplace_component<velocity>(entity(bossEnt), -300.f, 0.f);
         r.emplace_component<Enemy>(entity(bossEnt), Enemy::EnemyAIType::BOSS);
-        r.emplace_component<collider>(entity(bossEnt), bossW, bossH, -(bossW / 2.f), -(bossH / 2.f));
+        r.emplace_component<collider>(entity(bossEnt), bossW, bossH, -(bossW / 2.f), -(bossH / 2.f), false, CollisionLayer::ENEMY);
 
        Weapon w(
             entity(bossEnt),
@@ -229,7 +229,7 @@ void BossSys::startBossMusic(registry &r)
     if (audioManager.is_initialized()) {
         try {
             std::string menuMusicPath = std::string(RTYPE_PATH_ASSETS) + "Audio/Boss.mp3";
-            audioManager.get_music().load("boss_theme", menuMusicPath);
+            audioManager.get_music().load_async("boss_theme", menuMusicPath);
             audioManager.get_music().play("boss_theme", audioManager.get_music_volume());
         } catch (const std::exception& ex) {
             std::cerr << "[BossSys] Error playing music: " << ex.what() << std::endl;
@@ -247,7 +247,7 @@ void BossSys::stopBossMusic(registry &r)
             audioManager.get_music().clear();
 
             std::string gameMusicPath = std::string(RTYPE_PATH_ASSETS) + "Audio/Game.mp3";
-            audioManager.get_music().load("game_theme", gameMusicPath);
+            audioManager.get_music().load_async("game_theme", gameMusicPath);
             audioManager.get_music().play("game_theme", audioManager.get_music_volume());
 
             std::cout << "[BossSys] Boss music stopped, game audio resumed" << std::endl;
@@ -6,6 +6,7 @@
 */
 
 #include <raylib.h>
+#include <atomic>
 #include <cmath>
 #include "Draw.hpp"
 #include "ECS/Registry.hpp"
@@ -20,18 +21,43 @@ void DrawSystem::update(registry& r, float dt) {
     auto *draw_arr = r.get_if<drawable>();
     if (!pos_arr || !draw_arr) return;
 
-    for (auto [p, d, entity] : zipper(*pos_arr, *draw_arr)) {
-        // Drawables are centered on the entity position (same convention as AnimationSystem)
-        int drawX = (int)std::round(p.x - d.w / 2.0f);
-        int drawY = (int)std::round(p.y - d.h / 2.0f);
-        const Color col{
-            static_cast<unsigned char>(d.r),
-            static_cast<unsigned char>(d.g),
-            static_cast<unsigned char>(d.b),
-            static_cast<unsigned char>(d.a)
-        };
-        RenderManager::instance().draw_rectangle(drawX, drawY, (int)d.w, (int)d.h, col);
-    }
+    auto &render = RenderManager::instance();
+    auto &drawables = *draw_arr;
+    std::atomic<size_t> drawn{0};
+    std::atomic<size_t> culled{0};
+
+    render.get_queue().record(drawables.size(), [&](size_t first, size_t last, RenderCommandList &out) {
+        size_t chunkDrawn = 0;
+        size_t chunkCulled = 0;
+
+        for (size_t i = first; i < last; ++i) {
+            size_t entity = drawables.entity_at(i);
+            if (!pos_arr->has(entity)) continue;
+            const position &p = pos_arr->get(entity);
+            const drawable &d = drawables[i];
+
+            // Drawables are centered on the entity position (same convention as AnimationSystem)
+            float drawX = std::round(p.x - d.w / 2.0f);
+            float drawY = std::round(p.y - d.h / 2.0f);
+            Rectangle rect = {drawX, drawY, (float)(int)d.w, (float)(int)d.h};
+            if (!render.is_visible(rect)) {
+                ++chunkCulled;
+                continue;
+            }
+            ++chunkDrawn;
+
+            const Color col{
+                static_cast<unsigned char>(d.r),
+                static_cast<unsigned char>(d.g),
+                static_cast<unsigned char>(d.b),
+                static_cast<unsigned char>(d.a)
+            };
+            out.draw_rectangle(rect, col);
+        }
+        drawn += chunkDrawn;
+        culled += chunkCulled;
+    });
+    render.add_cull_stats(drawn, culled);
 }
 
 DLL_EXPORT ISystem* create_system() {
@@ -75,7 +75,7 @@ entity EnemySpawnSystem::spawn_enemy(registry& r, uint8_t enemy_type, float x, f
     float scale_y = GET_SCALE_Y(enemy_height, winInfos.getHeight());
 
     r.emplace_component<position>(e, x, y);
-    r.emplace_component<collider>(e, scale_x, scale_y, -scale_x / 2.0f, -scale_y / 2.0f, false);
+    r.emplace_component<collider>(e, scale_x, scale_y, -scale_x / 2.0f, -scale_y / 2.0f, false, CollisionLayer::ENEMY);
     r.emplace_component<Enemy>(e, static_cast<Enemy::EnemyAIType>(enemy_type));
 
     int base_health = 50;
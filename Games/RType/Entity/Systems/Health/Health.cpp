@@ -64,6 +64,7 @@ void HealthSys::checkAndKillEnemy(registry &r)
 
             r.emplace_component<animation>(anim, RTYPE_PATH_ASSETS + "EnemyDeath.png", frame_w, frame_h, scale, scale, 10, false, true);
             r.emplace_component<position>(anim, pos.x, pos.y);
+            spawnDeathSparks(r, pos.x, pos.y, scale);
         }
     }
 
@@ -111,6 +112,7 @@ void HealthSys::checkAndKillPlayer(registry &r)
 
             r.emplace_component<animation>(anim, RTYPE_PATH_ASSETS + "EnemyDeath.png", frame_w, frame_h, scale, scale, 10, false, true);
             r.emplace_component<position>(anim, pos.x, pos.y);
+            spawnDeathSparks(r, pos.x, pos.y, scale);
         }
     }
 
@@ -127,6 +129,20 @@ void HealthSys::checkAndKillPlayer(registry &r)
     }
 }
 
+void HealthSys::spawnDeathSparks(registry &r, float x, float y, float scale)
+{
+    // Only a registry with a particle system has a pool: headless instances skip the sparks
+    ParticlePool* effects = r.find_effects();
+    if (!effects) return;
+
+    ParticleSpawn spark;
+    spark.position = {x, y};
+    spark.life = DEATH_SPARK_LIFE;
+    spark.size = std::max(1.5f, 2.5f * scale);
+    spark.color = {255, 180, 80, 255};
+    effects->burst(DEATH_SPARK_COUNT, DEATH_SPARK_SPEED_MIN * scale, DEATH_SPARK_SPEED_MAX * scale, spark);
+}
+
 void HealthSys::addScore(registry &r, int amount)
 {
     // find existing Score entity or create one
@@ -19,6 +19,7 @@
 #include "Entity/Components/RemotePlayer/RemotePlayer.hpp"
 #include "Entity/Components/Health/Health.hpp"
 #include "ECS/Messaging/MessagingManager.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
 #include "Constants.hpp"
 
 PowerUpSys::PowerUpSys()
@@ -84,7 +85,7 @@ void PowerUpSys::spawnPowerUps(registry &r, float dt)
 
         r.emplace_component<PowerUp>(ent, type, pup_width, pup_height, pup_offset_x, pup_offset_y);
         r.emplace_component<position>(ent, spawn_x, spawn_y);
-        r.emplace_component<collider>(ent, pup_width, pup_height, pup_offset_x, pup_offset_y);
+        r.emplace_component<collider>(ent, pup_width, pup_height, pup_offset_x, pup_offset_y, false, CollisionLayer::POWER_UP);
         r.emplace_component<velocity>(ent, 0.0f, fall_speed);
 
         switch (type)
@@ -126,59 +127,26 @@ void PowerUpSys::colisionPowerUps(registry &r, float dt)
 
     std::vector<size_t> entitiesToKill;
 
-    for (auto [pUp, pPos, pCol, pEntity] : zipper(*pUpArr, *posArr, *colArr)) {
-        float p_left = pPos.x + pCol.offset_x;
-        float p_right = pPos.x + pCol.offset_x + pCol.w;
-        float p_top = pPos.y + pCol.offset_y;
-        float p_bottom = pPos.y + pCol.offset_y + pCol.h;
-
-        bool powerup_collected = false;
-
-        // Check collision with local Player entities
-        for (auto [player, playerPos, playerCol, playerWeapon, playerVel, playerHealth, playerCtrl, playerEntity] : zipper(*playerArr, *posArr, *colArr, *weaponArr, *velArr, *healthArr, *ctrlArr)) {
-            if (pEntity == playerEntity) continue;
-
-            float pl_left = playerPos.x + playerCol.offset_x;
-            float pl_right = playerPos.x + playerCol.offset_x + playerCol.w;
-            float pl_top = playerPos.y + playerCol.offset_y;
-            float pl_bottom = playerPos.y + playerCol.offset_y + playerCol.h;
-
-            bool overlap = !(p_right < pl_left || p_left > pl_right || p_bottom < pl_top || p_top > pl_bottom);
-
-            if (overlap) {
-                int wave = getWave(r);
-                applyPowerUps(playerWeapon, &playerVel, &playerHealth, &playerCtrl, pUp, wave);
-                entitiesToKill.push_back(static_cast<size_t>(pEntity));
-                auto animEnt = r.spawn_entity();
-                r.emplace_component<PUpAnimation>(animEnt, true, _pUpText[pUp._pwType]);
-                powerup_collected = true;
-                break;
-            }
-        }
-
-        // If not collected yet, check collision with remote_player entities
-        if (!powerup_collected && remoteArr) {
-            for (auto [remote, playerPos, playerCol, playerWeapon, playerVel, playerHealth, playerCtrl, playerEntity] : zipper(*remoteArr, *posArr, *colArr, *weaponArr, *velArr, *healthArr, *ctrlArr)) {
-                if (pEntity == playerEntity) continue;
-
-                float pl_left = playerPos.x + playerCol.offset_x;
-                float pl_right = playerPos.x + playerCol.offset_x + playerCol.w;
-                float pl_top = playerPos.y + playerCol.offset_y;
-                float pl_bottom = playerPos.y + playerCol.offset_y + playerCol.h;
-
-                bool overlap = !(p_right < pl_left || p_left > pl_right || p_bottom < pl_top || p_top > pl_bottom);
-
-                if (overlap) {
-                    int wave = getWave(r);
-                    applyPowerUps(playerWeapon, &playerVel, &playerHealth, &playerCtrl, pUp, wave);
-                    entitiesToKill.push_back(static_cast<size_t>(pEntity));
-                    auto animEnt = r.spawn_entity();
-                    if (_pUpText.find(pUp._pwType) != _pUpText.end()) {
-                        r.emplace_component<PUpAnimation>(animEnt, true, _pUpText[pUp._pwType]);
-                    }
-                    break;
-                }
-            }
+    // Power-up/player overlaps reported by this tick's collision pass
+    const auto &contacts = r.get_physics().get_contacts(CollisionLayer::POWER_UP, CollisionLayer::PLAYER);
+    for (auto [pEntity, playerEntity] : contacts) {
+        if (!pUpArr->has(pEntity) || pEntity == playerEntity) continue;
+        if (std::find(entitiesToKill.begin(), entitiesToKill.end(), pEntity) != entitiesToKill.end()) continue;
+
+        bool isLocal = playerArr->has(playerEntity);
+        bool isRemote = remoteArr && remoteArr->has(playerEntity);
+        if (!isLocal && !isRemote) continue;
+        if (!weaponArr->has(playerEntity) || !velArr->has(playerEntity) ||
+            !healthArr->has(playerEntity) || !ctrlArr->has(playerEntity)) continue;
+
+        auto &pUp = pUpArr->get(pEntity);
+        int wave = getWave(r);
+        applyPowerUps(weaponArr->get(playerEntity), &velArr->get(playerEntity), &healthArr->get(playerEntity),
+            &ctrlArr->get(playerEntity), pUp, wave);
+        entitiesToKill.push_back(pEntity);
+        auto animEnt = r.spawn_entity();
+        if (_pUpText.find(pUp._pwType) != _pUpText.end()) {
+            r.emplace_component<PUpAnimation>(animEnt, true, _pUpText[pUp._pwType]);
         }
     }
 
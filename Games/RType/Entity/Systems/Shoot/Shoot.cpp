@@ -9,12 +9,12 @@
 #include <iostream>
 #include <algorithm>
 #include <string>
-#include <ctime>
 
 #include "Shoot.hpp"
 
 #include <cmath>
 #include "ECS/Renderer/RenderManager.hpp"
+#include "ECS/Physics/PhysicsManager.hpp"
 #include "Constants.hpp"
 
 Shoot::Shoot()
@@ -31,6 +31,23 @@ Shoot::Shoot()
     _shootType["following"] = [this](const ProjectileContext& ctx) { shootFollowingBullets(ctx); };
     _shootType["wave"] = [this](const ProjectileContext& ctx) { shootWaveBullets(ctx); };
     _shootType["explode"] = [this](const ProjectileContext& ctx) { shootExplosionBullets(ctx); };
+
+    // Streamed in the background so the first shot and kill do not wait on the disk
+    if (_audioManager.is_initialized()) {
+        // Kills outrank the laser spam when every voice is busy
+        _audioManager.get_sfx().load_async("laser_shot", std::string(RTYPE_PATH_ASSETS) + "Audio/Laser.mp3", SFXBus::WEAPONS, 0);
+        _audioManager.get_sfx().load_async("enemy_death", std::string(RTYPE_PATH_ASSETS) + "Audio/EnemyDeath.mp3", SFXBus::IMPACTS, 1);
+    }
+}
+
+void Shoot::playSound(const std::string &name, const char *file, SFXBus bus, int priority)
+{
+    auto &sfx = _audioManager.get_sfx();
+    // Played once loaded if it is still streaming
+    if (!sfx.isLoaded(name)) {
+        sfx.load_async(name, std::string(RTYPE_PATH_ASSETS) + file, bus, priority);
+    }
+    sfx.play(name, _audioManager.get_sfx_volume());
 }
 
 static void killEntity(std::vector<entity> ents, registry &r)
@@ -47,6 +64,42 @@ static void killEntity(std::vector<entity> ents, registry &r)
     }
 }
 
+// Trigger hitbox around the projectile circle, so the collision pass reports
+// it against the opposing side only (bullets never pair with bullets)
+static void attachHitbox(registry &r, entity projectile, float radius, bool friendly)
+{
+    uint32_t layer = friendly ? CollisionLayer::PLAYER_BULLET : CollisionLayer::ENEMY_BULLET;
+    uint32_t mask = friendly ? CollisionLayer::ENEMY : CollisionLayer::PLAYER;
+    auto &hitbox = r.emplace_component<collider>(projectile, radius * 2.0f, radius * 2.0f, -radius, -radius, true, layer, mask);
+    hitbox.continuous = true;
+}
+
+// Sweeps the projectile circle over this tick's move, so fast bullets still
+// hit hitboxes thinner than the distance they cover in one tick
+static bool projectileHits(const position &ppos, const velocity *pvel, float dt, float radius,
+    const position &hpos, const collider &c, float &toi)
+{
+    AABB box(hpos.x + c.offset_x, hpos.y + c.offset_y, c.w, c.h);
+    Vector2 to{ppos.x, ppos.y};
+    Vector2 from = to;
+    if (pvel) {
+        from.x -= pvel->vx * dt;
+        from.y -= pvel->vy * dt;
+    }
+    return CollisionDetector::sweep_circle_aabb(from, to, radius, box, toi);
+}
+
+// Keeps only the earliest hit of each projectile
+static void keepFirstHits(std::vector<ProjectileHit> &hits)
+{
+    std::sort(hits.begin(), hits.end(), [](const ProjectileHit &a, const ProjectileHit &b) {
+        return a.projectile != b.projectile ? a.projectile < b.projectile : a.toi < b.toi;
+    });
+    hits.erase(std::unique(hits.begin(), hits.end(), [](const ProjectileHit &a, const ProjectileHit &b) {
+        return a.projectile == b.projectile;
+    }), hits.end());
+}
+
 void Shoot::checkShootIntention(registry & r)
 {
     auto *ctrl_arr = r.get_if<controllable>();
@@ -117,9 +170,7 @@ void Shoot::spawnProjectiles(registry &r, float dt)
 
         if (_lastLaserSoundTime <= 0.0f && _audioManager.is_initialized()) {
             try {
-                std::string laserSoundPath = std::string(RTYPE_PATH_ASSETS) + "Audio/Laser.mp3";
-                _audioManager.get_sfx().load("laser_shot", laserSoundPath);
-                _audioManager.get_sfx().play("laser_shot", _audioManager.get_sfx_volume());
+                playSound("laser_shot", "Audio/Laser.mp3", SFXBus::WEAPONS, 0);
                 _lastLaserSoundTime = _laserSoundCooldown;
             } catch (const std::exception& ex) {
                 std::cerr << "[Shoot] Error playing laser sound: " << ex.what() << std::endl;
@@ -133,10 +184,11 @@ void Shoot::spawnProjectiles(registry &r, float dt)
     }
 }
 
-void Shoot::checkEnnemyHits(registry &r)
+void Shoot::checkEnnemyHits(registry &r, float dt)
 {
     auto *projArr = r.get_if<Projectile>();
     auto *posArr = r.get_if<position>();
+    auto *velArr = r.get_if<velocity>();
     auto *healthArr = r.get_if<Health>();
     auto *colArr = r.get_if<collider>();
     auto *enemyArr = r.get_if<Enemy>();
@@ -144,50 +196,47 @@ void Shoot::checkEnnemyHits(registry &r)
 
     if (!projArr || !posArr || !healthArr || !enemyArr || !colArr) return;
 
-    for (auto [proj, ppos, projEntity] : zipper(*projArr, *posArr)) {
-        float pr = proj._radius;
-        int pdmg = proj._damage;
-        std::size_t owner = proj._ownerId;
-
-        for (auto [hlt, hpos, c, enemyEnt, targetEntity] : zipper(*healthArr, *posArr, *colArr, *enemyArr)) {
-            if (projEntity == targetEntity || !proj._friendly) continue;
-
-            float left   = hpos.x + c.offset_x;
-            float right  = hpos.x + c.offset_x + c.w;
-            float top    = hpos.y + c.offset_y;
-            float bottom = hpos.y + c.offset_y + c.h;
-
-            float closestX = std::max(left, std::min(ppos.x, right));
-            float closestY = std::max(top, std::min(ppos.y, bottom));
-            float dx = ppos.x - closestX;
-            float dy = ppos.y - closestY;
-            float dist2 = dx * dx + dy * dy;
-
-            if (dist2 <= pr * pr) {
-                hlt._health -= pdmg;
-                entityToKill.push_back(entity(projEntity));
-
-                if (hlt._health <= 0 && _audioManager.is_initialized()) {
-                    try {
-                        std::string deathSoundPath = std::string(RTYPE_PATH_ASSETS) + "Audio/EnemyDeath.mp3";
-                        std::string soundId = "enemy_death_" + std::to_string(std::time(nullptr)) + "_" + std::to_string(static_cast<size_t>(targetEntity));
-                        _audioManager.get_sfx().load(soundId, deathSoundPath);
-                        _audioManager.get_sfx().play(soundId, _audioManager.get_sfx_volume());
-                    } catch (const std::exception& ex) {
-                        std::cerr << "[Shoot] Error playing enemy death sound: " << ex.what() << std::endl;
-                    }
-                }
-                break;
+    // Contacts come from this tick's collision pass, one per overlapping pair
+    const auto &contacts = r.get_physics().get_contacts(CollisionLayer::PLAYER_BULLET, CollisionLayer::ENEMY);
+    _hits.clear();
+    for (auto [projEntity, targetEntity] : contacts) {
+        if (!projArr->has(projEntity) || !posArr->has(projEntity)) continue;
+        if (!healthArr->has(targetEntity) || !posArr->has(targetEntity) ||
+            !colArr->has(targetEntity) || !enemyArr->has(targetEntity)) continue;
+
+        auto &proj = projArr->get(projEntity);
+        if (!proj._friendly) continue;
+
+        const velocity *vel = (velArr && velArr->has(projEntity)) ? &velArr->get(projEntity) : nullptr;
+        float toi = 0.0f;
+        if (projectileHits(posArr->get(projEntity), vel, dt, proj._radius, posArr->get(targetEntity), colArr->get(targetEntity), toi)) {
+            _hits.push_back({projEntity, targetEntity, toi});
+        }
+    }
+    keepFirstHits(_hits);
+
+    for (const auto &hit : _hits) {
+        auto &proj = projArr->get(hit.projectile);
+        auto &hlt = healthArr->get(hit.target);
+        hlt._health -= proj._damage;
+        entityToKill.push_back(entity(hit.projectile));
+
+        if (hlt._health <= 0 && _audioManager.is_initialized()) {
+            try {
+                playSound("enemy_death", "Audio/EnemyDeath.mp3", SFXBus::IMPACTS, 1);
+            } catch (const std::exception& ex) {
+                std::cerr << "[Shoot] Error playing enemy death sound: " << ex.what() << std::endl;
             }
         }
     }
     killEntity(entityToKill, r);
 }
 
-void Shoot::checkPlayerHits(registry &r)
+void Shoot::checkPlayerHits(registry &r, float dt)
 {
     auto *projArr = r.get_if<Projectile>();
     auto *posArr = r.get_if<position>();
+    auto *velArr = r.get_if<velocity>();
     auto *healthArr = r.get_if<Health>();
     auto *colArr = r.get_if<collider>();
     auto *ctrlArr = r.get_if<controllable>();
@@ -195,32 +244,30 @@ void Shoot::checkPlayerHits(registry &r)
 
     if (!projArr || !posArr || !healthArr || !colArr || !ctrlArr) return;
 
-    for (auto [proj, ppos, projEntity] : zipper(*projArr, *posArr)) {
-        float pr = proj._radius;
-        int pdmg = proj._damage;
-
-        for (auto [hlt, hpos, c, ctrl, targetEntity] : zipper(*healthArr, *posArr, *colArr, *ctrlArr)) {
-            if (projEntity == targetEntity || proj._friendly) continue; // only enemy projectiles
-
-            float left   = hpos.x + c.offset_x;
-            float right  = hpos.x + c.offset_x + c.w;
-            float top    = hpos.y + c.offset_y;
-            float bottom = hpos.y + c.offset_y + c.h;
-
-            float closestX = std::max(left, std::min(ppos.x, right));
-            float closestY = std::max(top, std::min(ppos.y, bottom));
-            float dx = ppos.x - closestX;
-            float dy = ppos.y - closestY;
-            float dist2 = dx * dx + dy * dy;
-
-            if (dist2 <= pr * pr) {
-                hlt._health -= pdmg;
-                entityToKill.push_back(entity(projEntity));
-                std::cout << "player hit current health: " << hlt._health << std::endl;
-                break;
-            }
+    const auto &contacts = r.get_physics().get_contacts(CollisionLayer::ENEMY_BULLET, CollisionLayer::PLAYER);
+    _hits.clear();
+    for (auto [projEntity, targetEntity] : contacts) {
+        if (!projArr->has(projEntity) || !posArr->has(projEntity)) continue;
+        if (!healthArr->has(targetEntity) || !posArr->has(targetEntity) ||
+            !colArr->has(targetEntity) || !ctrlArr->has(targetEntity)) continue;
+
+        auto &proj = projArr->get(projEntity);
+        if (proj._friendly) continue; // only enemy projectiles
+
+        const velocity *vel = (velArr && velArr->has(projEntity)) ? &velArr->get(projEntity) : nullptr;
+        float toi = 0.0f;
+        if (projectileHits(posArr->get(projEntity), vel, dt, proj._radius, posArr->get(targetEntity), colArr->get(targetEntity), toi)) {
+            _hits.push_back({projEntity, targetEntity, toi});
         }
     }
+    keepFirstHits(_hits);
+
+    for (const auto &hit : _hits) {
+        auto &hlt = healthArr->get(hit.target);
+        hlt._health -= projArr->get(hit.projectile)._damage;
+        entityToKill.push_back(entity(hit.projectile));
+        std::cout << "player hit current health: " << hlt._health << std::endl;
+    }
 
     killEntity(entityToKill, r);
 }
@@ -230,6 +277,7 @@ void Shoot::shootBaseBullets(const ProjectileContext& ctx)
     auto projectile = ctx.r.spawn_entity();
 
     ctx.r.emplace_component<Projectile>(projectile, Projectile(ctx.owner_entity, ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_x, ctx.dir_y, 5.0f, 4.0f, true));
+    attachHitbox(ctx.r, projectile, 4.0f, true);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/Binary_bullet-Sheet.png", ctx.frame_width, ctx.frame_height, 0.3f * ctx.speed_scale, 0.3f * ctx.speed_scale, 0, false);
@@ -242,6 +290,7 @@ void Shoot::shootHardBullets(const ProjectileContext& ctx)
     auto projectile = ctx.r.spawn_entity();
 
     ctx.r.emplace_component<Projectile>(projectile, Projectile(ctx.owner_entity, ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_x, ctx.dir_y, 5.0f, 4.0f, true));
+    attachHitbox(ctx.r, projectile, 4.0f, true);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/Binary_bullet-Sheet.png", ctx.frame_width, ctx.frame_height, 0.3f * ctx.speed_scale, 0.3f * ctx.speed_scale, 0, false);
@@ -253,6 +302,7 @@ void Shoot::shootBigBullets(const ProjectileContext& ctx)
     auto projectile = ctx.r.spawn_entity();
 
     ctx.r.emplace_component<Projectile>(projectile, Projectile(ctx.owner_entity, ctx.weapon._damage * 2, ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_x, ctx.dir_y, 5.0f, 110.0f, true));
+    attachHitbox(ctx.r, projectile, 110.0f, true);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/Binary_bullet-Sheet.png", ctx.frame_width, ctx.frame_height, 0.5f * ctx.speed_scale, 0.5f * ctx.speed_scale, 0, false);
@@ -264,6 +314,7 @@ void Shoot::shootParabolBullets(const ProjectileContext& ctx)
     auto projectile = ctx.r.spawn_entity();
 
     ctx.r.emplace_component<Projectile>(projectile, Projectile(ctx.owner_entity, ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_x, ctx.dir_y, 5.0f, 4.0f, true));
+    attachHitbox(ctx.r, projectile, 4.0f, true);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/pbShoot.gif", 34, 34, 1.2f * ctx.speed_scale, 1.2f * ctx.speed_scale, 3, false);
@@ -274,6 +325,7 @@ void Shoot::shootParabolBullets(const ProjectileContext& ctx)
     auto projectile2 = ctx.r.spawn_entity();
 
     ctx.r.emplace_component<Projectile>(projectile2, Projectile(ctx.owner_entity, ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_x, ctx.dir_y, 5.0f, 4.0f, true));
+    attachHitbox(ctx.r, projectile2, 4.0f, true);
     ctx.r.emplace_component<position>(projectile2, ctx.spawn_x, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile2, ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale, ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile2, std::string(RTYPE_PATH_ASSETS) + "Shoots/pbShoot.gif", 34, 34, 1.2f * ctx.speed_scale, 1.2f * ctx.speed_scale, 3, false);
@@ -287,6 +339,7 @@ void Shoot::shootEnemyBullets(const ProjectileContext& ctx)
     auto projectile = ctx.r.spawn_entity();
 
     ctx.r.emplace_component<Projectile>(projectile, Projectile(static_cast<int>(ctx.owner_entity), ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, -1.0f, 0.0f, 5.0f, 4.0f, false));
+    attachHitbox(ctx.r, projectile, 4.0f, false);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x - 10.0f, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, -(ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale), ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/enemyBullet.png", 24, 24, 3.0f * ctx.speed_scale, 3.0f * ctx.speed_scale, 8, false);
@@ -305,6 +358,7 @@ void Shoot::shootDropBullets(const ProjectileContext& ctx)
     for (int i = 0; i < 5; ++i) {
         auto proj = ctx.r.spawn_entity();
         ctx.r.emplace_component<Projectile>(proj, Projectile(static_cast<int>(ctx.owner_entity), ctx.weapon._damage, ctx.weapon._projectileSpeed * 2.0f * ctx.speed_scale, -1.0f, 0.0f, 5.0f, 10.0f, false));
+        attachHitbox(ctx.r, proj, 10.0f, false);
         ctx.r.emplace_component<position>(proj, ctx.spawn_x - (i * renderManager.scaleSizeW(5)), -200.f - (i * renderManager.scaleSizeW(3)));
         ctx.r.emplace_component<velocity>(proj, velX, velY);
         ctx.r.emplace_component<animation>(proj, std::string(RTYPE_PATH_ASSETS) + "Shoots/rocket.png", 400, 400, 0.50f * ctx.speed_scale, 0.50f * ctx.speed_scale, 0, false);
@@ -316,6 +370,7 @@ void Shoot::shootFollowingBullets(const ProjectileContext &ctx)
 {
     auto projectile = ctx.r.spawn_entity();
     ctx.r.emplace_component<Projectile>(projectile, Projectile(static_cast<int>(ctx.owner_entity), ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, -1.0f, 0.0f, 5.0f, 5.0f, false));
+    attachHitbox(ctx.r, projectile, 5.0f, false);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x - 10.0f, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, -(ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale), ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/followingShoot.gif", 17.08f, 18, 5.0f * ctx.speed_scale, 5.0f * ctx.speed_scale, 12, false);
@@ -339,6 +394,7 @@ void Shoot::shootWaveBullets(const ProjectileContext &ctx)
     w._wantsToFire = false;
     w._automatic = false;
     ctx.r.emplace_component<Projectile>(projectile, Projectile(static_cast<int>(ctx.owner_entity), ctx.weapon._damage, ctx.weapon._projectileSpeed * ctx.speed_scale, -1.0f, 0.0f, 5.0f, 5.0f, false));
+    attachHitbox(ctx.r, projectile, 5.0f, false);
     ctx.r.emplace_component<position>(projectile, ctx.spawn_x - 10.0f, ctx.spawn_y);
     ctx.r.emplace_component<velocity>(projectile, -(ctx.dir_x * ctx.weapon._projectileSpeed * ctx.speed_scale), ctx.dir_y * ctx.weapon._projectileSpeed * ctx.speed_scale);
     ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/rocket.png", 400, 400, 0.50f * ctx.speed_scale, 0.50f * ctx.speed_scale, 0, false);
@@ -360,6 +416,7 @@ void Shoot::shootExplosionBullets(const ProjectileContext &ctx)
 
         auto projectile = ctx.r.spawn_entity();
         ctx.r.emplace_component<Projectile>(projectile, Projectile(static_cast<int>(ctx.owner_entity), ctx.weapon._damage, speed, vx, vy, 5.0f, 5.0f, false));
+        attachHitbox(ctx.r, projectile, 5.0f, false);
         ctx.r.emplace_component<position>(projectile, ctx.spawn_x, ctx.spawn_y);
         ctx.r.emplace_component<velocity>(projectile, vx, vy);
         ctx.r.emplace_component<animation>(projectile, std::string(RTYPE_PATH_ASSETS) + "Shoots/pbShoot.gif", 34, 34, 1.0f * ctx.speed_scale, 1.0f * ctx.speed_scale, 3, false);
@@ -396,10 +453,10 @@ void Shoot::update(registry& r, float dt) {
     /* Player Shooting*/
     checkShootIntention(r);
     spawnProjectiles(r, dt);
-    checkEnnemyHits(r);
+    checkEnnemyHits(r, dt);
 
     /* Enemy Shooting*/
-    checkPlayerHits(r);
+    checkPlayerHits(r, dt);
     // renderHitboxes(r);
 }
 
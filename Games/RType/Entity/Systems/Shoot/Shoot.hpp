@@ -50,6 +50,14 @@ struct ProjectileContext {
     float frame_height{220.0f};
 };
 
+// Projectile contact confirmed by the swept test; toi is the fraction of the
+// tick's move at first contact
+struct ProjectileHit {
+    size_t projectile;
+    size_t target;
+    float toi;
+};
+
 class Shoot : public ISystem {
 public:
     Shoot();
@@ -64,9 +72,10 @@ private:
 
     void spawnProjectiles(registry &r, float dt);
     void checkShootIntention(registry & r);
-    void checkEnnemyHits(registry & r);
-    void checkPlayerHits(registry & r);
+    void checkEnnemyHits(registry & r, float dt);
+    void checkPlayerHits(registry & r, float dt);
     void renderHitboxes(registry &r);
+    void playSound(const std::string &name, const char *file, SFXBus bus, int priority);
 
     /* SHOOT FUNCTIONS */
     void shootBaseBullets(const ProjectileContext& ctx);
@@ -83,6 +92,7 @@ private:
 
     std::map<std::string, std::function<void(const ProjectileContext&)>> _shootType;
     EventBus::CallbackId _playerCloseCallBackId;
+    std::vector<ProjectileHit> _hits; // reused by the hit passes
 };
 
 
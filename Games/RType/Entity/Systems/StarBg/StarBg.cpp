@@ -7,32 +7,37 @@
 
 #include <memory>
 #include <random>
-#include <cmath>
+#include <vector>
 #include <iostream>
 
 #include "StarBg.hpp"
 #include "Constants.hpp"
 #include "ECS/Renderer/RenderManager.hpp"
 #include "ECS/Registry.hpp"
+#include "ECS/Components/Parallax.hpp"
 
-void StarBg::update(registry& r, float dt)
+void StarBg::update(registry& r, float)
 {
-    // Initialize on first update (seed from registry)
-    if (!initialized_) {
-        seed_from_registry(r);
-        initialized_ = true;
-    }
-
-    // Only generate stars once
-    if (_stars.empty()) {
-        generate_stars(r);
-    }
+    // The layers are painted once and scrolled by the parallax system
+    if (initialized_)
+        return;
+    seed_from_registry(r);
 
-    // Update star positions with actual delta time
-    update_stars(dt, r);
+    auto& renderManager = RenderManager::instance();
+    int screen_width = renderManager.get_screen_infos().getWidth();
+    int screen_height = renderManager.get_screen_infos().getHeight();
 
-    // Render stars
-    render_stars();
+    // Same 150 stars and 50-300 px/s range as before, grouped by speed so
+    // that each group is one layer: small and dim far away, big and bright near
+    const Depth depths[] = {
+        {80, 70.0f, 0.1f, 0.5f, 1.2f, 150, 200, -300},
+        {45, 150.0f, 0.3f, 1.0f, 2.0f, 190, 235, -200},
+        {25, 280.0f, 0.6f, 1.8f, 3.0f, 220, 255, -100},
+    };
+    for (const auto& depth : depths) {
+        spawn_layer(r, depth, screen_width, screen_height);
+    }
+    initialized_ = true;
 }
 
 void StarBg::seed_from_registry(registry& r) {
@@ -47,68 +52,42 @@ void StarBg::seed_from_registry(registry& r) {
     }
 }
 
-void StarBg::generate_stars(registry& r)
+void StarBg::spawn_layer(registry& r, const Depth& depth, int width, int height)
 {
-    auto& renderManager = RenderManager::instance();
-    int screen_width = renderManager.get_screen_infos().getWidth();
-    int screen_height = renderManager.get_screen_infos().getHeight();
-    
-    std::uniform_real_distribution<> dis_x(0.0, screen_width);
-    std::uniform_real_distribution<> dis_y(0.0, screen_height);
-    std::uniform_real_distribution<> dis_speed(50.0, 300.0);
-    std::uniform_real_distribution<> dis_size(0.5, 3.0);
-    std::uniform_int_distribution<> dis_brightness(200, 255);
-
-    const int num_stars = 150;
-    _stars.reserve(num_stars);
-
-    for (int i = 0; i < num_stars; ++i) {
+    struct Star {
+        Vector2 position;
+        float size;
+        Color color;
+    };
+
+    // Kept off the tile edges: a star cut by one would show a seam where the tile repeats
+    std::uniform_real_distribution<> dis_size(depth.min_size, depth.max_size);
+    std::uniform_real_distribution<> dis_x(depth.max_size, width - depth.max_size);
+    std::uniform_real_distribution<> dis_y(depth.max_size, height - depth.max_size);
+    std::uniform_int_distribution<> dis_brightness(depth.min_brightness, depth.max_brightness);
+
+    // Drawn from the registry seed here, not in paint(), so every client gets the same sky
+    std::vector<Star> stars;
+    stars.reserve(depth.count);
+    for (size_t i = 0; i < depth.count; ++i) {
         Star star;
-        star.x = dis_x(rng_);
-        star.y = dis_y(rng_);
-        star.speed = dis_speed(rng_);
-        star.size = dis_size(rng_);
-        star.brightness = static_cast<float>(dis_brightness(rng_));
-        _stars.push_back(star);
+        star.position = {static_cast<float>(dis_x(rng_)), static_cast<float>(dis_y(rng_))};
+        star.size = static_cast<float>(dis_size(rng_));
+        auto brightness = static_cast<unsigned char>(dis_brightness(rng_));
+        star.color = {brightness, brightness, static_cast<unsigned char>(brightness * 0.9f), 255};
+        stars.push_back(star);
     }
-}
 
-void StarBg::update_stars(float delta_time, registry& r)
-{
-    auto& renderManager = RenderManager::instance();
-    int screen_width = renderManager.get_screen_infos().getWidth();
-    int screen_height = renderManager.get_screen_infos().getHeight();
-    
-    std::uniform_real_distribution<> dis_y(0.0, screen_height);
-    
-    for (auto& star : _stars) {
-        // Move star from right to left
-        star.x -= star.speed * delta_time;
-
-        // Wrap around: if star goes off left side, reset to right side
-        if (star.x < -10.0f) {
-            star.x = screen_width + 10.0f;
-            star.y = dis_y(rng_);
+    parallax_layer layer([stars](int, int) {
+        for (const auto& star : stars) {
+            DrawCircleV(star.position, star.size, star.color);
         }
-    }
-}
-
-void StarBg::render_stars() const
-{
-    auto& renderManager = RenderManager::instance();
-
-    for (const auto& star : _stars) {
-        // Create a subtle twinkling effect
-        float flicker = 0.8f + 0.2f * sinf(GetTime() * 3.0f + star.x);
-        Color star_color = {
-            static_cast<unsigned char>(star.brightness * flicker),
-            static_cast<unsigned char>(star.brightness * flicker),
-            static_cast<unsigned char>(star.brightness * flicker * 0.9f),
-            255
-        };
+    }, depth.depth, -depth.speed, 0.0f, depth.layer);
+    layer.tile_width = width;
+    layer.tile_height = height;
 
-        renderManager.draw_circle(static_cast<int>(star.x), static_cast<int>(star.y), star.size, star_color);
-    }
+    auto e = r.spawn_entity();
+    r.add_component(e, std::move(layer));
 }
 
 
@@ -9,31 +9,30 @@
 
 #include "ECS/Systems/ISystem.hpp"
 
-#include <vector>
 #include <random>
 
-struct Star {
-    float x;
-    float y;
-    float speed;
-    float size;
-    float brightness;
-};
-
+// Spawns the starfield as three parallax layers, far to near; the parallax
+// system then draws each as a single cached quad scrolling at its own speed
 class StarBg : public ISystem {
 public:
     ~StarBg() override = default;
     void update(registry& r, float dt = 0.0f) override;
     const char* get_name() const override { return "StarBg"; }
 private:
-    std::vector<Star> _stars;
+    struct Depth {
+        size_t count;
+        float speed;        // pixels per second, to the left
+        float depth;        // share of the camera movement followed
+        float min_size, max_size;
+        int min_brightness, max_brightness;
+        int layer;
+    };
+
     std::mt19937 rng_;
     bool initialized_{false};
 
-    void generate_stars(registry& r);
     void seed_from_registry(registry& r);
-    void update_stars(float delta_time, registry& r);
-    void render_stars() const;
+    void spawn_layer(registry& r, const Depth& depth, int width, int height);
 };
 
 
@@ -45,11 +45,13 @@ namespace RType {
             if (_messages.size() > 20) {
                 _messages.erase(_messages.begin());
             }
+            markDirty();
         }
 
         // Clear chat
         void clear_messages() {
             _messages.clear();
+            markDirty();
         }
 
         // Get all messages
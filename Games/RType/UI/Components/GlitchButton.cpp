@@ -60,7 +60,7 @@ namespace RType {
         Vector2 pos = _position;
         Vector2 size = _size;
 
-        Vector2 text_size = MeasureTextEx(font, getText().c_str(), _style.getFontSize(), 1.0f);
+        Vector2 text_size = renderManager.measure_text_ex(font, getText().c_str(), _style.getFontSize(), 1.0f);
         float text_x = pos.x + (size.x - text_size.x) / 2.0f;
         float text_y = pos.y + (size.y - text_size.y) / 2.0f;
 
@@ -72,17 +72,17 @@ namespace RType {
 
             // RGB split effect
             Color rcol = {255, 50, 80, text_color.a};
-            DrawTextEx(font, getText().c_str(),
-                      {text_x + jitter_x + 1, text_y + jitter_y},
-                      _style.getFontSize(), 1.0f, rcol);
+            renderManager.draw_text_ex(font, getText().c_str(),
+                                       {text_x + jitter_x + 1, text_y + jitter_y},
+                                       _style.getFontSize(), 1.0f, rcol);
 
             Color gcol = {0, 255, 156, static_cast<unsigned char>(text_color.a * 0.6f)};
-            DrawTextEx(font, getText().c_str(),
-                      {text_x - jitter_x - 1, text_y - jitter_y},
-                      _style.getFontSize(), 1.0f, gcol);
+            renderManager.draw_text_ex(font, getText().c_str(),
+                                       {text_x - jitter_x - 1, text_y - jitter_y},
+                                       _style.getFontSize(), 1.0f, gcol);
 
-            DrawTextEx(font, getText().c_str(),
-                      {text_x, text_y}, _style.getFontSize(), 1.0f, text_color);
+            renderManager.draw_text_ex(font, getText().c_str(),
+                                       {text_x, text_y}, _style.getFontSize(), 1.0f, text_color);
 
             // Scanline flicker
             if (((static_cast<int>(GetTime() * 10) + _hover_seed) % 5) == 0) {
@@ -95,8 +95,8 @@ namespace RType {
                 text_x += 1;
                 text_y += 1;
             }
-            DrawTextEx(font, getText().c_str(),
-                      {text_x, text_y}, _style.getFontSize(), 1.0f, text_color);
+            renderManager.draw_text_ex(font, getText().c_str(),
+                                       {text_x, text_y}, _style.getFontSize(), 1.0f, text_color);
         }
     }
 }